@@ -0,0 +1,36 @@
+/*
+** .empty_main.cpp
+** Template for cow_map mains, which are compared with std::map
+*/
+
+#include "test_utils.hpp"
+#include "COW_MAP_UC.HPP"
+#include <map>
+
+#ifndef STD
+# define NAMESPACE ft
+#else
+# define NAMESPACE std
+# define cow_map map
+#endif
+
+using namespace NAMESPACE;
+
+template <class Key, class T>
+void	print(const cow_map<Key, T>& lst)
+{
+	for (typename cow_map<Key, T>::const_iterator it = lst.begin(); it != lst.end(); it++)
+		cout << it->first << " => " << it->second << '\n';
+}
+
+int main()
+{
+	/* THIS IS A TEMPLATE MAIN
+	** WRITE ANY TEST YOU WANT TO PERFORM
+	** SAVE IT UNDER 'something_main.cpp'
+	** IT WILL BE RUN WITH FT::COW_MAP AND STD::MAP
+	** BOTH OUTPUTS WILL BE COMPARED
+	*/
+
+	return (0);
+}
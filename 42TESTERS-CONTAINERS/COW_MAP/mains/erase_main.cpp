@@ -0,0 +1,87 @@
+/*
+** erase_main.cpp
+** Erasures and hinted insertions through iterators of a cow_map, while
+** it is shared and once it is not, compared with std::map
+*/
+
+#include "test_utils.hpp"
+#include "COW_MAP_UC.HPP"
+#include <map>
+
+/*
+** std has no cow_map: its copies are deep, which is how a cow_map must
+** look from the outside
+*/
+#ifndef STD
+# define NAMESPACE ft
+#else
+# define NAMESPACE std
+# define cow_map map
+#endif
+
+using namespace NAMESPACE;
+
+template <class Key, class T>
+void	print(const cow_map<Key, T>& lst)
+{
+	for (typename cow_map<Key, T>::const_iterator it = lst.begin(); it != lst.end(); it++)
+		cout << it->first << " => " << it->second << '\n';
+}
+
+int main()
+{
+	cow_map<int, int>	a;
+
+	for (int i = 0; i < 10; ++i)
+		a.insert(make_pair(i, i * 10));
+
+	// Iterators into a shared map, used by the change that copies it
+	{
+		cow_map<int, int>	b(a);
+
+		a.erase(a.find(3));
+		cout << "a.count(3): " << a.count(3) << '\n';
+		cout << "b.count(3): " << b.count(3) << '\n';
+		print(a);
+		print(b);
+	}
+	{
+		cow_map<int, int>	b(a);
+
+		a.erase(a.find(5), a.find(8));
+		cout << "a.size(): " << a.size() << '\n';
+		cout << "b.size(): " << b.size() << '\n';
+		print(a);
+		print(b);
+	}
+	{
+		cow_map<int, int>	b(a);
+
+		a.erase(a.find(8), a.end());
+		cout << "a.size(): " << a.size() << '\n';
+		cout << "b.size(): " << b.size() << '\n';
+		print(a);
+		print(b);
+	}
+	{
+		cow_map<int, int>	b(a);
+
+		a.insert(a.find(0), make_pair(100, 1000));
+		cout << "a.size(): " << a.size() << '\n';
+		cout << "b.size(): " << b.size() << '\n';
+		print(a);
+		print(b);
+	}
+
+	// Iterators into a map owned alone are used as they are
+	{
+		cow_map<int, int>::iterator it = a.find(0);
+
+		a.erase(it);
+		a.insert(a.find(4), make_pair(5, 50));
+		a.erase(a.find(2), a.end());
+		cout << "a.size(): " << a.size() << '\n';
+		print(a);
+	}
+	return (0);
+}
@@ -0,0 +1,190 @@
+/*
+** wakeup_main.cpp
+** Producers and consumers of an mpmc_queue that block on it, compared
+** with a locked std::deque
+*/
+
+#include "test_utils.hpp"
+#include "MPMC_QUEUE_UC.HPP"
+#include <deque>
+#include <pthread.h>
+#include <sched.h>
+
+/*
+** std has no mpmc_queue: a std::deque behind a mutex and two condition
+** variables pops the same values. A thread that misses its wakeup never
+** ends, and the tester reports a timeout.
+*/
+#ifndef STD
+# define NAMESPACE ft
+#else
+# define NAMESPACE std
+# define mpmc_queue locked_queue
+
+template <typename T>
+class locked_queue
+{
+public:
+	explicit locked_queue(std::size_t capacity) : _capacity(capacity)
+	{
+		pthread_mutex_init(&_lock, 0);
+		pthread_cond_init(&_not_empty, 0);
+		pthread_cond_init(&_not_full, 0);
+	}
+
+	~locked_queue()
+	{
+		pthread_cond_destroy(&_not_full);
+		pthread_cond_destroy(&_not_empty);
+		pthread_mutex_destroy(&_lock);
+	}
+
+	bool try_push(const T &x)
+	{
+		bool pushed;
+
+		pthread_mutex_lock(&_lock);
+		pushed = _queue.size() < _capacity;
+		if (pushed)
+		{
+			_queue.push_back(x);
+			pthread_cond_signal(&_not_empty);
+		}
+		pthread_mutex_unlock(&_lock);
+		return pushed;
+	}
+
+	void push(const T &x)
+	{
+		pthread_mutex_lock(&_lock);
+		while (_queue.size() >= _capacity)
+			pthread_cond_wait(&_not_full, &_lock);
+		_queue.push_back(x);
+		pthread_cond_signal(&_not_empty);
+		pthread_mutex_unlock(&_lock);
+	}
+
+	void pop(T &x)
+	{
+		pthread_mutex_lock(&_lock);
+		while (_queue.empty())
+			pthread_cond_wait(&_not_empty, &_lock);
+		x = _queue.front();
+		_queue.pop_front();
+		pthread_cond_signal(&_not_full);
+		pthread_mutex_unlock(&_lock);
+	}
+
+private:
+	std::size_t		_capacity;
+	pthread_mutex_t	_lock;
+	pthread_cond_t	_not_empty;
+	pthread_cond_t	_not_full;
+	std::deque<T>	_queue;
+};
+#endif
+
+using namespace NAMESPACE;
+
+struct worker
+{
+	mpmc_queue<long>	*queue;
+	long				first;
+	long				count;
+	bool				polling;	// try_push() only, never sleeps
+	long				sum;
+};
+
+void	*produce(void *arg)
+{
+	worker &w = *static_cast<worker *>(arg);
+
+	for (long i = w.first; i < w.first + w.count; ++i)
+	{
+		if (w.polling)
+			while (!w.queue->try_push(i))
+				sched_yield();
+		else
+			w.queue->push(i);
+	}
+	return 0;
+}
+
+void	*consume(void *arg)
+{
+	worker &w = *static_cast<worker *>(arg);
+	long v;
+
+	w.sum = 0;
+	for (long i = 0; i < w.count; ++i)
+	{
+		w.queue->pop(v);
+		w.sum += v;
+	}
+	return 0;
+}
+
+// Runs producers and consumers, the consumers first so that they wait
+// on an empty queue, and returns the sum of the values they popped
+long	run_once(size_t capacity, int threads, long count, bool polling)
+{
+	mpmc_queue<long>	q(capacity);
+	pthread_t			consumers[8];
+	pthread_t			producers[8];
+	worker				c[8];
+	worker				p[8];
+	long				sum = 0;
+
+	for (int i = 0; i < threads; ++i)
+	{
+		c[i].queue = &q;
+		c[i].count = count;
+		pthread_create(&consumers[i], 0, &consume, &c[i]);
+	}
+	for (int i = 0; i < threads; ++i)
+	{
+		p[i].queue = &q;
+		p[i].first = i * count;
+		p[i].count = count;
+		p[i].polling = polling;
+		pthread_create(&producers[i], 0, &produce, &p[i]);
+	}
+	for (int i = 0; i < threads; ++i)
+		pthread_join(producers[i], 0);
+	for (int i = 0; i < threads; ++i)
+	{
+		pthread_join(consumers[i], 0);
+		sum += c[i].sum;
+	}
+	return sum;
+}
+
+// Short rounds end often with every consumer asleep, where a lost
+// wakeup is never made up for by a later one
+void	run(const char *name, size_t capacity, int threads, long count,
+			bool polling, int rounds = 1)
+{
+	long	sum = 0;
+
+	for (int i = 0; i < rounds; ++i)
+		sum += run_once(capacity, threads, count, polling);
+	cout << name << ": " << sum << '\n';
+}
+
+int main()
+{
+	// Consumers sleep in pop() until push() wakes them
+	run("pop waits", 1024, 1, 1000, false);
+	run("pop waits, 4 threads", 1024, 4, 5000, false);
+
+	// Producers sleep in push() on a full queue until pop() wakes them
+	run("push waits", 2, 1, 5000, false);
+	run("push waits, 4 threads", 4, 4, 5000, false);
+	run("push waits, capacity 1", 1, 4, 50, false, 20);
+
+	// Only try_push() wakes the consumers: a lost wakeup hangs here
+	run("try_push wakes pop", 2, 1, 5000, true);
+	run("try_push wakes pop, 4 threads", 16, 4, 10000, true);
+	run("try_push wakes pop, 8 threads", 2, 8, 50, true, 50);
+	return (0);
+}
@@ -0,0 +1,54 @@
+/*
+** insertHint_main.cpp
+** Hinted insertions into a multimap, with right and wrong hints
+*/
+
+#include "test_utils.hpp"
+#include "MULTIMAP_UC.HPP"
+#include <map>
+
+#ifndef STD
+# define NAMESPACE ft
+#else
+# define NAMESPACE std
+#endif
+
+using namespace NAMESPACE;
+
+template <class Key, class T>
+void	print(multimap<Key, T>& lst)
+{
+	for (typename multimap<Key, T>::iterator it = lst.begin(); it != lst.end(); it++)
+		cout << it->first << " => " << it->second << '\n';
+}
+
+int main()
+{
+	typedef multimap<int, std::string>::value_type	value;
+	multimap<int, std::string>						mymap;
+
+	// Sorted runs appended at end(), then hints right and wrong
+	for (int i = 0; i < 30; ++i)
+		mymap.insert(mymap.end(), value(i / 4, std::string(1, 'a' + i % 26)));
+	mymap.insert(mymap.begin(), value(0, std::string("first")));
+	mymap.insert(mymap.find(3), value(3, std::string("before the 3s")));
+	mymap.insert(mymap.begin(), value(5, std::string("far from begin")));
+	mymap.insert(mymap.end(), value(-1, std::string("far from end")));
+	print(mymap);
+
+	// Erase some of the equal keys, then look them up
+	mymap.erase(mymap.find(2));
+	mymap.erase(--mymap.upper_bound(4));
+	mymap.erase(6);
+	for (int k = -1; k <= 8; ++k)
+	{
+		pair<multimap<int, std::string>::iterator,
+			 multimap<int, std::string>::iterator> ret = mymap.equal_range(k);
+
+		cout << k << ": " << mymap.count(k) << " =>";
+		for (; ret.first != ret.second; ++ret.first)
+			cout << ' ' << ret.first->second;
+		cout << '\n';
+	}
+	return (0);
+}
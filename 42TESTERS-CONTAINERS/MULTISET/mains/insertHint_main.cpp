@@ -0,0 +1,60 @@
+/*
+** insertHint_main.cpp
+** Hinted insertions into a multiset, with right and wrong hints
+*/
+
+#include "test_utils.hpp"
+#include "MULTISET_UC.HPP"
+#include <set>
+
+#ifndef STD
+# define NAMESPACE ft
+#else
+# define NAMESPACE std
+#endif
+
+using namespace NAMESPACE;
+
+template <class T>
+void	print(multiset<T>& lst)
+{
+	for (typename multiset<T>::iterator it = lst.begin(); it != lst.end(); it++)
+		cout << *it << ' ';
+	cout << '\n';
+}
+
+int main()
+{
+	multiset<int>	myset;
+
+	// Sorted runs appended at end(), then hints right and wrong
+	for (int i = 0; i < 30; ++i)
+		myset.insert(myset.end(), i / 4);
+	myset.insert(myset.begin(), 0);
+	myset.insert(myset.find(3), 3);
+	myset.insert(myset.begin(), 5);
+	myset.insert(myset.end(), -1);
+	print(myset);
+
+	// Erase some of the equal elements, then look them up
+	myset.erase(myset.find(2));
+	myset.erase(--myset.upper_bound(4));
+	myset.erase(6);
+	for (int k = -1; k <= 8; ++k)
+	{
+		pair<multiset<int>::iterator, multiset<int>::iterator> ret = myset.equal_range(k);
+
+		cout << k << ": " << myset.count(k) << " from ";
+		if (ret.first == myset.end())
+			cout << "end";
+		else
+			cout << *ret.first;
+		cout << " to ";
+		if (ret.second == myset.end())
+			cout << "end";
+		else
+			cout << *ret.second;
+		cout << '\n';
+	}
+	return (0);
+}
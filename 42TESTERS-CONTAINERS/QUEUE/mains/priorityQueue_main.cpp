@@ -0,0 +1,65 @@
+/*
+** priorityQueue_main.cpp
+** A max-heap and a min-heap priority_queue of ints, and one of strings
+*/
+
+#include "QUEUE_UC.HPP"
+#include "test_utils.hpp"
+#include <queue>
+#include <string>
+#include <functional>
+
+#ifndef STD
+# define NAMESPACE ft
+#else
+# define NAMESPACE std
+#endif
+
+using namespace NAMESPACE;
+
+template <class T, class C, class Compare>
+void	print(priority_queue<T, C, Compare>& q)
+{
+	cout << "size: " << q.size() << '\n';
+	while (!q.empty())
+	{
+		cout << q.top() << ' ';
+		q.pop();
+	}
+	cout << '\n';
+}
+
+int main()
+{
+	priority_queue<int>										max_heap;
+	priority_queue<int, vector<int>, std::greater<int> >	min_heap;
+
+	cout << std::boolalpha << max_heap.empty() << '\n';
+	for (int i = 0; i < 100; ++i)
+	{
+		max_heap.push((i * 31) % 97);
+		min_heap.push((i * 31) % 97);
+	}
+	cout << max_heap.top() << ' ' << min_heap.top() << '\n';
+	for (int i = 0; i < 60; ++i)
+	{
+		max_heap.pop();
+		min_heap.pop();
+	}
+	max_heap.push(1000);
+	min_heap.push(-1000);
+	cout << max_heap.top() << ' ' << min_heap.top() << '\n';
+	print(max_heap);
+	print(min_heap);
+
+	priority_queue<std::string>	str_heap;
+
+	str_heap.push("8.5");
+	str_heap.push("42.4242");
+	str_heap.push("78541.987");
+	str_heap.push("salut");
+	str_heap.pop();
+	str_heap.push("tu vas bien?");
+	print(str_heap);
+	return (0);
+}
@@ -46,7 +46,35 @@ namespace ft {
 				return false;
 		}
 		return (first1 == last1) && (first2 != last2);
-	}	
+	}
+
+
+	/*************************************************************
+	 * COPY, COPY_BACKWARD and FILL
+	*************************************************************/
+	template<class InputIt, class OutputIt>
+	OutputIt copy(InputIt first, InputIt last, OutputIt result)
+	{
+		for (; first != last; ++first, ++result)
+			*result = *first;
+		return result;
+	}
+
+	// Copies from the end, for ranges that overlap the end of the source
+	template<class BidirIt1, class BidirIt2>
+	BidirIt2 copy_backward(BidirIt1 first, BidirIt1 last, BidirIt2 result)
+	{
+		while (first != last)
+			*--result = *--last;
+		return result;
+	}
+
+	template<class ForwardIt, class T>
+	void fill(ForwardIt first, ForwardIt last, const T& value)
+	{
+		for (; first != last; ++first)
+			*first = value;
+	}
 
 } // namespace ft
 
@@ -0,0 +1,92 @@
+#ifndef _FT_ATOMIC_HPP
+#define _FT_ATOMIC_HPP
+
+/*************************************************************
+ * Atomic operations on a single word
+
+ * C++98 has no std::atomic: these wrap the __atomic builtins of GCC
+	and clang, for the reference counts and flags shared between
+	threads. Loads acquire, stores release, and read-modify-writes
+	do both. atomic_thread_fence() is a full fence, which also keeps
+	a store from moving after a later load.
+ * Without the builtins they fall back to plain accesses, which are
+	only correct in a single thread.
+*************************************************************/
+
+namespace ft
+{
+#if defined(__GNUC__) || defined(__clang__)
+
+	template <typename T>
+	inline T atomic_load(const T *p)
+	{ return __atomic_load_n(p, __ATOMIC_ACQUIRE); }
+
+	template <typename T>
+	inline void atomic_store(T *p, T v)
+	{ __atomic_store_n(p, v, __ATOMIC_RELEASE); }
+
+	// Both return the value before the operation
+	template <typename T>
+	inline T atomic_fetch_add(T *p, T v)
+	{ return __atomic_fetch_add(p, v, __ATOMIC_ACQ_REL); }
+
+	template <typename T>
+	inline T atomic_fetch_sub(T *p, T v)
+	{ return __atomic_fetch_sub(p, v, __ATOMIC_ACQ_REL); }
+
+	// Stores desired if *p holds expected. Otherwise loads *p into
+	// expected. True if desired was stored.
+	template <typename T>
+	inline bool atomic_compare_exchange(T *p, T &expected, T desired)
+	{
+		return __atomic_compare_exchange_n(p, &expected, desired, false,
+										   __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE);
+	}
+
+	inline void atomic_thread_fence() { __atomic_thread_fence(__ATOMIC_SEQ_CST); }
+
+#else
+
+	template <typename T>
+	inline T atomic_load(const T *p) { return *p; }
+
+	template <typename T>
+	inline void atomic_store(T *p, T v) { *p = v; }
+
+	template <typename T>
+	inline T atomic_fetch_add(T *p, T v)
+	{
+		const T old = *p;
+
+		*p = old + v;
+		return old;
+	}
+
+	template <typename T>
+	inline T atomic_fetch_sub(T *p, T v)
+	{
+		const T old = *p;
+
+		*p = old - v;
+		return old;
+	}
+
+	template <typename T>
+	inline bool atomic_compare_exchange(T *p, T &expected, T desired)
+	{
+		if (*p != expected)
+		{
+			expected = *p;
+			return false;
+		}
+		*p = desired;
+		return true;
+	}
+
+	inline void atomic_thread_fence() {}
+
+#endif
+
+} // namespace ft
+
+#endif /* _FT_ATOMIC_HPP */
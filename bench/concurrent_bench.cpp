@@ -0,0 +1,168 @@
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <cstdlib>
+#include <stdint.h>
+#include <pthread.h>
+#include <unistd.h>
+#include <sys/time.h>
+
+#include "map.hpp"
+#include "concurrent_map.hpp"
+
+/*************************************************************
+ * Compares an ft::map behind one mutex with an ft::concurrent_map,
+ * on 1, 2, 4... threads up to twice the number of processors. Each
+ * thread runs a mix of 90% lookups, 5% insertions and 5% erasures
+ * on 64-bit keys, drawn from twice as many keys as the map holds.
+
+ * Usage: concurrent_bench [number of keys] [operations per thread]
+*************************************************************/
+
+typedef ft::map<uint64_t, uint64_t>				map_type;
+typedef ft::concurrent_map<uint64_t, uint64_t>	concurrent_type;
+
+// Wall clock time: std::clock() adds up the time of all the threads
+static double now()
+{
+	struct timeval tv;
+
+	gettimeofday(&tv, 0);
+	return tv.tv_sec + tv.tv_usec / 1e6;
+}
+
+// xorshift64
+static uint64_t next_key(uint64_t &state)
+{
+	state ^= state << 13;
+	state ^= state >> 7;
+	state ^= state << 17;
+	return state;
+}
+
+struct locked_map
+{
+	locked_map() { pthread_mutex_init(&lock, 0); }
+	~locked_map() { pthread_mutex_destroy(&lock); }
+
+	bool find(uint64_t k, uint64_t &v)
+	{
+		pthread_mutex_lock(&lock);
+
+		map_type::const_iterator it = map.find(k);
+		const bool found = it != map.end();
+
+		if (found)
+			v = it->second;
+		pthread_mutex_unlock(&lock);
+		return found;
+	}
+
+	void insert(uint64_t k)
+	{
+		pthread_mutex_lock(&lock);
+		map.insert(ft::make_pair(k, k));
+		pthread_mutex_unlock(&lock);
+	}
+
+	void erase(uint64_t k)
+	{
+		pthread_mutex_lock(&lock);
+		map.erase(k);
+		pthread_mutex_unlock(&lock);
+	}
+
+	pthread_mutex_t	lock;
+	map_type		map;
+};
+
+struct sharded_map
+{
+	bool find(uint64_t k, uint64_t &v) { return map.find(k, v); }
+	void insert(uint64_t k) { map.insert(ft::make_pair(k, k)); }
+	void erase(uint64_t k) { map.erase(k); }
+
+	concurrent_type	map;
+};
+
+template <typename Map>
+struct worker
+{
+	Map			*map;
+	std::size_t	keys;
+	std::size_t	ops;
+	uint64_t	seed;
+	uint64_t	check;
+};
+
+template <typename Map>
+static void *work(void *arg)
+{
+	worker<Map>	&w = *static_cast<worker<Map> *>(arg);
+	uint64_t	state = w.seed;
+
+	for (std::size_t i = 0; i < w.ops; ++i)
+	{
+		const uint64_t r = next_key(state);
+		const uint64_t k = (r >> 8) % (w.keys * 2);
+		uint64_t v;
+
+		if ((r & 0xff) < 13)
+			w.map->insert(k);
+		else if ((r & 0xff) < 26)
+			w.map->erase(k);
+		else if (w.map->find(k, v))
+			w.check += v;
+	}
+	return 0;
+}
+
+template <typename Map>
+static void run(const char *name, std::size_t keys, std::size_t ops, unsigned threads)
+{
+	Map							map;
+	std::vector<pthread_t>		ids(threads);
+	std::vector<worker<Map> >	workers(threads);
+	uint64_t					check = 0;
+
+	for (std::size_t i = 0; i < keys * 2; i += 2)
+		map.insert(i);
+
+	const double start = now();
+
+	for (unsigned t = 0; t < threads; ++t)
+	{
+		worker<Map> w = { &map, keys, ops, 88172645463325252ULL + t * 7919, 0 };
+
+		workers[t] = w;
+		pthread_create(&ids[t], 0, &work<Map>, &workers[t]);
+	}
+	for (unsigned t = 0; t < threads; ++t)
+	{
+		pthread_join(ids[t], 0);
+		check += workers[t].check;
+	}
+
+	const double t = now() - start;
+
+	std::cout << std::left << std::setw(16) << name << std::right << std::setw(3)
+			  << threads << " threads" << std::fixed << std::setprecision(2)
+			  << std::setw(10) << ops * threads / t / 1e6 << " Mops/s   ("
+			  << check << ")" << std::endl;
+}
+
+int main(int argc, char **argv)
+{
+	const std::size_t	keys = argc > 1 ? std::strtoul(argv[1], 0, 10) : 1000000;
+	const std::size_t	ops = argc > 2 ? std::strtoul(argv[2], 0, 10) : 1000000;
+	const long			cpus = sysconf(_SC_NPROCESSORS_ONLN);
+	const unsigned		max_threads = cpus > 0 ? static_cast<unsigned>(cpus) * 2 : 2;
+
+	std::cout << keys << " keys, " << ops << " operations per thread" << std::endl;
+	for (unsigned threads = 1; threads <= max_threads; threads *= 2)
+	{
+		run<locked_map>("map + mutex", keys, ops, threads);
+		run<sharded_map>("concurrent_map", keys, ops, threads);
+	}
+	return 0;
+}
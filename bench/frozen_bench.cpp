@@ -0,0 +1,96 @@
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <cstdlib>
+#include <ctime>
+#include <stdint.h>
+
+#include "map.hpp"
+#include "frozen_map.hpp"
+
+/*************************************************************
+ * Compares lookups in ft::map and in ft::frozen_map, a frozen copy
+ * of the same map, on 64-bit keys.
+
+ * Usage: frozen_bench [number of keys]
+*************************************************************/
+
+static uint64_t	g_state = 88172645463325252ULL;
+
+// xorshift64
+static uint64_t next_key()
+{
+	g_state ^= g_state << 13;
+	g_state ^= g_state >> 7;
+	g_state ^= g_state << 17;
+	return g_state;
+}
+
+static double seconds_since(std::clock_t start)
+{ return double(std::clock() - start) / CLOCKS_PER_SEC; }
+
+static void print_result(const char *name, const char *op, double t, uint64_t check)
+{
+	std::cout << std::left << std::setw(12) << name << std::setw(14) << op
+			  << std::right << std::fixed << std::setprecision(3) << std::setw(8)
+			  << t << " s   (" << check << ")" << std::endl;
+}
+
+template <typename Map>
+void run(const char *name, const Map &m, const std::vector<uint64_t> &lookups)
+{
+	uint64_t check = 0;
+	std::clock_t start = std::clock();
+
+	for (std::size_t i = 0; i < lookups.size(); ++i)
+	{
+		typename Map::const_iterator it = m.find(lookups[i]);
+
+		if (it != m.end())
+			check += it->second;
+	}
+	print_result(name, "find", seconds_since(start), check);
+
+	check = 0;
+	start = std::clock();
+	for (std::size_t i = 0; i < lookups.size(); ++i)
+	{
+		typename Map::const_iterator it = m.lower_bound(lookups[i] + 1);
+
+		if (it != m.end())
+			check += it->second;
+	}
+	print_result(name, "lower_bound", seconds_since(start), check);
+
+	check = 0;
+	start = std::clock();
+	for (typename Map::const_iterator it = m.begin(); it != m.end(); ++it)
+		check += it->second;
+	print_result(name, "iterate", seconds_since(start), check);
+}
+
+int main(int argc, char **argv)
+{
+	const std::size_t n = argc > 1 ? std::strtoul(argv[1], 0, 10) : 1000000;
+	std::vector<uint64_t> keys;
+	std::vector<uint64_t> lookups;
+	ft::map<uint64_t, uint64_t> m;
+
+	for (std::size_t i = 0; i < n; ++i)
+	{
+		keys.push_back(next_key());
+		m.insert(ft::make_pair(keys.back(), i));
+	}
+	// Half of the lookups hit
+	for (std::size_t i = 0; i < n; ++i)
+		lookups.push_back(i % 2 ? keys[next_key() % n] : next_key());
+
+	std::clock_t start = std::clock();
+	const ft::frozen_map<uint64_t, uint64_t> f(m);
+
+	std::cout << n << " keys" << std::endl;
+	print_result("frozen_map", "build", seconds_since(start), f.size());
+	run("map", m, lookups);
+	run("frozen_map", f, lookups);
+	return 0;
+}
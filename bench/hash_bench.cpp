@@ -0,0 +1,93 @@
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <cstdlib>
+#include <ctime>
+#include <stdint.h>
+
+#include "map.hpp"
+#include "unordered_map.hpp"
+
+/*************************************************************
+ * Compares ft::map (red-black tree) and ft::unordered_map on 64-bit keys.
+
+ * Usage: hash_bench [number of keys]
+*************************************************************/
+
+static uint64_t	g_state = 88172645463325252ULL;
+
+// xorshift64, so that both containers see the same keys
+static uint64_t next_key()
+{
+	g_state ^= g_state << 13;
+	g_state ^= g_state >> 7;
+	g_state ^= g_state << 17;
+	return g_state;
+}
+
+static double seconds_since(std::clock_t start)
+{ return double(std::clock() - start) / CLOCKS_PER_SEC; }
+
+static void print_result(const char *name, const char *op, double t, uint64_t check)
+{
+	std::cout << std::left << std::setw(16) << name << std::setw(14) << op
+			  << std::right << std::fixed << std::setprecision(3) << std::setw(8)
+			  << t << " s   (" << check << ")" << std::endl;
+}
+
+template <typename Map>
+void run(const char *name, const std::vector<uint64_t> &keys,
+		 const std::vector<uint64_t> &lookups)
+{
+	Map m;
+	uint64_t check = 0;
+	std::clock_t start = std::clock();
+
+	for (std::size_t i = 0; i < keys.size(); ++i)
+		m.insert(ft::make_pair(keys[i], i));
+	print_result(name, "insert", seconds_since(start), m.size());
+
+	start = std::clock();
+	for (std::size_t i = 0; i < lookups.size(); ++i)
+	{
+		typename Map::const_iterator it = m.find(lookups[i]);
+
+		if (it != m.end())
+			check += it->second;
+	}
+	print_result(name, "find", seconds_since(start), check);
+
+	check = 0;
+	start = std::clock();
+	for (typename Map::const_iterator it = m.begin(); it != m.end(); ++it)
+		check += it->second;
+	print_result(name, "iterate", seconds_since(start), check);
+
+	start = std::clock();
+	for (std::size_t i = 0; i < keys.size(); i += 2)
+		m.erase(keys[i]);
+	print_result(name, "erase half", seconds_since(start), m.size());
+
+	start = std::clock();
+	for (std::size_t i = 0; i < keys.size(); i += 2)
+		m.insert(ft::make_pair(keys[i], i));
+	print_result(name, "reinsert", seconds_since(start), m.size());
+}
+
+int main(int argc, char **argv)
+{
+	const std::size_t n = argc > 1 ? std::strtoul(argv[1], 0, 10) : 1000000;
+	std::vector<uint64_t> keys;
+	std::vector<uint64_t> lookups;
+
+	for (std::size_t i = 0; i < n; ++i)
+		keys.push_back(next_key());
+	// Half of the lookups hit
+	for (std::size_t i = 0; i < n; ++i)
+		lookups.push_back(i % 2 ? keys[next_key() % n] : next_key());
+
+	std::cout << n << " keys" << std::endl;
+	run<ft::map<uint64_t, uint64_t> >("map", keys, lookups);
+	run<ft::unordered_map<uint64_t, uint64_t> >("unordered_map", keys, lookups);
+	return 0;
+}
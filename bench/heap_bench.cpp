@@ -0,0 +1,297 @@
+#include <iostream>
+#include <iomanip>
+#include <ctime>
+#include <cstdlib>
+#include <functional>
+#include <queue>
+#include <vector>
+#include <stdint.h>
+
+#include "multimap.hpp"
+#include "queue.hpp"
+
+/*************************************************************
+ * Timers: keeps n deadlines, and repeatedly pops the earliest one
+ * and pushes a later one, in an ft::multimap (deadline -> task), a
+ * std::priority_queue (binary heap), an ft::priority_queue (4-ary
+ * heap) and an ft::indexed_priority_queue.
+
+ * Rescheduling: pushes back the deadline of random timers, through
+ * the iterators of an ft::multimap, and through the handles of an
+ * ft::indexed_priority_queue and update().
+
+ * Dijkstra: shortest paths on a random graph of 10n nodes with 8 edges
+ * each, with an ft::priority_queue that skips the stale entries it
+ * pops, and with an ft::indexed_priority_queue and decrease_key().
+
+ * Usage: heap_bench [number of timers, up to 2^20] [operations]
+*************************************************************/
+
+typedef std::greater<uint64_t>	earliest;
+
+// xorshift64
+static uint64_t next_rand(uint64_t &state)
+{
+	state ^= state << 13;
+	state ^= state >> 7;
+	state ^= state << 17;
+	return state;
+}
+
+static void report(const char *name, std::clock_t start, uint64_t check)
+{
+	std::cout << std::left << std::setw(36) << name << std::right << std::fixed
+			  << std::setprecision(3) << std::setw(8)
+			  << double(std::clock() - start) / CLOCKS_PER_SEC << " s   ("
+			  << check << ")" << std::endl;
+}
+
+/*************************************************************
+ * Timers
+*************************************************************/
+static void timers_map(std::size_t n, std::size_t ops)
+{
+	ft::multimap<uint64_t, uint64_t>	timers;
+	uint64_t							state = 88172645463325252ULL;
+	uint64_t							check = 0;
+
+	for (std::size_t i = 0; i < n; ++i)
+		timers.insert(ft::make_pair(next_rand(state) % 1000000, uint64_t(i)));
+
+	const std::clock_t start = std::clock();
+
+	for (std::size_t i = 0; i < ops; ++i)
+	{
+		ft::multimap<uint64_t, uint64_t>::iterator first = timers.begin();
+		const uint64_t deadline = first->first;
+
+		check += deadline;
+		timers.erase(first);
+		timers.insert(ft::make_pair(deadline + next_rand(state) % 1000000, uint64_t(i)));
+	}
+	report("ft::multimap", start, check);
+}
+
+template <typename Queue>
+static void timers_heap(const char *name, std::size_t n, std::size_t ops)
+{
+	Queue		timers;
+	uint64_t	state = 88172645463325252ULL;
+	uint64_t	check = 0;
+
+	for (std::size_t i = 0; i < n; ++i)
+		timers.push(next_rand(state) % 1000000);
+
+	const std::clock_t start = std::clock();
+
+	for (std::size_t i = 0; i < ops; ++i)
+	{
+		const uint64_t deadline = timers.top();
+
+		check += deadline;
+		timers.pop();
+		timers.push(deadline + next_rand(state) % 1000000);
+	}
+	report(name, start, check);
+}
+
+// Pushes back the deadline of a random timer, as a connection that
+// resets its idle timeout, and pops the earliest one every 4th time.
+// The low 20 bits of a deadline are its timer, for ties to break the
+// same way in both.
+static void reschedule_map(std::size_t n, std::size_t ops)
+{
+	typedef ft::multimap<uint64_t, uint64_t>	map_type;
+
+	map_type					timers;
+	std::vector<map_type::iterator>	its(n);
+	uint64_t					state = 88172645463325252ULL;
+	uint64_t					check = 0;
+
+	for (std::size_t i = 0; i < n; ++i)
+		its[i] = timers.insert(ft::make_pair(next_rand(state) % 1000000 << 20 | i, uint64_t(i)));
+
+	const std::clock_t start = std::clock();
+
+	for (std::size_t i = 0; i < ops; ++i)
+	{
+		const std::size_t t = (i & 3) == 0 ? timers.begin()->second
+			: std::size_t(next_rand(state) % n);
+		const uint64_t deadline = its[t]->first;
+
+		check += deadline;
+		timers.erase(its[t]);
+		its[t] = timers.insert(ft::make_pair(
+			deadline + (next_rand(state) % 1000000 << 20), uint64_t(t)));
+	}
+	report("ft::multimap", start, check);
+}
+
+static void reschedule_indexed(std::size_t n, std::size_t ops)
+{
+	typedef ft::indexed_priority_queue<uint64_t, earliest>	queue_type;
+
+	queue_type	timers;
+	uint64_t	state = 88172645463325252ULL;
+	uint64_t	check = 0;
+
+	// Handles are given out from 0 to n - 1 to the first n elements
+	for (std::size_t i = 0; i < n; ++i)
+		timers.push(next_rand(state) % 1000000 << 20 | i);
+
+	const std::clock_t start = std::clock();
+
+	for (std::size_t i = 0; i < ops; ++i)
+	{
+		const queue_type::handle_type t = (i & 3) == 0 ? timers.top_handle()
+			: queue_type::handle_type(next_rand(state) % n);
+		const uint64_t deadline = timers.get(t);
+
+		check += deadline;
+		timers.update(t, deadline + (next_rand(state) % 1000000 << 20));
+	}
+	report("ft::indexed_priority_queue", start, check);
+}
+
+/*************************************************************
+ * Dijkstra
+*************************************************************/
+struct edge
+{
+	uint32_t	to;
+	uint32_t	weight;
+};
+
+struct graph
+{
+	explicit graph(std::size_t n) : edges(n * degree)
+	{
+		uint64_t state = 2463534242ULL;
+
+		for (std::size_t i = 0; i < edges.size(); ++i)
+		{
+			edges[i].to = uint32_t(next_rand(state) % n);
+			edges[i].weight = uint32_t(next_rand(state) % 1000 + 1);
+		}
+	}
+
+	std::size_t size() const { return edges.size() / degree; }
+
+	enum { degree = 8 };
+
+	std::vector<edge>	edges;
+};
+
+static uint64_t checksum(const std::vector<uint64_t> &dist)
+{
+	uint64_t sum = 0;
+
+	for (std::size_t i = 0; i < dist.size(); ++i)
+		if (dist[i] != uint64_t(-1))
+			sum += dist[i];
+	return sum;
+}
+
+// Entries pair a distance, in the high bits, with a node
+static void dijkstra_lazy(const graph &g)
+{
+	ft::priority_queue<uint64_t, ft::vector<uint64_t>, earliest>	queue;
+	std::vector<uint64_t>	dist(g.size(), uint64_t(-1));
+
+	const std::clock_t start = std::clock();
+
+	dist[0] = 0;
+	queue.push(0);
+	while (!queue.empty())
+	{
+		const uint64_t d = queue.top() >> 24;
+		const uint32_t u = uint32_t(queue.top() & 0xffffff);
+
+		queue.pop();
+		if (d != dist[u])
+			continue;
+		for (std::size_t e = u * graph::degree; e < (u + 1) * graph::degree; ++e)
+		{
+			const uint64_t nd = d + g.edges[e].weight;
+
+			if (nd < dist[g.edges[e].to])
+			{
+				dist[g.edges[e].to] = nd;
+				queue.push(nd << 24 | g.edges[e].to);
+			}
+		}
+	}
+	report("ft::priority_queue, stale entries", start, checksum(dist));
+}
+
+static void dijkstra_indexed(const graph &g)
+{
+	typedef ft::indexed_priority_queue<uint64_t, earliest>	queue_type;
+
+	queue_type				queue;
+	std::vector<uint64_t>	dist(g.size(), uint64_t(-1));
+	// Handle of each node in the queue
+	std::vector<queue_type::handle_type>	handle(g.size());
+	std::vector<uint32_t>	node;
+
+	const std::clock_t start = std::clock();
+
+	dist[0] = 0;
+	handle[0] = queue.push(0);
+	node.resize(handle[0] + 1);
+	node[handle[0]] = 0;
+	while (!queue.empty())
+	{
+		const uint64_t d = queue.top();
+		const uint32_t u = node[queue.top_handle()];
+
+		queue.pop();
+		for (std::size_t e = u * graph::degree; e < (u + 1) * graph::degree; ++e)
+		{
+			const uint32_t v = g.edges[e].to;
+			const uint64_t nd = d + g.edges[e].weight;
+
+			if (nd >= dist[v])
+				continue;
+			if (dist[v] == uint64_t(-1))
+			{
+				handle[v] = queue.push(nd);
+				if (node.size() <= handle[v])
+					node.resize(handle[v] + 1);
+				node[handle[v]] = v;
+			}
+			else
+				queue.decrease_key(handle[v], nd);
+			dist[v] = nd;
+		}
+	}
+	report("ft::indexed_priority_queue", start, checksum(dist));
+}
+
+int main(int argc, char **argv)
+{
+	const std::size_t	n = argc > 1 ? std::strtoul(argv[1], 0, 10) : 100000;
+	const std::size_t	ops = argc > 2 ? std::strtoul(argv[2], 0, 10) : 5000000;
+
+	std::cout << "Timers: " << n << " timers, " << ops << " pops and pushes" << std::endl;
+	timers_map(n, ops);
+	timers_heap<std::priority_queue<uint64_t, std::vector<uint64_t>, earliest> >(
+		"std::priority_queue (binary)", n, ops);
+	timers_heap<ft::priority_queue<uint64_t, ft::vector<uint64_t>, earliest> >(
+		"ft::priority_queue (4-ary)", n, ops);
+	timers_heap<ft::indexed_priority_queue<uint64_t, earliest> >(
+		"ft::indexed_priority_queue", n, ops);
+
+	std::cout << std::endl << "Rescheduling: " << n << " timers, " << ops
+			  << " deadlines pushed back" << std::endl;
+	reschedule_map(n, ops);
+	reschedule_indexed(n, ops);
+
+	const graph g(n * 10);
+
+	std::cout << std::endl << "Dijkstra: " << g.size() << " nodes, "
+			  << g.edges.size() << " edges" << std::endl;
+	dijkstra_lazy(g);
+	dijkstra_indexed(g);
+	return 0;
+}
@@ -0,0 +1,240 @@
+#include <iostream>
+#include <iomanip>
+#include <algorithm>
+#include <deque>
+#include <vector>
+#include <cstdlib>
+#include <stdint.h>
+#include <pthread.h>
+#include <sched.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "vector.hpp"
+#include "mpmc_queue.hpp"
+
+/*************************************************************
+ * Runs 1, 2, 4... producers and as many consumers, up to twice the
+ * number of processors, through a std::deque behind a mutex and two
+ * condition variables, an ft::mpmc_queue with its blocking push()
+ * and pop(), and an ft::mpmc_queue in batches, pushed with
+ * try_push_n() and drained into an ft::vector.
+ * Each value is the time it was pushed at: throughput counts the
+ * values popped per second, and latency is the time from push to
+ * pop, sampled on every 16th value.
+
+ * Usage: mpmc_bench [values per producer] [capacity] [batch size]
+*************************************************************/
+
+static uint64_t now_ns()
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return static_cast<uint64_t>(ts.tv_sec) * 1000000000ULL + ts.tv_nsec;
+}
+
+struct locked_deque
+{
+	explicit locked_deque(std::size_t capacity) : capacity(capacity)
+	{
+		pthread_mutex_init(&lock, 0);
+		pthread_cond_init(&not_empty, 0);
+		pthread_cond_init(&not_full, 0);
+	}
+
+	~locked_deque()
+	{
+		pthread_cond_destroy(&not_full);
+		pthread_cond_destroy(&not_empty);
+		pthread_mutex_destroy(&lock);
+	}
+
+	void push(uint64_t v)
+	{
+		pthread_mutex_lock(&lock);
+		while (queue.size() >= capacity)
+			pthread_cond_wait(&not_full, &lock);
+		queue.push_back(v);
+		pthread_cond_signal(&not_empty);
+		pthread_mutex_unlock(&lock);
+	}
+
+	void pop(uint64_t &v)
+	{
+		pthread_mutex_lock(&lock);
+		while (queue.empty())
+			pthread_cond_wait(&not_empty, &lock);
+		v = queue.front();
+		queue.pop_front();
+		pthread_cond_signal(&not_full);
+		pthread_mutex_unlock(&lock);
+	}
+
+	std::size_t				capacity;
+	pthread_mutex_t			lock;
+	pthread_cond_t			not_empty;
+	pthread_cond_t			not_full;
+	std::deque<uint64_t>	queue;
+};
+
+struct blocking
+{
+	explicit blocking(std::size_t capacity) : queue(capacity) {}
+
+	void push(uint64_t v) { queue.push(v); }
+	void pop(uint64_t &v) { queue.pop(v); }
+
+	ft::mpmc_queue<uint64_t>	queue;
+};
+
+struct batches
+{
+	explicit batches(std::size_t capacity) : queue(capacity) {}
+
+	ft::mpmc_queue<uint64_t>	queue;
+};
+
+template <typename Queue>
+struct worker
+{
+	Queue					*queue;
+	std::size_t				count;
+	std::size_t				batch;
+	std::vector<uint64_t>	latencies;
+};
+
+template <typename Queue>
+static void *produce(void *arg)
+{
+	worker<Queue> &w = *static_cast<worker<Queue> *>(arg);
+
+	for (std::size_t i = 0; i < w.count; ++i)
+		w.queue->push(now_ns());
+	return 0;
+}
+
+template <typename Queue>
+static void *consume(void *arg)
+{
+	worker<Queue> &w = *static_cast<worker<Queue> *>(arg);
+	uint64_t v;
+
+	for (std::size_t i = 0; i < w.count; ++i)
+	{
+		w.queue->pop(v);
+		if ((i & 15) == 0)
+			w.latencies.push_back(now_ns() - v);
+	}
+	return 0;
+}
+
+static void *produce_batches(void *arg)
+{
+	worker<batches> &w = *static_cast<worker<batches> *>(arg);
+	std::vector<uint64_t> batch(w.batch);
+
+	for (std::size_t i = 0; i < w.count;)
+	{
+		const std::size_t n = std::min(w.batch, w.count - i);
+
+		std::fill(batch.begin(), batch.begin() + n, now_ns());
+		for (std::size_t done = 0; done < n;)
+		{
+			const std::size_t pushed
+				= w.queue->queue.try_push_n(batch.begin() + done, n - done);
+
+			if (pushed == 0)
+				sched_yield();
+			done += pushed;
+		}
+		i += n;
+	}
+	return 0;
+}
+
+static void *consume_batches(void *arg)
+{
+	worker<batches> &w = *static_cast<worker<batches> *>(arg);
+	ft::vector<uint64_t> batch;
+
+	batch.reserve(w.batch);
+	for (std::size_t i = 0; i < w.count;)
+	{
+		batch.clear();
+
+		const std::size_t n = w.queue->queue.drain(batch, std::min(w.batch, w.count - i));
+
+		if (n == 0)
+			sched_yield();
+		else
+		{
+			const uint64_t t = now_ns();
+
+			for (std::size_t j = 0; j < n; ++j)
+				if (((i + j) & 15) == 0)
+					w.latencies.push_back(t - batch[j]);
+		}
+		i += n;
+	}
+	return 0;
+}
+
+template <typename Queue>
+static void run(const char *name, std::size_t count, std::size_t capacity,
+				std::size_t batch, unsigned threads,
+				void *(*producer)(void *), void *(*consumer)(void *))
+{
+	Queue						queue(capacity);
+	std::vector<pthread_t>		ids(threads * 2);
+	std::vector<worker<Queue> >	workers(threads * 2);
+	std::vector<uint64_t>		latencies;
+
+	const uint64_t start = now_ns();
+
+	for (unsigned t = 0; t < threads * 2; ++t)
+	{
+		workers[t].queue = &queue;
+		workers[t].count = count;
+		workers[t].batch = batch;
+		pthread_create(&ids[t], 0, t < threads ? producer : consumer, &workers[t]);
+	}
+	for (unsigned t = 0; t < threads * 2; ++t)
+	{
+		pthread_join(ids[t], 0);
+		latencies.insert(latencies.end(), workers[t].latencies.begin(),
+						 workers[t].latencies.end());
+	}
+
+	const double seconds = (now_ns() - start) / 1e9;
+
+	std::sort(latencies.begin(), latencies.end());
+	std::cout << std::left << std::setw(20) << name << std::right << std::setw(3)
+			  << threads << " x " << threads << std::fixed << std::setprecision(2)
+			  << std::setw(10) << count * threads / seconds / 1e6 << " Mvalues/s"
+			  << "   latency p50 " << std::setw(9) << latencies[latencies.size() / 2]
+			  << " ns, p99 " << std::setw(10) << latencies[latencies.size() * 99 / 100]
+			  << " ns" << std::endl;
+}
+
+int main(int argc, char **argv)
+{
+	const std::size_t	count = argc > 1 ? std::strtoul(argv[1], 0, 10) : 1000000;
+	const std::size_t	capacity = argc > 2 ? std::strtoul(argv[2], 0, 10) : 1024;
+	const std::size_t	batch = argc > 3 ? std::strtoul(argv[3], 0, 10) : 64;
+	const long			cpus = sysconf(_SC_NPROCESSORS_ONLN);
+	const unsigned		max_threads = cpus > 0 ? static_cast<unsigned>(cpus) * 2 : 2;
+
+	std::cout << count << " values per producer, capacity " << capacity
+			  << ", batches of " << batch << std::endl;
+	for (unsigned threads = 1; threads <= max_threads; threads *= 2)
+	{
+		run<locked_deque>("std::deque + mutex", count, capacity, 1, threads,
+						  &produce<locked_deque>, &consume<locked_deque>);
+		run<blocking>("mpmc_queue", count, capacity, 1, threads,
+					  &produce<blocking>, &consume<blocking>);
+		run<batches>("mpmc_queue batches", count, capacity, batch, threads,
+					 &produce_batches, &consume_batches);
+	}
+	return 0;
+}
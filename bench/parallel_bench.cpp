@@ -0,0 +1,90 @@
+#include <iostream>
+#include <iomanip>
+#include <cstdlib>
+#include <stdint.h>
+#include <sys/time.h>
+
+#include "set.hpp"
+#include "parallel.hpp"
+
+/*************************************************************
+ * Compares the set algebra of ft::set on one thread (union_with,
+ * intersect_with, difference_with) and on several (parallel_union,
+ * parallel_intersection, parallel_difference), on two sets of n
+ * 64-bit keys that share about half of their keys.
+
+ * Usage: parallel_bench [number of keys] [number of threads]
+*************************************************************/
+
+typedef ft::set<uint64_t>	set_type;
+
+static uint64_t	g_state = 88172645463325252ULL;
+
+// xorshift64
+static uint64_t next_key()
+{
+	g_state ^= g_state << 13;
+	g_state ^= g_state >> 7;
+	g_state ^= g_state << 17;
+	return g_state;
+}
+
+// Wall clock time: std::clock() adds up the time of all the threads
+static double now()
+{
+	struct timeval tv;
+
+	gettimeofday(&tv, 0);
+	return tv.tv_sec + tv.tv_usec / 1e6;
+}
+
+static void print_result(const char *op, const char *how, double t, std::size_t size)
+{
+	std::cout << std::left << std::setw(14) << op << std::setw(12) << how
+			  << std::right << std::fixed << std::setprecision(3) << std::setw(8)
+			  << t << " s   (" << size << ")" << std::endl;
+}
+
+// Keys below n * 2 in x, and from n to n * 3 in y, mixed to spread them
+static void fill(set_type &x, set_type &y, std::size_t n)
+{
+	for (std::size_t i = 0; i < n; ++i)
+	{
+		x.insert((next_key() % (n * 2)) * 0x9E3779B97F4A7C15ULL);
+		y.insert((n + next_key() % (n * 2)) * 0x9E3779B97F4A7C15ULL);
+	}
+}
+
+static void run(const char *op, int which, std::size_t n, unsigned threads)
+{
+	for (int parallel = 0; parallel < 2; ++parallel)
+	{
+		set_type x;
+		set_type y;
+
+		g_state = 88172645463325252ULL;
+		fill(x, y, n);
+
+		const double start = now();
+
+		if (which == 0)
+			parallel ? ft::parallel_union(x, y, threads) : x.union_with(y);
+		else if (which == 1)
+			parallel ? ft::parallel_intersection(x, y, threads) : x.intersect_with(y);
+		else
+			parallel ? ft::parallel_difference(x, y, threads) : x.difference_with(y);
+		print_result(op, parallel ? "parallel" : "sequential", now() - start, x.size());
+	}
+}
+
+int main(int argc, char **argv)
+{
+	const std::size_t n = argc > 1 ? std::strtoul(argv[1], 0, 10) : 1000000;
+	const unsigned threads = argc > 2 ? std::strtoul(argv[2], 0, 10) : 0;
+
+	std::cout << n << " keys in each set" << std::endl;
+	run("union", 0, n, threads);
+	run("intersection", 1, n, threads);
+	run("difference", 2, n, threads);
+	return 0;
+}
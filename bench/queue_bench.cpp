@@ -0,0 +1,203 @@
+#include <iostream>
+#include <iomanip>
+#include <deque>
+#include <vector>
+#include <cstdlib>
+#include <stdint.h>
+#include <pthread.h>
+#include <sched.h>
+#include <sys/time.h>
+
+#include "spsc_queue.hpp"
+
+/*************************************************************
+ * Hands 64-bit values from a producer thread to a consumer thread,
+ * through a std::deque behind a mutex, an ft::spsc_queue one value
+ * at a time, and an ft::spsc_queue in batches of push_n()/pop_n().
+ * A side that finds the queue full (or empty) yields its processor.
+
+ * Usage: queue_bench [number of values] [capacity] [batch size]
+*************************************************************/
+
+// Wall clock time: std::clock() adds up the time of all the threads
+static double now()
+{
+	struct timeval tv;
+
+	gettimeofday(&tv, 0);
+	return tv.tv_sec + tv.tv_usec / 1e6;
+}
+
+struct locked_deque
+{
+	explicit locked_deque(std::size_t capacity) : capacity(capacity)
+	{ pthread_mutex_init(&lock, 0); }
+
+	~locked_deque() { pthread_mutex_destroy(&lock); }
+
+	bool push(uint64_t v)
+	{
+		pthread_mutex_lock(&lock);
+
+		const bool room = queue.size() < capacity;
+
+		if (room)
+			queue.push_back(v);
+		pthread_mutex_unlock(&lock);
+		return room;
+	}
+
+	bool pop(uint64_t &v)
+	{
+		pthread_mutex_lock(&lock);
+
+		const bool found = !queue.empty();
+
+		if (found)
+		{
+			v = queue.front();
+			queue.pop_front();
+		}
+		pthread_mutex_unlock(&lock);
+		return found;
+	}
+
+	std::size_t				capacity;
+	pthread_mutex_t			lock;
+	std::deque<uint64_t>	queue;
+};
+
+struct single
+{
+	explicit single(std::size_t capacity) : queue(capacity) {}
+
+	bool push(uint64_t v) { return queue.push(v); }
+	bool pop(uint64_t &v) { return queue.pop(v); }
+
+	ft::spsc_queue<uint64_t>	queue;
+};
+
+template <typename Queue>
+struct worker
+{
+	Queue		*queue;
+	std::size_t	count;
+	std::size_t	batch;
+	uint64_t	check;
+};
+
+template <typename Queue>
+static void *produce(void *arg)
+{
+	worker<Queue> &w = *static_cast<worker<Queue> *>(arg);
+
+	for (uint64_t i = 0; i < w.count;)
+	{
+		if (w.queue->push(i))
+			++i;
+		else
+			sched_yield();
+	}
+	return 0;
+}
+
+template <typename Queue>
+static void *consume(void *arg)
+{
+	worker<Queue> &w = *static_cast<worker<Queue> *>(arg);
+	uint64_t v;
+
+	for (std::size_t i = 0; i < w.count;)
+	{
+		if (w.queue->pop(v))
+		{
+			w.check += v;
+			++i;
+		}
+		else
+			sched_yield();
+	}
+	return 0;
+}
+
+static void *produce_batches(void *arg)
+{
+	worker<single> &w = *static_cast<worker<single> *>(arg);
+	std::vector<uint64_t> batch(w.batch);
+
+	for (uint64_t i = 0; i < w.count;)
+	{
+		std::size_t n = 0;
+
+		for (; n < batch.size() && i + n < w.count; ++n)
+			batch[n] = i + n;
+		for (std::size_t done = 0; done < n;)
+		{
+			const std::size_t pushed = w.queue->queue.push_n(batch.begin() + done, n - done);
+
+			if (pushed == 0)
+				sched_yield();
+			done += pushed;
+		}
+		i += n;
+	}
+	return 0;
+}
+
+static void *consume_batches(void *arg)
+{
+	worker<single> &w = *static_cast<worker<single> *>(arg);
+	std::vector<uint64_t> batch(w.batch);
+
+	for (std::size_t i = 0; i < w.count;)
+	{
+		const std::size_t n = w.queue->queue.pop_n(batch.begin(), batch.size());
+
+		if (n == 0)
+			sched_yield();
+		for (std::size_t j = 0; j < n; ++j)
+			w.check += batch[j];
+		i += n;
+	}
+	return 0;
+}
+
+template <typename Queue>
+static void run(const char *name, std::size_t count, std::size_t capacity,
+				std::size_t batch, void *(*producer)(void *), void *(*consumer)(void *))
+{
+	Queue			queue(capacity);
+	worker<Queue>	p = { &queue, count, batch, 0 };
+	worker<Queue>	c = { &queue, count, batch, 0 };
+	pthread_t		ids[2];
+
+	const double start = now();
+
+	pthread_create(&ids[0], 0, producer, &p);
+	pthread_create(&ids[1], 0, consumer, &c);
+	pthread_join(ids[0], 0);
+	pthread_join(ids[1], 0);
+
+	const double t = now() - start;
+
+	std::cout << std::left << std::setw(24) << name << std::right << std::fixed
+			  << std::setprecision(2) << std::setw(10) << count / t / 1e6
+			  << " Mvalues/s   (" << c.check << ")" << std::endl;
+}
+
+int main(int argc, char **argv)
+{
+	const std::size_t	count = argc > 1 ? std::strtoul(argv[1], 0, 10) : 10000000;
+	const std::size_t	capacity = argc > 2 ? std::strtoul(argv[2], 0, 10) : 1024;
+	const std::size_t	batch = argc > 3 ? std::strtoul(argv[3], 0, 10) : 64;
+
+	std::cout << count << " values, capacity " << capacity << ", batches of "
+			  << batch << std::endl;
+	run<locked_deque>("std::deque + mutex", count, capacity, 1,
+					  &produce<locked_deque>, &consume<locked_deque>);
+	run<single>("spsc_queue", count, capacity, 1,
+				&produce<single>, &consume<single>);
+	run<single>("spsc_queue push_n/pop_n", count, capacity, batch,
+				&produce_batches, &consume_batches);
+	return 0;
+}
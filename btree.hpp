@@ -0,0 +1,978 @@
+#ifndef _FT_BTREE_HPP
+#define _FT_BTREE_HPP
+
+#include <memory>
+#include <cstring>
+
+#include "algorithm.hpp"
+#include "iterator.hpp"
+#include "type_traits.hpp"
+#include "utility.hpp"
+
+/*************************************************************
+ * A B-Tree implementation.
+
+ * Designed for use in implementing cache friendly associative
+	containers (btree_map and btree_set), with the same interface
+	as rb_tree.
+
+ * Every node stores up to node_slots sorted values, as many as fit in
+	target_node_size bytes, so that a lookup reads a few consecutive
+	cache lines per level instead of one node per comparison.
+	Internal nodes also hold node_slots + 1 children, and all the
+	leaves are on the same level.
+
+ * Values move from node to node when the tree is rebalanced, so
+	insert and erase invalidate all iterators. Copying a value must
+	not throw while the tree moves it.
+*************************************************************/
+
+namespace ft
+{
+	/*************************************************************
+	 * B-Tree class
+	 *************************************************************/
+	template <typename Key, typename Val, typename KeyOfValue,
+			  typename Compare, typename Alloc = std::allocator<Val> >
+	class btree
+	{
+
+	public:
+		typedef Key					key_type;
+		typedef Val					value_type;
+		typedef value_type			*pointer;
+		typedef const value_type	*const_pointer;
+		typedef value_type			&reference;
+		typedef const value_type	&const_reference;
+		typedef std::size_t			size_type;
+		typedef std::ptrdiff_t		difference_type;
+		typedef Alloc				allocator_type;
+
+		static const size_type		target_node_size = 256;
+
+	private:
+		struct internal_node;
+
+		/*************************************************************
+		 * Nodes
+
+		 * A leaf is a header followed by its values; an internal node
+			adds the pointers to its children.
+		 *************************************************************/
+		struct node_header
+		{
+			internal_node	*parent;
+			unsigned short	position; // Index of the node among its siblings
+			unsigned short	count;	  // Number of values
+			bool			leaf;
+		};
+
+		enum
+		{
+			slots_in_target = (target_node_size - sizeof(node_header)) / sizeof(Val),
+			node_slots = slots_in_target < 3 ? 3 : slots_in_target,
+			min_slots = node_slots / 2
+		};
+
+		struct node : public node_header
+		{
+			union
+			{
+				char		bytes[node_slots * sizeof(Val)];
+				long double	_align_ld;
+				long long	_align_ll;
+				void		*_align_ptr;
+			} storage;
+
+			Val *values() { return reinterpret_cast<Val *>(storage.bytes); }
+
+			const Val *values() const
+			{ return reinterpret_cast<const Val *>(storage.bytes); }
+		};
+
+		struct internal_node : public node
+		{
+			node *children[node_slots + 1];
+		};
+
+		static node *child(const node *n, int i)
+		{ return static_cast<const internal_node *>(n)->children[i]; }
+
+		static const Key &key(const node *n, int i)
+		{ return KeyOfValue()(n->values()[i]); }
+
+		/*************************************************************
+		 * B-Tree iterator
+
+		 * A node and the index of a value in it. end() is one past the
+			last value of the rightmost leaf.
+		 *************************************************************/
+		template <typename Ref, typename Ptr>
+		struct btree_iterator
+		{
+			/*************************************************************
+			 * Types
+			 *************************************************************/
+			typedef std::ptrdiff_t					difference_type;
+			typedef Val								value_type;
+			typedef Ptr								pointer;
+			typedef Ref								reference;
+			typedef std::bidirectional_iterator_tag	iterator_category;
+
+			typedef btree_iterator<Val &, Val *>	iterator;
+			typedef btree_iterator<Ref, Ptr>		self;
+
+			/*************************************************************
+			 * Construct/Copy/Destroy
+			 *************************************************************/
+			btree_iterator() : _node(0), _position(0) {}
+
+			btree_iterator(node *n, int position)
+				: _node(n), _position(position) {}
+
+			btree_iterator(const iterator &it)
+				: _node(it._node), _position(it._position) {}
+
+			/*************************************************************
+			 * Operators
+			 *************************************************************/
+			reference operator*() const { return _node->values()[_position]; }
+
+			pointer operator->() const { return &_node->values()[_position]; }
+
+			self &operator++()
+			{
+				increment();
+				return *this;
+			}
+
+			self operator++(int)
+			{
+				self tmp = *this;
+				increment();
+				return tmp;
+			}
+
+			self &operator--()
+			{
+				decrement();
+				return *this;
+			}
+
+			self operator--(int)
+			{
+				self tmp = *this;
+				decrement();
+				return tmp;
+			}
+
+			friend bool operator==(const self &x, const self &y)
+			{ return x._node == y._node && x._position == y._position; }
+
+			friend bool operator!=(const self &x, const self &y)
+			{ return !(x == y); }
+
+			node	*_node;
+			int		_position;
+
+		private:
+			void increment()
+			{
+				if (!_node->leaf)
+				{
+					// The next value is the first one of the right subtree
+					node *n = child(_node, _position + 1);
+
+					while (!n->leaf)
+						n = child(n, 0);
+					_node = n;
+					_position = 0;
+				}
+				else if (++_position == _node->count)
+				{
+					// Go up until the subtree we leave has a value after it.
+					// If there is none, stay at end().
+					node *n = _node;
+					int pos = _position;
+
+					while (pos == n->count && n->parent != 0)
+					{
+						pos = n->position;
+						n = n->parent;
+					}
+					if (pos < n->count)
+					{
+						_node = n;
+						_position = pos;
+					}
+				}
+			}
+
+			void decrement()
+			{
+				if (!_node->leaf)
+				{
+					// The previous value is the last one of the left subtree
+					node *n = child(_node, _position);
+
+					while (!n->leaf)
+						n = child(n, n->count);
+					_node = n;
+					_position = n->count - 1;
+				}
+				else if (--_position < 0)
+				{
+					node *n = _node;
+					int pos = _position;
+
+					while (pos < 0 && n->parent != 0)
+					{
+						pos = n->position - 1;
+						n = n->parent;
+					}
+					if (pos >= 0)
+					{
+						_node = n;
+						_position = pos;
+					}
+				}
+			}
+		}; // btree_iterator
+
+	public:
+		typedef btree_iterator<Val &, Val *>				iterator;
+		typedef btree_iterator<const Val &, const Val *>	const_iterator;
+
+		typedef ft::reverse_iterator<iterator>			reverse_iterator;
+		typedef ft::reverse_iterator<const_iterator>	const_reverse_iterator;
+
+	private:
+		typedef typename Alloc::template rebind<node>::other			leaf_allocator;
+		typedef typename Alloc::template rebind<internal_node>::other	internal_allocator;
+
+		// Values are moved between nodes with memmove when they can be
+		typedef ft::integral_constant<bool,
+			ft::is_trivially_relocatable<Val>::value
+			&& ft::is_same<Alloc, std::allocator<Val> >::value>	trivial_relocate;
+
+		Compare				_key_compare;
+		allocator_type		_alloc;
+		leaf_allocator		_leaf_alloc;
+		internal_allocator	_internal_alloc;
+		node				*_root;
+		node				*_leftmost;  // First leaf, for begin()
+		node				*_rightmost; // Last leaf, for end()
+		size_type			_size;
+
+	public:
+		/*************************************************************
+		 * Construct/Copy/Destroy
+		 *************************************************************/
+		btree()
+			: _key_compare(), _alloc(), _leaf_alloc(), _internal_alloc(),
+			  _root(0), _leftmost(0), _rightmost(0), _size(0) {}
+
+		btree(const Compare &comp, const allocator_type &a = allocator_type())
+			: _key_compare(comp), _alloc(a), _leaf_alloc(a), _internal_alloc(a),
+			  _root(0), _leftmost(0), _rightmost(0), _size(0) {}
+
+		btree(const btree &x)
+			: _key_compare(x._key_compare), _alloc(x._alloc),
+			  _leaf_alloc(x._leaf_alloc), _internal_alloc(x._internal_alloc),
+			  _root(0), _leftmost(0), _rightmost(0), _size(0)
+		{ copy(x); }
+
+		~btree() { clear(); }
+
+		btree &operator=(const btree &x)
+		{
+			if (this != &x)
+			{
+				clear();
+				_key_compare = x._key_compare;
+				copy(x);
+			}
+			return *this;
+		}
+
+		// Accessors.
+		Compare key_comp() const { return _key_compare; }
+
+		allocator_type get_allocator() const { return _alloc; }
+
+		iterator begin() { return iterator(_leftmost, 0); }
+
+		const_iterator begin() const { return const_iterator(_leftmost, 0); }
+
+		iterator end()
+		{ return iterator(_rightmost, _rightmost ? _rightmost->count : 0); }
+
+		const_iterator end() const
+		{ return const_iterator(_rightmost, _rightmost ? _rightmost->count : 0); }
+
+		reverse_iterator rbegin() { return reverse_iterator(end()); }
+
+		const_reverse_iterator rbegin() const
+		{ return const_reverse_iterator(end()); }
+
+		reverse_iterator rend() { return reverse_iterator(begin()); }
+
+		const_reverse_iterator rend() const
+		{ return const_reverse_iterator(begin()); }
+
+		bool empty() const { return _size == 0; }
+
+		size_type size() const { return _size; }
+
+		size_type max_size() const { return _alloc.max_size(); }
+
+		void swap(btree &x)
+		{
+			ft::swap(_key_compare, x._key_compare);
+			ft::swap(_alloc, x._alloc);
+			ft::swap(_leaf_alloc, x._leaf_alloc);
+			ft::swap(_internal_alloc, x._internal_alloc);
+			ft::swap(_root, x._root);
+			ft::swap(_leftmost, x._leftmost);
+			ft::swap(_rightmost, x._rightmost);
+			ft::swap(_size, x._size);
+		}
+
+		// Insert.
+		pair<iterator, bool> insert_unique(const value_type &v);
+
+		iterator insert_unique(const_iterator hint, const value_type &v);
+
+		// Hinted at end(), a sorted range is inserted in linear time
+		template <typename _InputIterator>
+		void insert_range_unique(_InputIterator first, _InputIterator last)
+		{
+			for (; first != last; ++first)
+				insert_unique(end(), *first);
+		}
+
+		template <typename _InputIterator>
+		void insert_range_unique(ft::sorted_unique_t,
+								 _InputIterator first, _InputIterator last)
+		{ insert_range_unique(first, last); }
+
+		// Erase.
+		void erase(const_iterator position);
+
+		size_type erase(const key_type &k);
+
+		void erase(const_iterator first, const_iterator last);
+
+		void clear()
+		{
+			if (_root != 0)
+				destroy_subtree(_root);
+			_root = 0;
+			_leftmost = 0;
+			_rightmost = 0;
+			_size = 0;
+		}
+
+		// Set operations.
+		iterator find(const key_type &k)
+		{
+			iterator j = lower_bound(k);
+
+			return (j == end() || _key_compare(k, KeyOfValue()(*j))) ? end() : j;
+		}
+
+		const_iterator find(const key_type &k) const
+		{
+			const_iterator j = lower_bound(k);
+
+			return (j == end() || _key_compare(k, KeyOfValue()(*j))) ? end() : j;
+		}
+
+		size_type count(const key_type &k) const
+		{ return find(k) == end() ? 0 : 1; }
+
+		iterator lower_bound(const key_type &k) { return bound(k, false); }
+
+		const_iterator lower_bound(const key_type &k) const
+		{ return bound(k, false); }
+
+		iterator upper_bound(const key_type &k) { return bound(k, true); }
+
+		const_iterator upper_bound(const key_type &k) const
+		{ return bound(k, true); }
+
+		pair<iterator, iterator> equal_range(const key_type &k)
+		{ return pair<iterator, iterator>(lower_bound(k), upper_bound(k)); }
+
+		pair<const_iterator, const_iterator>
+		equal_range(const key_type &k) const
+		{
+			return pair<const_iterator, const_iterator>(lower_bound(k),
+														upper_bound(k));
+		}
+
+		friend bool operator==(const btree &x, const btree &y)
+		{
+			return x.size() == y.size()
+				&& ft::equal(x.begin(), x.end(), y.begin());
+		}
+
+		friend bool operator<(const btree &x, const btree &y)
+		{
+			return ft::lexicographical_compare(x.begin(), x.end(),
+											   y.begin(), y.end());
+		}
+
+	private:
+		/*************************************************************
+		 * Searching within a node
+		 *************************************************************/
+		// Index of the first value not less than k (or, for upper,
+		// greater than k), by binary search.
+		int search(const node *n, const key_type &k, bool upper) const
+		{
+			int lo = 0;
+			int hi = n->count;
+
+			while (lo < hi)
+			{
+				const int mid = (lo + hi) / 2;
+
+				if (upper ? !_key_compare(k, key(n, mid))
+						  : _key_compare(key(n, mid), k))
+					lo = mid + 1;
+				else
+					hi = mid;
+			}
+			return lo;
+		}
+
+		// The bound is the last value found on the way down: the values
+		// met further down are all before it.
+		iterator bound(const key_type &k, bool upper) const
+		{
+			node *n = _root;
+			iterator res(_rightmost, _rightmost ? _rightmost->count : 0);
+
+			while (n != 0)
+			{
+				const int i = search(n, k, upper);
+
+				if (i < n->count)
+					res = iterator(n, i);
+				if (n->leaf)
+					break;
+				n = child(n, i);
+			}
+			return res;
+		}
+
+		/*************************************************************
+		 * Nodes and values
+		 *************************************************************/
+		node *new_leaf()
+		{
+			node *n = _leaf_alloc.allocate(1);
+
+			n->parent = 0;
+			n->position = 0;
+			n->count = 0;
+			n->leaf = true;
+			return n;
+		}
+
+		node *new_internal()
+		{
+			internal_node *n = _internal_alloc.allocate(1);
+
+			n->parent = 0;
+			n->position = 0;
+			n->count = 0;
+			n->leaf = false;
+			for (int i = 0; i <= node_slots; ++i)
+				n->children[i] = 0;
+			return n;
+		}
+
+		// The values of n must have been destroyed or moved away
+		void delete_node(node *n)
+		{
+			if (n->leaf)
+				_leaf_alloc.deallocate(n, 1);
+			else
+				_internal_alloc.deallocate(static_cast<internal_node *>(n), 1);
+		}
+
+		static void set_child(node *p, int i, node *c)
+		{
+			static_cast<internal_node *>(p)->children[i] = c;
+			c->parent = static_cast<internal_node *>(p);
+			c->position = i;
+		}
+
+		// Moves n values from src to dst, which may overlap
+		void move_values(Val *dst, Val *src, int n)
+		{ move_values(dst, src, n, trivial_relocate()); }
+
+		void move_values(Val *dst, Val *src, int n, ft::true_type)
+		{
+			if (n > 0)
+				std::memmove(static_cast<void *>(dst), static_cast<void *>(src),
+							 n * sizeof(Val));
+		}
+
+		void move_values(Val *dst, Val *src, int n, ft::false_type)
+		{
+			if (dst < src)
+				for (int i = 0; i < n; ++i)
+				{
+					_alloc.construct(dst + i, src[i]);
+					_alloc.destroy(src + i);
+				}
+			else
+				for (int i = n - 1; i >= 0; --i)
+				{
+					_alloc.construct(dst + i, src[i]);
+					_alloc.destroy(src + i);
+				}
+		}
+
+		void destroy_subtree(node *n)
+		{
+			if (!n->leaf)
+				for (int i = 0; i <= n->count; ++i)
+					if (child(n, i) != 0)
+						destroy_subtree(child(n, i));
+			for (int i = 0; i < n->count; ++i)
+				_alloc.destroy(n->values() + i);
+			delete_node(n);
+		}
+
+		/*************************************************************
+		 * Copy
+		 *************************************************************/
+		void copy(const btree &x)
+		{
+			if (x._root == 0)
+				return;
+			_root = copy_subtree(x._root);
+
+			node *n = _root;
+
+			while (!n->leaf)
+				n = child(n, 0);
+			_leftmost = n;
+			n = _root;
+			while (!n->leaf)
+				n = child(n, n->count);
+			_rightmost = n;
+			_size = x._size;
+		}
+
+		// Structural copy. On failure, what was copied is destroyed.
+		node *copy_subtree(const node *x)
+		{
+			node *n = x->leaf ? new_leaf() : new_internal();
+
+			try
+			{
+				if (!x->leaf)
+					set_child(n, 0, copy_subtree(child(x, 0)));
+				for (int i = 0; i < x->count; ++i)
+				{
+					_alloc.construct(n->values() + i, x->values()[i]);
+					++n->count;
+					if (!x->leaf)
+						set_child(n, i + 1, copy_subtree(child(x, i + 1)));
+				}
+			}
+			catch (...)
+			{ destroy_subtree(n); throw; }
+			return n;
+		}
+
+		/*************************************************************
+		 * Insertion
+		 *************************************************************/
+		iterator insert_at(node *n, int i, const value_type &v);
+		void split(node *&n, int &i);
+		void insert_separator(node *p, int i, Val *v, node *right);
+
+		/*************************************************************
+		 * Erasure
+		 *************************************************************/
+		void rebalance_after_erase(node *n);
+		void merge(node *left, node *right);
+		void rotate_right(node *left, node *n);
+		void rotate_left(node *n, node *right);
+
+	}; // btree class
+
+	template <typename _Key, typename _Val, typename _KeyOfValue,
+			  typename _Compare, typename _Alloc>
+	inline void
+	swap(btree<_Key, _Val, _KeyOfValue, _Compare, _Alloc> &x,
+		 btree<_Key, _Val, _KeyOfValue, _Compare, _Alloc> &y)
+	{ x.swap(y); }
+
+	template <typename _Key, typename _Val, typename _KeyOfValue,
+			  typename _Compare, typename _Alloc>
+	const typename btree<_Key, _Val, _KeyOfValue, _Compare, _Alloc>::size_type
+	btree<_Key, _Val, _KeyOfValue, _Compare, _Alloc>::target_node_size;
+
+	/*************************************************************
+	 * Insertion
+	 *************************************************************/
+	template <typename _Key, typename _Val, typename _KeyOfValue,
+			  typename _Compare, typename _Alloc>
+	pair<typename btree<_Key, _Val, _KeyOfValue, _Compare, _Alloc>::iterator, bool>
+	btree<_Key, _Val, _KeyOfValue, _Compare, _Alloc>::
+		insert_unique(const _Val &v)
+	{
+		typedef pair<iterator, bool> _Res;
+		const _Key &k = _KeyOfValue()(v);
+
+		if (_root == 0)
+		{
+			_root = new_leaf();
+			_leftmost = _root;
+			_rightmost = _root;
+		}
+		for (node *n = _root;;)
+		{
+			const int i = search(n, k, false);
+
+			if (i < n->count && !_key_compare(k, key(n, i)))
+				return _Res(iterator(n, i), false);
+			if (n->leaf)
+				return _Res(insert_at(n, i, v), true);
+			n = child(n, i);
+		}
+	}
+
+	template <typename _Key, typename _Val, typename _KeyOfValue,
+			  typename _Compare, typename _Alloc>
+	typename btree<_Key, _Val, _KeyOfValue, _Compare, _Alloc>::iterator
+	btree<_Key, _Val, _KeyOfValue, _Compare, _Alloc>::
+		insert_unique(const_iterator hint, const _Val &v)
+	{
+		const _Key &k = _KeyOfValue()(v);
+		iterator pos(hint._node, hint._position);
+
+		if (_size == 0)
+			return insert_unique(v).first;
+		if (pos == end())
+		{
+			if (_key_compare(key(_rightmost, _rightmost->count - 1), k))
+				return insert_at(_rightmost, _rightmost->count, v);
+		}
+		else if (_key_compare(k, _KeyOfValue()(*pos)))
+		{
+			// The value goes right before pos, which is at the beginning
+			// of a leaf, or right after the last value of a leaf.
+			if (pos == begin())
+				return insert_at(_leftmost, 0, v);
+
+			iterator before = pos;
+
+			--before;
+			if (_key_compare(_KeyOfValue()(*before), k))
+			{
+				if (pos._node->leaf)
+					return insert_at(pos._node, pos._position, v);
+				return insert_at(before._node, before._position + 1, v);
+			}
+		}
+		else if (!_key_compare(_KeyOfValue()(*pos), k))
+			return pos; // Equivalent keys
+		return insert_unique(v).first;
+	}
+
+	// Inserts v at index i of leaf n, splitting it first when it is full
+	template <typename _Key, typename _Val, typename _KeyOfValue,
+			  typename _Compare, typename _Alloc>
+	typename btree<_Key, _Val, _KeyOfValue, _Compare, _Alloc>::iterator
+	btree<_Key, _Val, _KeyOfValue, _Compare, _Alloc>::
+		insert_at(node *n, int i, const _Val &v)
+	{
+		if (n->count == node_slots)
+			split(n, i);
+
+		_Val *values = n->values();
+
+		move_values(values + i + 1, values + i, n->count - i);
+		try
+		{ _alloc.construct(values + i, v); }
+		catch (...)
+		{ move_values(values + i, values + i + 1, n->count - i); throw; }
+		++n->count;
+		++_size;
+		return iterator(n, i);
+	}
+
+	// Splits the full node n in two around a separator value, which goes
+	// up to the parent, and updates n and i to where the insertion at
+	// index i should now take place.
+	// When inserting at the end of the node, most of the values stay in
+	// n, so that sorted insertions fill the nodes up.
+	template <typename _Key, typename _Val, typename _KeyOfValue,
+			  typename _Compare, typename _Alloc>
+	void btree<_Key, _Val, _KeyOfValue, _Compare, _Alloc>::
+		split(node *&n, int &i)
+	{
+		const int mid = (i == node_slots) ? node_slots - 2 : node_slots / 2;
+
+		if (n->parent == 0)
+		{
+			node *top = new_internal();
+
+			set_child(top, 0, n);
+			_root = top;
+		}
+		else if (n->parent->count == node_slots)
+		{
+			node *p = n->parent;
+			int pos = n->position;
+
+			split(p, pos);
+		}
+
+		node *right = n->leaf ? new_leaf() : new_internal();
+		const int right_count = n->count - mid - 1;
+
+		move_values(right->values(), n->values() + mid + 1, right_count);
+		right->count = right_count;
+		if (!n->leaf)
+			for (int j = 0; j <= right_count; ++j)
+				set_child(right, j, child(n, mid + 1 + j));
+		n->count = mid;
+		insert_separator(n->parent, n->position, n->values() + mid, right);
+		if (n == _rightmost)
+			_rightmost = right;
+		if (i > mid)
+		{
+			n = right;
+			i -= mid + 1;
+		}
+	}
+
+	// Moves *v to index i of the internal node p, with right as the child
+	// that follows it
+	template <typename _Key, typename _Val, typename _KeyOfValue,
+			  typename _Compare, typename _Alloc>
+	void btree<_Key, _Val, _KeyOfValue, _Compare, _Alloc>::
+		insert_separator(node *p, int i, _Val *v, node *right)
+	{
+		move_values(p->values() + i + 1, p->values() + i, p->count - i);
+		move_values(p->values() + i, v, 1);
+		for (int j = p->count; j > i; --j)
+			set_child(p, j + 1, child(p, j));
+		set_child(p, i + 1, right);
+		++p->count;
+	}
+
+	/*************************************************************
+	 * Erasure
+
+	 * A value of an internal node is replaced by its predecessor, the
+		last value of a leaf, so that values are only ever removed from
+		leaves. A node left with less than min_slots values is merged
+		with a sibling, or takes a value from it.
+	 *************************************************************/
+	template <typename _Key, typename _Val, typename _KeyOfValue,
+			  typename _Compare, typename _Alloc>
+	void btree<_Key, _Val, _KeyOfValue, _Compare, _Alloc>::
+		erase(const_iterator position)
+	{
+		node *n = position._node;
+		int i = position._position;
+
+		_alloc.destroy(n->values() + i);
+		if (!n->leaf)
+		{
+			node *l = child(n, i);
+
+			while (!l->leaf)
+				l = child(l, l->count);
+			move_values(n->values() + i, l->values() + l->count - 1, 1);
+			n = l;
+			i = l->count - 1;
+		}
+		move_values(n->values() + i, n->values() + i + 1, n->count - i - 1);
+		--n->count;
+		--_size;
+		rebalance_after_erase(n);
+	}
+
+	template <typename _Key, typename _Val, typename _KeyOfValue,
+			  typename _Compare, typename _Alloc>
+	typename btree<_Key, _Val, _KeyOfValue, _Compare, _Alloc>::size_type
+	btree<_Key, _Val, _KeyOfValue, _Compare, _Alloc>::
+		erase(const _Key &k)
+	{
+		const_iterator it = find(k);
+
+		if (it == end())
+			return 0;
+		erase(it);
+		return 1;
+	}
+
+	// Erasing invalidates the iterators, so the range is erased by
+	// looking up, each time, the successor of its first key.
+	template <typename _Key, typename _Val, typename _KeyOfValue,
+			  typename _Compare, typename _Alloc>
+	void btree<_Key, _Val, _KeyOfValue, _Compare, _Alloc>::
+		erase(const_iterator first, const_iterator last)
+	{
+		if (first == begin() && last == end())
+		{
+			clear();
+			return;
+		}
+
+		size_type n = ft::distance(first, last);
+
+		if (n == 0)
+			return;
+
+		const _Key k = _KeyOfValue()(*first);
+
+		while (n-- > 0)
+			erase(const_iterator(lower_bound(k)));
+	}
+
+	template <typename _Key, typename _Val, typename _KeyOfValue,
+			  typename _Compare, typename _Alloc>
+	void btree<_Key, _Val, _KeyOfValue, _Compare, _Alloc>::
+		rebalance_after_erase(node *n)
+	{
+		while (n != _root)
+		{
+			if (n->count >= min_slots)
+				return;
+
+			node *p = n->parent;
+			const int pos = n->position;
+
+			if (pos > 0)
+			{
+				node *left = child(p, pos - 1);
+
+				if (left->count + n->count + 1 > node_slots)
+				{
+					rotate_right(left, n);
+					return;
+				}
+				merge(left, n);
+			}
+			else
+			{
+				node *right = child(p, pos + 1);
+
+				if (n->count + right->count + 1 > node_slots)
+				{
+					rotate_left(n, right);
+					return;
+				}
+				merge(n, right);
+			}
+			n = p;
+		}
+
+		// The root may be left empty
+		if (_root->count == 0)
+		{
+			node *old = _root;
+
+			if (old->leaf)
+			{
+				_root = 0;
+				_leftmost = 0;
+				_rightmost = 0;
+			}
+			else
+			{
+				_root = child(old, 0);
+				_root->parent = 0;
+				_root->position = 0;
+			}
+			delete_node(old);
+		}
+	}
+
+	// Moves the separator and all of right into left, its left sibling
+	template <typename _Key, typename _Val, typename _KeyOfValue,
+			  typename _Compare, typename _Alloc>
+	void btree<_Key, _Val, _KeyOfValue, _Compare, _Alloc>::
+		merge(node *left, node *right)
+	{
+		node *p = left->parent;
+		const int pos = left->position;
+
+		move_values(left->values() + left->count, p->values() + pos, 1);
+		move_values(left->values() + left->count + 1, right->values(),
+					right->count);
+		if (!left->leaf)
+			for (int j = 0; j <= right->count; ++j)
+				set_child(left, left->count + 1 + j, child(right, j));
+		left->count += 1 + right->count;
+
+		move_values(p->values() + pos, p->values() + pos + 1,
+					p->count - pos - 1);
+		for (int j = pos + 1; j < p->count; ++j)
+			set_child(p, j, child(p, j + 1));
+		--p->count;
+
+		if (right == _rightmost)
+			_rightmost = left;
+		delete_node(right);
+	}
+
+	// n takes the last value of its left sibling, through the separator
+	template <typename _Key, typename _Val, typename _KeyOfValue,
+			  typename _Compare, typename _Alloc>
+	void btree<_Key, _Val, _KeyOfValue, _Compare, _Alloc>::
+		rotate_right(node *left, node *n)
+	{
+		node *p = n->parent;
+		const int sep = n->position - 1;
+
+		move_values(n->values() + 1, n->values(), n->count);
+		move_values(n->values(), p->values() + sep, 1);
+		move_values(p->values() + sep, left->values() + left->count - 1, 1);
+		if (!n->leaf)
+		{
+			for (int j = n->count; j >= 0; --j)
+				set_child(n, j + 1, child(n, j));
+			set_child(n, 0, child(left, left->count));
+		}
+		++n->count;
+		--left->count;
+	}
+
+	// n takes the first value of its right sibling, through the separator
+	template <typename _Key, typename _Val, typename _KeyOfValue,
+			  typename _Compare, typename _Alloc>
+	void btree<_Key, _Val, _KeyOfValue, _Compare, _Alloc>::
+		rotate_left(node *n, node *right)
+	{
+		node *p = n->parent;
+		const int sep = n->position;
+
+		move_values(n->values() + n->count, p->values() + sep, 1);
+		move_values(p->values() + sep, right->values(), 1);
+		move_values(right->values(), right->values() + 1, right->count - 1);
+		if (!n->leaf)
+		{
+			set_child(n, n->count + 1, child(right, 0));
+			for (int j = 0; j < right->count; ++j)
+				set_child(right, j, child(right, j + 1));
+		}
+		++n->count;
+		--right->count;
+	}
+
+} // namespace ft
+
+#endif /* _FT_BTREE_HPP */
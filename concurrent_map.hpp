@@ -0,0 +1,417 @@
+#ifndef _FT_CONCURRENT_MAP_HPP
+#define _FT_CONCURRENT_MAP_HPP
+
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <new>
+#include <pthread.h>
+
+#include "functional.hpp"
+#include "hashtable.hpp"
+#include "pool_allocator.hpp"
+#include "utility.hpp"
+#include "vector.hpp"
+#include "map.hpp"
+
+/*************************************************************
+ * concurrent_map
+
+ * A map that many threads can use at once: the keys are spread by
+	their hash over a power of two of shards, each an ft::map behind
+	its own reader-writer lock. A lookup takes the read lock of one
+	shard, and an insertion or an erasure its write lock, so threads
+	working on different shards never wait for each other.
+ * Hash must agree with Compare: keys that Compare finds equivalent
+	must have the same hash, or they would go to different shards and
+	both be inserted. A case-insensitive Compare, for instance, needs
+	a case-insensitive Hash.
+ * There are no iterators, as they would outlive the locks: find()
+	copies the mapped value out, and for_each() calls a function on
+	every element, one shard at a time, under the read lock of the
+	shard. Each shard is seen as it was at one instant, but the shards
+	are not seen at the same instant.
+ * for_each_ordered() and snapshot() read the whole map at one instant,
+	in the order of the keys, merging the shards under all their read
+	locks. They hold up every writer while they run.
+ * The functions given to for_each() and for_each_ordered() must not
+	change the map, which would deadlock. size() adds up the sizes of
+	the shards, each read at a different instant.
+ * C++98 has no threads: this header uses POSIX threads, so programs
+	that include it must be built with -pthread. The allocator is
+	shared by the shards, and must be usable from several threads at
+	once: pool_allocator, which is not, is rejected at compile time.
+*************************************************************/
+
+namespace ft
+{
+	template <typename Key, typename T, typename Compare = std::less<Key>,
+			  typename Hash = ft::hash<Key>,
+			  typename Alloc = std::allocator<ft::pair<const Key, T> > >
+	class concurrent_map
+	{
+
+	public:
+		/*************************************************************
+		 * Types
+		 *************************************************************/
+		typedef ft::map<Key, T, Compare, Alloc>	map_type;
+
+		typedef typename map_type::key_type			key_type;
+		typedef typename map_type::mapped_type		mapped_type;
+		typedef typename map_type::value_type		value_type;
+		typedef typename map_type::key_compare		key_compare;
+		typedef typename map_type::value_compare	value_compare;
+		typedef typename map_type::allocator_type	allocator_type;
+		typedef typename map_type::size_type		size_type;
+		typedef Hash								hasher;
+
+		enum { default_shards = 64 };
+
+	private:
+		typedef typename map_type::const_iterator	map_iterator;
+
+		struct shard
+		{
+			shard(const Compare &comp, const allocator_type &alloc) : map(comp, alloc)
+			{
+				if (pthread_rwlock_init(&lock, 0) != 0)
+					std::__throw_runtime_error(__N("concurrent_map: pthread_rwlock_init"));
+			}
+
+			~shard() { pthread_rwlock_destroy(&lock); }
+
+			pthread_rwlock_t	lock;
+			map_type			map;
+			// Keeps the locks of two shards out of the same cache line
+			char				pad[64];
+		};
+
+		typedef typename Alloc::template rebind<shard>::other	shard_allocator;
+		typedef ft::is_pool_allocator<shard_allocator>			pooled;
+
+		class read_guard
+		{
+		public:
+			explicit read_guard(shard &s) : _lock(&s.lock)
+			{
+				if (pthread_rwlock_rdlock(_lock) != 0)
+					std::__throw_runtime_error(__N("concurrent_map: pthread_rwlock_rdlock"));
+			}
+
+			~read_guard() { pthread_rwlock_unlock(_lock); }
+
+		private:
+			read_guard(const read_guard &);
+			read_guard &operator=(const read_guard &);
+
+			pthread_rwlock_t	*_lock;
+		};
+
+		class write_guard
+		{
+		public:
+			explicit write_guard(shard &s) : _lock(&s.lock)
+			{
+				if (pthread_rwlock_wrlock(_lock) != 0)
+					std::__throw_runtime_error(__N("concurrent_map: pthread_rwlock_wrlock"));
+			}
+
+			~write_guard() { pthread_rwlock_unlock(_lock); }
+
+		private:
+			write_guard(const write_guard &);
+			write_guard &operator=(const write_guard &);
+
+			pthread_rwlock_t	*_lock;
+		};
+
+		// The read locks of all the shards, taken in order: writers only
+		// ever hold one lock, so this cannot deadlock
+		class read_all_guard
+		{
+		public:
+			read_all_guard(shard *shards, size_type n) : _shards(shards), _locked(0)
+			{
+				for (; _locked < n; ++_locked)
+					if (pthread_rwlock_rdlock(&_shards[_locked].lock) != 0)
+					{
+						unlock();
+						std::__throw_runtime_error(__N("concurrent_map: pthread_rwlock_rdlock"));
+					}
+			}
+
+			~read_all_guard() { unlock(); }
+
+		private:
+			read_all_guard(const read_all_guard &);
+			read_all_guard &operator=(const read_all_guard &);
+
+			void unlock()
+			{
+				for (; _locked > 0; --_locked)
+					pthread_rwlock_unlock(&_shards[_locked - 1].lock);
+			}
+
+			shard		*_shards;
+			size_type	_locked;
+		};
+
+		// The next element of one shard, in the merge of for_each_ordered()
+		struct cursor
+		{
+			map_iterator	it;
+			map_iterator	end;
+		};
+
+		// Puts the smallest key on top of the heap
+		struct cursor_greater
+		{
+			explicit cursor_greater(const Compare &c) : comp(c) {}
+
+			bool operator()(const cursor &x, const cursor &y) const
+			{ return comp(y.it->first, x.it->first); }
+
+			Compare	comp;
+		};
+
+		struct append_to
+		{
+			explicit append_to(map_type &m) : map(&m) {}
+
+			void operator()(const value_type &x) { map->insert(map->end(), x); }
+
+			map_type	*map;
+		};
+
+	public:
+		/*************************************************************
+		 * Construct/Destroy
+		 *************************************************************/
+		// The number of shards is rounded up to a power of two
+		explicit concurrent_map(size_type shards = default_shards,
+								const Compare &comp = Compare(),
+								const Hash &hash = Hash(),
+								const allocator_type &alloc = allocator_type())
+			: _shards(0), _count(round_up(shards)), _comp(comp), _hash(hash), _alloc(alloc)
+		{
+			typedef char pooled_allocators_cannot_be_shared[pooled::value ? -1 : 1];
+
+			(void)sizeof(pooled_allocators_cannot_be_shared);
+
+			shard_allocator a;
+			size_type i = 0;
+
+			_shards = a.allocate(_count);
+			try
+			{
+				for (; i < _count; ++i)
+					new (_shards + i) shard(_comp, _alloc);
+			}
+			catch (...)
+			{
+				while (i > 0)
+					_shards[--i].~shard();
+				a.deallocate(_shards, _count);
+				throw;
+			}
+		}
+
+		~concurrent_map()
+		{
+			shard_allocator a;
+
+			for (size_type i = 0; i < _count; ++i)
+				_shards[i].~shard();
+			a.deallocate(_shards, _count);
+		}
+
+		allocator_type get_allocator() const { return _alloc; }
+
+		/*************************************************************
+		 * Capacity
+		 *************************************************************/
+		bool empty() const { return size() == 0; }
+
+		size_type size() const
+		{
+			size_type n = 0;
+
+			for (size_type i = 0; i < _count; ++i)
+			{
+				read_guard guard(_shards[i]);
+
+				n += _shards[i].map.size();
+			}
+			return n;
+		}
+
+		size_type shard_count() const { return _count; }
+
+		/*************************************************************
+		 * Lookup
+		 *************************************************************/
+		// Copies the mapped value of k into value, if k is there
+		bool find(const key_type &k, mapped_type &value) const
+		{
+			shard		&s = shard_of(k);
+			read_guard	guard(s);
+			map_iterator it = s.map.find(k);
+
+			if (it == s.map.end())
+				return false;
+			value = it->second;
+			return true;
+		}
+
+		bool contains(const key_type &k) const
+		{
+			shard		&s = shard_of(k);
+			read_guard	guard(s);
+
+			return s.map.find(k) != s.map.end();
+		}
+
+		size_type count(const key_type &k) const { return contains(k) ? 1 : 0; }
+
+		/*************************************************************
+		 * Modifiers
+		 *************************************************************/
+		// False if the key was already there, which is left as it was
+		bool insert(const value_type &x)
+		{
+			shard		&s = shard_of(x.first);
+			write_guard	guard(s);
+
+			return s.map.insert(x).second;
+		}
+
+		// True if the key was inserted, false if its value was assigned
+		bool insert_or_assign(const key_type &k, const mapped_type &obj)
+		{
+			shard		&s = shard_of(k);
+			write_guard	guard(s);
+
+			return s.map.insert_or_assign(k, obj).second;
+		}
+
+		size_type erase(const key_type &k)
+		{
+			shard		&s = shard_of(k);
+			write_guard	guard(s);
+
+			return s.map.erase(k);
+		}
+
+		// Shard by shard: other threads may see part of the map cleared
+		void clear()
+		{
+			for (size_type i = 0; i < _count; ++i)
+			{
+				write_guard guard(_shards[i]);
+
+				_shards[i].map.clear();
+			}
+		}
+
+		/*************************************************************
+		 * Traversal
+		 *************************************************************/
+		// Every element, shard by shard, in no particular order
+		template <typename Function>
+		Function for_each(Function f) const
+		{
+			for (size_type i = 0; i < _count; ++i)
+			{
+				read_guard guard(_shards[i]);
+
+				for (map_iterator it = _shards[i].map.begin(); it != _shards[i].map.end(); ++it)
+					f(*it);
+			}
+			return f;
+		}
+
+		// Every element, in ascending order of the keys, as they all were
+		// at one instant: the shards are merged with a heap of cursors
+		template <typename Function>
+		Function for_each_ordered(Function f) const
+		{
+			ft::vector<cursor>	heap;
+			cursor_greater		greater(_comp);
+
+			heap.reserve(_count);
+
+			read_all_guard	guard(_shards, _count);
+
+			for (size_type i = 0; i < _count; ++i)
+				if (!_shards[i].map.empty())
+				{
+					cursor c;
+
+					c.it = _shards[i].map.begin();
+					c.end = _shards[i].map.end();
+					heap.push_back(c);
+				}
+			std::make_heap(heap.begin(), heap.end(), greater);
+			while (!heap.empty())
+			{
+				std::pop_heap(heap.begin(), heap.end(), greater);
+
+				cursor &c = heap.back();
+
+				f(*c.it);
+				if (++c.it == c.end)
+					heap.pop_back();
+				else
+					std::push_heap(heap.begin(), heap.end(), greater);
+			}
+			return f;
+		}
+
+		// A copy of the whole map, as it was at one instant
+		map_type snapshot() const
+		{
+			map_type m(_comp, _alloc);
+
+			for_each_ordered(append_to(m));
+			return m;
+		}
+
+		/*************************************************************
+		 * Observers
+		 *************************************************************/
+		key_compare key_comp() const { return _comp; }
+
+		value_compare value_comp() const { return _shards[0].map.value_comp(); }
+
+		hasher hash_function() const { return _hash; }
+
+	private:
+		concurrent_map(const concurrent_map &);
+		concurrent_map &operator=(const concurrent_map &);
+
+		static size_type round_up(size_type n)
+		{
+			size_type p = 1;
+
+			while (p < n)
+				p <<= 1;
+			return p;
+		}
+
+		// Only Compare tells equivalent keys apart within a shard: Hash
+		// must give them the same shard (see above)
+		shard &shard_of(const key_type &k) const
+		{ return _shards[hashtable_detail::mix(_hash(k)) & (_count - 1)]; }
+
+		shard			*_shards;
+		size_type		_count;
+		key_compare		_comp;
+		hasher			_hash;
+		allocator_type	_alloc;
+
+	}; // concurrent_map
+
+} // namespace ft
+
+#endif /* _FT_CONCURRENT_MAP_HPP */
@@ -0,0 +1,57 @@
+#include "../base.hpp"
+#include <map>
+#if !defined(USING_STD)
+# include "btree_map.hpp"
+# define t_btree_map_ TESTED_NAMESPACE::btree_map
+#else
+// btree_map is a drop-in ft::map: it is compared with std::map
+# define t_btree_map_ std::map
+#endif /* !defined(STD) */
+
+#define _pair TESTED_NAMESPACE::pair
+
+template <typename T>
+std::string	printPair(const T &iterator, bool nl = true, std::ostream &o = std::cout)
+{
+	o << "key: " << iterator->first << " | value: " << iterator->second;
+	if (nl)
+		o << std::endl;
+	return ("");
+}
+
+template <typename T_MAP>
+void	printSize(T_MAP const &mp, bool print_content = 1)
+{
+	std::cout << "size: " << mp.size() << std::endl;
+	if (print_content)
+	{
+		typename T_MAP::const_iterator it = mp.begin(), ite = mp.end();
+		std::cout << std::endl << "Content is:" << std::endl;
+		for (; it != ite; ++it)
+			std::cout << "- " << printPair(it, false) << std::endl;
+	}
+	std::cout << "###############################################" << std::endl;
+}
+
+// For maps of many nodes: the walks both ways must agree, and every
+// step-th pair is printed
+template <typename T_MAP>
+void	printDigest(T_MAP const &mp, std::size_t step = 97)
+{
+	typename T_MAP::const_iterator			it = mp.begin();
+	typename T_MAP::const_reverse_iterator	rit = mp.rbegin();
+	std::size_t								forward = 0;
+	std::size_t								backward = 0;
+
+	std::cout << "size: " << mp.size() << std::endl;
+	for (; it != mp.end(); ++it, ++forward)
+		if (forward % step == 0)
+			std::cout << "[" << forward << "] " << printPair(it, false) << std::endl;
+	for (; rit != mp.rend(); ++rit)
+		++backward;
+	std::cout << "forward: " << forward << " | backward: " << backward << std::endl;
+	if (!mp.empty())
+		std::cout << "first: " << printPair(mp.begin(), false)
+			<< " | last: " << printPair(--mp.end(), false) << std::endl;
+	std::cout << "###############################################" << std::endl;
+}
@@ -0,0 +1,63 @@
+#include "common.hpp"
+
+#define T1 int
+#define T2 int
+typedef t_btree_map_<T1, T2>::value_type T3;
+typedef t_btree_map_<T1, T2>::iterator ft_iterator;
+
+t_btree_map_<T1, T2>	make(int n)
+{
+	t_btree_map_<T1, T2>	mp;
+
+	for (int i = 0; i < n; ++i)
+		mp.insert(T3((i * 7919) % n, i));
+	return mp;
+}
+
+int		main(void)
+{
+	// Every other key: nodes borrow from their siblings, then merge
+	t_btree_map_<T1, T2>	mp = make(4000);
+
+	for (int i = 0; i < 4000; i += 2)
+		mp.erase(i);
+	printDigest(mp);
+	for (int i = 1; i < 4000; i += 4)
+		std::cout << (mp.erase(i) ? "" : "not erased ");
+	std::cout << std::endl;
+	printDigest(mp);
+
+	// From the front, then from the back, until the root is a leaf
+	mp = make(3000);
+	while (mp.size() > 1500)
+		mp.erase(mp.begin());
+	printDigest(mp);
+	while (mp.size() > 10)
+		mp.erase(--mp.end());
+	printSize(mp);
+	while (!mp.empty())
+		mp.erase(mp.begin()->first);
+	printSize(mp);
+
+	// Ranges inside a node, over several nodes, and to the ends
+	mp = make(3000);
+	mp.erase(mp.find(10), mp.find(15));
+	mp.erase(mp.find(100), mp.find(1900));
+	mp.erase(mp.begin(), mp.find(50));
+	mp.erase(mp.find(2500), mp.end());
+	printDigest(mp, 31);
+
+	// Shrunk and grown again, so merged nodes split anew
+	for (int i = 0; i < 3000; ++i)
+		mp[i] = -i;
+	printDigest(mp);
+	for (int i = 0; i < 3000; ++i)
+		if (i % 5 != 0)
+			mp.erase(i);
+	printDigest(mp, 53);
+	mp.clear();
+	printSize(mp);
+	mp[1] = 1;
+	printSize(mp);
+	return (0);
+}
@@ -0,0 +1,73 @@
+#include "common.hpp"
+
+#define T1 int
+#define T2 int
+typedef t_btree_map_<T1, T2>::value_type T3;
+typedef t_btree_map_<T1, T2>::iterator ft_iterator;
+
+template <typename T_MAP>
+void	ft_bounds(T_MAP &mp, T1 const &k)
+{
+	ft_iterator lb = mp.lower_bound(k);
+	ft_iterator ub = mp.upper_bound(k);
+
+	std::cout << "bounds(" << k << "): ";
+	if (lb == mp.end())
+		std::cout << "end";
+	else
+		std::cout << lb->first;
+	std::cout << " ";
+	if (ub == mp.end())
+		std::cout << "end";
+	else
+		std::cout << ub->first;
+	std::cout << " | count: " << mp.count(k) << " | find: " << (mp.find(k) != mp.end()) << std::endl;
+}
+
+int		main(void)
+{
+	// Ascending, then descending, then interleaved: each splits nodes
+	// on another side
+	t_btree_map_<T1, T2>	asc;
+	t_btree_map_<T1, T2>	desc;
+	t_btree_map_<T1, T2>	mixed;
+
+	for (int i = 0; i < 5000; ++i)
+	{
+		asc.insert(T3(i, i));
+		desc.insert(T3(5000 - i, i));
+		mixed.insert(T3((i * 7919) % 5003, i));
+	}
+	printDigest(asc);
+	printDigest(desc);
+	printDigest(mixed);
+
+	// Duplicates are refused, whatever the node they fall in
+	std::size_t	refused = 0;
+
+	for (int i = 0; i < 5000; i += 3)
+		refused += !mixed.insert(T3((i * 7919) % 5003, -1)).second;
+	std::cout << "refused: " << refused << std::endl;
+
+	for (int k = -10; k < 5100; k += 251)
+		ft_bounds(mixed, k);
+	ft_bounds(mixed, 5002);
+	ft_bounds(mixed, 5003);
+
+	// Hinted insertions at both ends and inside full nodes
+	for (int i = 0; i < 300; ++i)
+	{
+		asc.insert(asc.end(), T3(5000 + i, i));
+		asc.insert(asc.begin(), T3(-1 - i, i));
+		asc.insert(asc.find(2500), T3(2500 + i, -i));
+	}
+	printDigest(asc, 173);
+
+	// operator[] and insertion of ranges
+	for (int i = 0; i < 2000; i += 7)
+		desc[i * 3] += 1;
+	mixed.insert(desc.begin(), desc.end());
+	printDigest(desc);
+	printDigest(mixed);
+	return (0);
+}
@@ -0,0 +1,58 @@
+#include "common.hpp"
+
+#define T1 std::string
+#define T2 int
+typedef t_btree_map_<T1, T2>::value_type T3;
+typedef t_btree_map_<T1, T2>::iterator ft_iterator;
+
+// Few std::string pairs fit in a node: the tree is deep
+std::string	key(int i)
+{
+	std::string	s;
+
+	for (int n = i; s.size() < 4; n /= 26)
+		s = std::string(1, 'a' + n % 26) + s;
+	return s + std::string(i % 5, '+');
+}
+
+int		main(void)
+{
+	t_btree_map_<T1, T2>	mp;
+
+	for (int i = 0; i < 3000; ++i)
+		mp.insert(T3(key((i * 7919) % 3001), i));
+	printDigest(mp);
+
+	std::cout << "find(aaaa): " << (mp.find("aaaa") != mp.end()) << std::endl;
+	std::cout << "count(zzzz): " << mp.count("zzzz") << std::endl;
+	std::cout << "lower_bound(abc): " << printPair(mp.lower_bound("abc"), false) << std::endl;
+	std::cout << "upper_bound(aaeb): " << printPair(mp.upper_bound("aaeb"), false) << std::endl;
+	std::cout << "at(" << key(42) << "): " << mp.at(key(42)) << std::endl;
+	try {
+		mp.at("nope");
+	} catch (std::out_of_range &) {
+		std::cout << "at(nope) threw out_of_range" << std::endl;
+	}
+
+	// Erasures that empty nodes, and the strings they hold
+	for (int i = 0; i < 3000; i += 3)
+		mp.erase(key(i));
+	printDigest(mp);
+	mp.erase(mp.lower_bound("aab"), mp.lower_bound("aae"));
+	printDigest(mp, 41);
+
+	// Copies, comparisons and swap
+	t_btree_map_<T1, T2>	copy(mp);
+	t_btree_map_<T1, T2>	other;
+
+	std::cout << "copy == mp: " << (copy == mp) << std::endl;
+	copy.erase(copy.begin());
+	copy["new"] = 1;
+	std::cout << "copy == mp: " << (copy == mp) << " | copy < mp: " << (copy < mp)
+		<< " | copy > mp: " << (copy > mp) << std::endl;
+	other = copy;
+	other.swap(mp);
+	printDigest(mp);
+	printDigest(other);
+	return (0);
+}
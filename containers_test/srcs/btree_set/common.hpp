@@ -0,0 +1,57 @@
+#include "../base.hpp"
+#include <set>
+#if !defined(USING_STD)
+# include "btree_set.hpp"
+# define t_btree_set_ TESTED_NAMESPACE::btree_set
+#else
+// btree_set is a drop-in ft::set: it is compared with std::set
+# define t_btree_set_ std::set
+#endif /* !defined(STD) */
+
+#define _pair TESTED_NAMESPACE::pair
+
+template <typename T>
+std::string	printPair(const T &iterator, bool nl = true, std::ostream &o = std::cout)
+{
+	o << "value: " << *iterator;
+	if (nl)
+		o << std::endl;
+	return ("");
+}
+
+template <typename T_SET>
+void	printSize(T_SET const &st, bool print_content = 1)
+{
+	std::cout << "size: " << st.size() << std::endl;
+	if (print_content)
+	{
+		typename T_SET::const_iterator it = st.begin(), ite = st.end();
+		std::cout << std::endl << "Content is:" << std::endl;
+		for (; it != ite; ++it)
+			std::cout << "- " << printPair(it, false) << std::endl;
+	}
+	std::cout << "###############################################" << std::endl;
+}
+
+// For sets of many nodes: the walks both ways must agree, and every
+// step-th element is printed
+template <typename T_SET>
+void	printDigest(T_SET const &st, std::size_t step = 97)
+{
+	typename T_SET::const_iterator			it = st.begin();
+	typename T_SET::const_reverse_iterator	rit = st.rbegin();
+	std::size_t								forward = 0;
+	std::size_t								backward = 0;
+
+	std::cout << "size: " << st.size() << std::endl;
+	for (; it != st.end(); ++it, ++forward)
+		if (forward % step == 0)
+			std::cout << "[" << forward << "] " << printPair(it, false) << std::endl;
+	for (; rit != st.rend(); ++rit)
+		++backward;
+	std::cout << "forward: " << forward << " | backward: " << backward << std::endl;
+	if (!st.empty())
+		std::cout << "first: " << printPair(st.begin(), false)
+			<< " | last: " << printPair(--st.end(), false) << std::endl;
+	std::cout << "###############################################" << std::endl;
+}
@@ -0,0 +1,58 @@
+#include "common.hpp"
+
+#define T1 int
+typedef t_btree_set_<T1>::iterator ft_iterator;
+
+int		main(void)
+{
+	t_btree_set_<T1>	st;
+
+	// Splits on the right, on the left, and anywhere
+	for (int i = 0; i < 3000; ++i)
+		st.insert(i);
+	for (int i = 0; i < 3000; ++i)
+		st.insert(-1 - i);
+	for (int i = 0; i < 3000; ++i)
+		st.insert(10000 + (i * 7919) % 3001);
+	printDigest(st);
+
+	std::size_t	refused = 0;
+
+	for (int i = -3000; i < 3000; i += 7)
+		refused += !st.insert(i).second;
+	std::cout << "refused: " << refused << std::endl;
+	std::cout << "lower_bound(3000): " << printPair(st.lower_bound(3000), false) << std::endl;
+	std::cout << "upper_bound(-1): " << printPair(st.upper_bound(-1), false) << std::endl;
+	std::cout << "count(10500): " << st.count(10500) << std::endl;
+	std::cout << "equal_range(42): " << printPair(st.equal_range(42).first, false)
+		<< " " << printPair(st.equal_range(42).second, false) << std::endl;
+
+	// Merges: every other element, then ranges, then one end
+	for (int i = -3000; i < 3000; i += 2)
+		st.erase(i);
+	printDigest(st);
+	st.erase(st.find(-999), st.find(999));
+	st.erase(st.lower_bound(10100), st.upper_bound(12000));
+	printDigest(st, 37);
+	while (st.size() > 20)
+		st.erase(st.begin());
+	printSize(st);
+	while (!st.empty())
+		st.erase(--st.end());
+	printSize(st);
+
+	// Hinted, grown again, and copied
+	for (int i = 0; i < 2000; ++i)
+		st.insert(st.end(), i * 2);
+	for (int i = 0; i < 2000; ++i)
+		st.insert(st.begin(), i * 2 + 1);
+
+	t_btree_set_<T1>	copy(st);
+
+	for (int i = 0; i < 4000; i += 3)
+		copy.erase(i);
+	std::cout << "copy == st: " << (copy == st) << " | copy < st: " << (copy < st) << std::endl;
+	printDigest(st);
+	printDigest(copy);
+	return (0);
+}
@@ -0,0 +1,39 @@
+#include "common.hpp"
+
+#define T1 std::string
+typedef t_btree_set_<T1>::iterator ft_iterator;
+
+// Few std::strings fit in a node: the tree is deep
+std::string	key(int i)
+{
+	std::string	s;
+
+	for (int n = i; s.size() < 4; n /= 26)
+		s = std::string(1, 'a' + n % 26) + s;
+	return s + std::string(i % 5, '+');
+}
+
+int		main(void)
+{
+	t_btree_set_<T1>	st;
+
+	for (int i = 0; i < 3000; ++i)
+		st.insert(key((i * 7919) % 3001));
+	printDigest(st);
+	std::cout << "find(aaaa): " << (st.find("aaaa") != st.end()) << std::endl;
+	std::cout << "lower_bound(abc): " << printPair(st.lower_bound("abc"), false) << std::endl;
+
+	for (int i = 0; i < 3000; i += 3)
+		st.erase(key(i));
+	printDigest(st);
+	st.erase(st.lower_bound("aab"), st.lower_bound("aae"));
+	printDigest(st, 41);
+
+	t_btree_set_<T1>	other;
+
+	other.insert("z");
+	other.swap(st);
+	printDigest(st);
+	printDigest(other);
+	return (0);
+}
@@ -0,0 +1,96 @@
+#include "../base.hpp"
+#include <algorithm>
+#include <map>
+#if !defined(USING_STD)
+# include "concurrent_map.hpp"
+# define t_concurrent_map_ TESTED_NAMESPACE::concurrent_map
+#else
+// std has no concurrent map: a single std::map, used from one thread,
+// must hold the same contents in the same order
+template <class Key, class T, class Compare = std::less<Key>, class Hash = void>
+class concurrent_map
+{
+	public:
+		typedef std::map<Key, T, Compare>			map_type;
+		typedef typename map_type::key_type			key_type;
+		typedef typename map_type::mapped_type		mapped_type;
+		typedef typename map_type::value_type		value_type;
+		typedef typename map_type::size_type		size_type;
+		typedef typename map_type::const_iterator	const_iterator;
+
+		explicit concurrent_map(size_type shards = 64) : _count(1)
+		{
+			while (_count < shards)
+				_count <<= 1;
+		}
+
+		bool		empty(void) const { return _map.empty(); }
+		size_type	size(void) const { return _map.size(); }
+		size_type	shard_count(void) const { return _count; }
+
+		bool	find(const key_type &k, mapped_type &value) const
+		{
+			const_iterator it = _map.find(k);
+
+			if (it == _map.end())
+				return false;
+			value = it->second;
+			return true;
+		}
+
+		bool		contains(const key_type &k) const { return _map.count(k) != 0; }
+		size_type	count(const key_type &k) const { return _map.count(k); }
+
+		bool	insert(const value_type &x) { return _map.insert(x).second; }
+
+		bool	insert_or_assign(const key_type &k, const mapped_type &obj)
+		{
+			std::pair<typename map_type::iterator, bool> ret = _map.insert(value_type(k, obj));
+
+			if (!ret.second)
+				ret.first->second = obj;
+			return ret.second;
+		}
+
+		size_type	erase(const key_type &k) { return _map.erase(k); }
+		void		clear(void) { _map.clear(); }
+
+		template <class Function>
+		Function	for_each(Function f) const { return std::for_each(_map.begin(), _map.end(), f); }
+
+		template <class Function>
+		Function	for_each_ordered(Function f) const { return for_each(f); }
+
+		map_type	snapshot(void) const { return _map; }
+
+	private:
+		map_type	_map;
+		size_type	_count;
+};
+# define t_concurrent_map_ concurrent_map
+#endif /* !defined(STD) */
+
+#define _pair TESTED_NAMESPACE::pair
+
+template <typename T>
+std::string	printPair(const T &iterator, bool nl = true, std::ostream &o = std::cout)
+{
+	o << "key: " << iterator->first << " | value: " << iterator->second;
+	if (nl)
+		o << std::endl;
+	return ("");
+}
+
+template <typename T_MAP>
+void	printSize(T_MAP const &mp, bool print_content = 1)
+{
+	std::cout << "size: " << mp.size() << std::endl;
+	if (print_content)
+	{
+		typename T_MAP::const_iterator it = mp.begin(), ite = mp.end();
+		std::cout << std::endl << "Content is:" << std::endl;
+		for (; it != ite; ++it)
+			std::cout << "- " << printPair(it, false) << std::endl;
+	}
+	std::cout << "###############################################" << std::endl;
+}
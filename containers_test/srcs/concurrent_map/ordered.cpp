@@ -0,0 +1,102 @@
+#include "common.hpp"
+
+#define T1 int
+#define T2 int
+
+// Sends every key to the same shard
+struct one_shard
+{
+	std::size_t	operator()(int) const { return 7; }
+};
+
+// Prints the elements in the order they come
+struct printer
+{
+	printer(void) : n(0) {}
+
+	template <typename T>
+	void	operator()(T const &x)
+	{
+		std::cout << (n++ ? " " : "") << x.first << "=" << x.second;
+	}
+
+	int		n;
+};
+
+// Adds the elements up, in any order
+struct summer
+{
+	summer(void) : keys(0), values(0) {}
+
+	template <typename T>
+	void	operator()(T const &x) { keys += x.first; values += x.second; }
+
+	long	keys;
+	long	values;
+};
+
+template <typename T_MAP>
+void	printMap(T_MAP const &mp)
+{
+	summer	s = mp.for_each(summer());
+
+	std::cout << "size: " << mp.size() << " | empty: " << mp.empty()
+		<< " | keys: " << s.keys << " | values: " << s.values << std::endl;
+	std::cout << "ordered: ";
+
+	printer	p = mp.for_each_ordered(printer());
+
+	std::cout << std::endl << "count: " << p.n << std::endl;
+	printSize(mp.snapshot());
+}
+
+template <typename T_MAP>
+void	test(std::size_t shards)
+{
+	typedef typename T_MAP::value_type	T3;
+
+	T_MAP	mp(shards);
+	T2		value = 0;
+
+	std::cout << "shards: " << mp.shard_count() << std::endl;
+	printMap(mp);
+
+	// Keys spread over the shards, inserted out of order
+	for (int i = 0; i < 60; ++i)
+		std::cout << mp.insert(T3((i * 37) % 61 - 20, i));
+	std::cout << std::endl;
+	printMap(mp);
+
+	// insert() leaves an existing key alone, insert_or_assign() replaces it
+	std::cout << "insert: " << mp.insert(T3(-3, 100)) << " " << mp.insert(T3(1000, 100)) << std::endl;
+	std::cout << "insert_or_assign: " << mp.insert_or_assign(-3, 200)
+		<< " " << mp.insert_or_assign(-1000, 300) << std::endl;
+	for (int i = 0; i < 3; ++i)
+	{
+		const int	k[] = { -3, 1000, 999 };
+		const bool	found = mp.find(k[i], value);
+
+		std::cout << "find(" << k[i] << "): " << found << " " << value << std::endl;
+	}
+	std::cout << "contains: " << mp.contains(-1000) << " " << mp.contains(-999)
+		<< " | count: " << mp.count(40) << " " << mp.count(41) << std::endl;
+
+	for (int i = -20; i < 41; i += 3)
+		std::cout << mp.erase(i);
+	std::cout << std::endl;
+	printMap(mp);
+
+	mp.clear();
+	printMap(mp);
+	mp.insert_or_assign(5, 5);
+	printMap(mp);
+}
+
+int		main(void)
+{
+	test<t_concurrent_map_<T1, T2> >(1);
+	test<t_concurrent_map_<T1, T2> >(3);
+	test<t_concurrent_map_<T1, T2> >(64);
+	test<t_concurrent_map_<T1, T2, std::less<T1>, one_shard> >(16);
+	return (0);
+}
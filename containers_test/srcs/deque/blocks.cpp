@@ -0,0 +1,102 @@
+#include "common.hpp"
+
+#define TESTED_TYPE int
+typedef TESTED_NAMESPACE::deque<TESTED_TYPE> t_deque;
+
+// Elements too large to share a block
+struct big
+{
+	big(int v = 0) : value(v) { pad[0] = 'x'; }
+
+	char	pad[600];
+	int		value;
+};
+
+std::ostream	&operator<<(std::ostream &o, big const &b) { return o << b.value; }
+
+// The elements on both sides of every 128th position: ints fill their
+// blocks 128 at a time
+template <typename T>
+void	printBounds(TESTED_NAMESPACE::deque<T> const &deq)
+{
+	long	sum = 0;
+
+	std::cout << "size: " << deq.size() << std::endl;
+	for (typename TESTED_NAMESPACE::deque<T>::const_iterator it = deq.begin(); it != deq.end(); ++it)
+		sum += *it;
+	std::cout << "sum: " << sum << std::endl;
+	for (std::size_t i = 0; i < deq.size(); i += 128)
+	{
+		std::cout << "[" << i << "]: " << deq[i];
+		if (i > 0)
+			std::cout << " | [" << i - 1 << "]: " << deq.at(i - 1);
+		std::cout << std::endl;
+	}
+	if (!deq.empty())
+		std::cout << "front: " << deq.front() << " | back: " << deq.back() << std::endl;
+	std::cout << "###############################################" << std::endl;
+}
+
+int		main(void)
+{
+	t_deque	deq;
+
+	// Both ends grow over many blocks, and the map is grown and recentred
+	for (int i = 0; i < 1000; ++i)
+	{
+		deq.push_back(i);
+		deq.push_front(-i);
+	}
+	printBounds(deq);
+	for (int i = 0; i < 700; ++i)
+		deq.pop_front();
+	for (int i = 0; i < 3000; ++i)
+		deq.push_back(i * 2);
+	printBounds(deq);
+	for (int i = 0; i < 3000; ++i)
+		deq.pop_back();
+	for (int i = 0; i < 2000; ++i)
+		deq.push_front(i * 3);
+	printBounds(deq);
+
+	// Iterator arithmetic over block bounds
+	t_deque::iterator		it = deq.begin();
+	t_deque::const_iterator	cit = deq.end();
+
+	std::cout << "end - begin: " << (cit - it) << std::endl;
+	std::cout << "*(it + 127): " << *(it + 127) << " | *(it + 128): " << *(it + 128) << std::endl;
+	it += 1000;
+	std::cout << "*it: " << *it << " | it[-129]: " << it[-129] << " | it[300]: " << it[300] << std::endl;
+	it -= 257;
+	std::cout << "*it: " << *it << " | it - begin: " << (it - deq.begin()) << std::endl;
+	std::cout << "*(cit - 129): " << *(cit - 129) << " | cit > it: " << (cit > it) << std::endl;
+
+	long	rsum = 0;
+
+	for (t_deque::reverse_iterator rit = deq.rbegin(); rit != deq.rend(); ++rit)
+		rsum += *rit;
+	std::cout << "reverse sum: " << rsum << std::endl;
+
+	// Until empty from the front, then grown again from the back
+	while (!deq.empty())
+		deq.pop_front();
+	printBounds(deq);
+	for (int i = 0; i < 300; ++i)
+		deq.push_back(i);
+	printBounds(deq);
+
+	// One element per block
+	TESTED_NAMESPACE::deque<big>	bigs;
+
+	for (int i = 0; i < 50; ++i)
+	{
+		bigs.push_front(big(i));
+		bigs.push_back(big(-i));
+	}
+	bigs.erase(bigs.begin() + 10, bigs.begin() + 20);
+	bigs.insert(bigs.end() - 5, 3, big(1000));
+	std::cout << "bigs size: " << bigs.size() << std::endl;
+	for (std::size_t i = 0; i < bigs.size(); i += 7)
+		std::cout << "bigs[" << i << "]: " << bigs[i] << std::endl;
+	return (0);
+}
@@ -0,0 +1,88 @@
+#include "common.hpp"
+#include <list>
+#include <sstream>
+#include <iterator>
+
+#define TESTED_TYPE int
+typedef TESTED_NAMESPACE::deque<TESTED_TYPE> t_deque;
+
+// The content on a few lines, to follow elements shifted over blocks
+void	printLine(t_deque const &deq)
+{
+	std::cout << "size: " << deq.size() << std::endl;
+	for (std::size_t i = 0; i < deq.size(); ++i)
+		std::cout << deq[i] << ((i % 25 == 24 || i + 1 == deq.size()) ? "\n" : " ");
+	std::cout << "###############################################" << std::endl;
+}
+
+int		main(void)
+{
+	t_deque	deq;
+
+	for (int i = 0; i < 300; ++i)
+		deq.push_back(i);
+
+	// Near the front, the front elements move; near the back, the back
+	// ones; the returned iterator is the new element either way
+	t_deque::iterator	it;
+
+	it = deq.insert(deq.begin() + 3, -1);
+	std::cout << "insert: " << *it << " at " << (it - deq.begin()) << std::endl;
+	it = deq.insert(deq.end() - 3, -2);
+	std::cout << "insert: " << *it << " at " << (it - deq.begin()) << std::endl;
+	it = deq.insert(deq.begin() + 150, -3);
+	std::cout << "insert: " << *it << " at " << (it - deq.begin()) << std::endl;
+	deq.insert(deq.begin() + 10, 200, -4);
+	deq.insert(deq.end() - 10, 200, -5);
+	deq.insert(deq.begin(), 5, -6);
+	deq.insert(deq.end(), 5, -7);
+	printLine(deq);
+
+	// Ranges of forward and input iterators, longer than a block
+	std::list<TESTED_TYPE>	lst;
+
+	for (int i = 0; i < 260; ++i)
+		lst.push_back(1000 + i);
+	deq.insert(deq.begin() + 20, lst.begin(), lst.end());
+	deq.insert(deq.end() - 20, lst.begin(), lst.end());
+	std::stringstream	ss;
+
+	for (int i = 0; i < 150; ++i)
+		ss << 2000 + i << ' ';
+	deq.insert(deq.begin() + 30, std::istream_iterator<TESTED_TYPE>(ss),
+		std::istream_iterator<TESTED_TYPE>());
+
+	t_deque	head(deq.begin(), deq.begin() + 40);
+
+	deq.insert(deq.begin() + deq.size() / 2, head.begin(), head.end());
+	printLine(deq);
+
+	// Erasures on the shorter side, over block bounds
+	it = deq.erase(deq.begin() + 5);
+	std::cout << "erase: " << *it << " at " << (it - deq.begin()) << std::endl;
+	it = deq.erase(deq.end() - 5);
+	std::cout << "erase: " << *it << " at " << (it - deq.begin()) << std::endl;
+	it = deq.erase(deq.begin() + 2, deq.begin() + 400);
+	std::cout << "erase: " << *it << " at " << (it - deq.begin()) << std::endl;
+	it = deq.erase(deq.end() - 400, deq.end() - 1);
+	std::cout << "erase: " << *it << " at " << (it - deq.begin()) << std::endl;
+	it = deq.erase(deq.begin() + 100, deq.begin() + 300);
+	std::cout << "erase: " << *it << " at " << (it - deq.begin()) << std::endl;
+	it = deq.erase(deq.begin(), deq.begin());
+	std::cout << "erase: " << *it << " at " << (it - deq.begin()) << std::endl;
+	printLine(deq);
+
+	// resize and assign over several blocks
+	deq.resize(700, 7);
+	deq.resize(650);
+	printLine(deq);
+	deq.assign(lst.begin(), lst.end());
+	deq.assign(130, 42);
+	deq.push_front(0);
+	printLine(deq);
+	deq.clear();
+	deq.push_front(1);
+	deq.push_back(2);
+	printLine(deq);
+	return (0);
+}
@@ -0,0 +1,48 @@
+#include "../base.hpp"
+#include <map>
+#include <sstream>
+#if !defined(USING_STD)
+# include "map.hpp"
+# include "frozen_map.hpp"
+# define t_frozen_map_ TESTED_NAMESPACE::frozen_map
+#else
+// frozen_map has the lookup interface of ft::map: it is compared with
+// std::map
+# define t_frozen_map_ std::map
+#endif /* !defined(STD) */
+
+#define _pair TESTED_NAMESPACE::pair
+
+// The key of an iterator, or end
+template <typename T_MAP>
+std::string	printKey(T_MAP const &mp, typename T_MAP::const_iterator it)
+{
+	if (it == mp.end())
+		return "end";
+
+	std::ostringstream	o;
+
+	o << it->first << "=" << it->second;
+	return o.str();
+}
+
+// Both walks, from begin() up and from end() down, and with reverse
+// iterators
+template <typename T_MAP>
+void	printWalks(T_MAP const &mp)
+{
+	typename T_MAP::const_iterator			it = mp.begin();
+	typename T_MAP::const_reverse_iterator	rit = mp.rbegin();
+
+	std::cout << "size: " << mp.size() << " | empty: " << mp.empty() << std::endl;
+	std::cout << "forward:";
+	for (; it != mp.end(); ++it)
+		std::cout << " " << printKey(mp, it);
+	std::cout << std::endl << "backward:";
+	for (it = mp.end(); it != mp.begin();)
+		std::cout << " " << printKey(mp, --it);
+	std::cout << std::endl << "reverse:";
+	for (; rit != mp.rend(); ++rit)
+		std::cout << " " << rit->first;
+	std::cout << std::endl;
+}
@@ -0,0 +1,62 @@
+#include "common.hpp"
+#include <functional>
+#include <vector>
+
+#define T1 std::string
+#define T2 int
+typedef TESTED_NAMESPACE::map<T1, T2, std::greater<T1> > t_src;
+typedef t_frozen_map_<T1, T2, std::greater<T1> > t_map;
+typedef t_map::value_type T3;
+
+void	printAt(t_map const &mp, T1 const &k)
+{
+	try
+	{
+		std::cout << "at(" << k << "): " << mp.at(k) << std::endl;
+	}
+	catch (std::out_of_range &e)
+	{
+		std::cout << "at(" << k << "): out_of_range" << std::endl;
+	}
+}
+
+int		main(void)
+{
+	std::vector<T3>	v;
+
+	// Duplicate keys in a range: the first one is kept
+	for (int i = 0; i < 40; ++i)
+		v.push_back(T3(std::string(1, 'a' + i % 26) + std::string(i % 3, 'z'), i));
+
+	t_map	mp(v.begin(), v.end());
+
+	printWalks(mp);
+	printAt(mp, "a");
+	printAt(mp, "azz");
+	printAt(mp, "b");
+	std::cout << "lower(m): " << printKey(mp, mp.lower_bound("m"))
+		<< " | upper(m): " << printKey(mp, mp.upper_bound("m")) << std::endl;
+
+	// From a map, with its comparison
+	t_src	src(v.rbegin(), v.rend());
+	t_map	frozen(src);
+
+	printWalks(frozen);
+	std::cout << "comp: " << frozen.key_comp()("b", "a")
+		<< " | value_comp: " << frozen.value_comp()(*frozen.begin(), *++frozen.begin()) << std::endl;
+
+	// Copy, assignment and swap
+	t_map	copy(frozen);
+	t_map	empty;
+
+	printWalks(copy);
+	copy = mp;
+	printWalks(copy);
+	copy = empty;
+	printWalks(copy);
+	copy.swap(frozen);
+	printWalks(copy);
+	printWalks(frozen);
+	printAt(frozen, "a");
+	return (0);
+}
@@ -0,0 +1,44 @@
+#include "common.hpp"
+
+#define T1 int
+#define T2 int
+typedef TESTED_NAMESPACE::map<T1, T2> t_src;
+typedef t_frozen_map_<T1, T2> t_map;
+
+// Every key present, and every gap between them, below and above
+void	printLookups(t_map const &mp, int n)
+{
+	for (int k = -1; k <= 2 * n; ++k)
+	{
+		_pair<t_map::const_iterator, t_map::const_iterator>	eq = mp.equal_range(k);
+
+		std::cout << k << ": find " << printKey(mp, mp.find(k))
+			<< " | count " << mp.count(k)
+			<< " | lower " << printKey(mp, mp.lower_bound(k))
+			<< " | upper " << printKey(mp, mp.upper_bound(k))
+			<< " | equal " << printKey(mp, eq.first) << " " << printKey(mp, eq.second)
+			<< std::endl;
+	}
+	std::cout << "###############################################" << std::endl;
+}
+
+int		main(void)
+{
+	// Empty, a single node, and complete trees with one node short and
+	// one node over
+	const int	sizes[] = { 0, 1, 2, 3, 4, 7, 8, 15, 16, 31, 32, 63, 64, 127, 128, 255, 256 };
+
+	for (std::size_t s = 0; s < sizeof(sizes) / sizeof(*sizes); ++s)
+	{
+		t_src	src;
+
+		for (int i = 0; i < sizes[s]; ++i)
+			src[i * 2] = i * i;
+
+		t_map	mp(src);
+
+		printWalks(mp);
+		printLookups(mp, sizes[s]);
+	}
+	return (0);
+}
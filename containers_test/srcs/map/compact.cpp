@@ -0,0 +1,64 @@
+#define FT_RB_TREE_COMPACT
+#include "common.hpp"
+#include <vector>
+
+// The colors are packed into the parent pointers: every change of links
+// or colors goes through them
+#define T1 int
+#define T2 char
+typedef TESTED_NAMESPACE::map<T1, T2> t_map;
+typedef t_map::value_type T3;
+
+int		main(void)
+{
+	t_map	mp;
+
+	for (int i = 0; i < 2000; ++i)
+		mp.insert(T3((i * 7919) % 2000, 'a' + i % 26));
+	printDigest(mp, 101);
+	printValid(mp);
+
+	// Single erasures, of leaves and of nodes with two children
+	for (int i = 0; i < 2000; i += 3)
+		mp.erase(i);
+	for (t_map::iterator it = mp.begin(); it != mp.end();)
+		if (it->first % 5 == 0)
+			mp.erase(it++);
+		else
+			++it;
+	printDigest(mp, 101);
+	printValid(mp);
+
+	// Range erasures, by node and by split
+	mp.erase(mp.find(100), mp.find(130));
+	mp.erase(mp.lower_bound(500), mp.lower_bound(1500));
+	printDigest(mp, 31);
+	printValid(mp);
+
+	// Copies, swaps and sorted builds
+	t_map	cpy(mp);
+	t_map	other;
+
+	for (int i = 0; i < 10; ++i)
+		other[i * 1000] = 'z';
+	cpy.swap(other);
+	printDigest(cpy);
+	printValid(cpy);
+	printDigest(other, 101);
+	printValid(other);
+
+	std::vector<T3>	v;
+
+	for (int i = 0; i < 777; ++i)
+		v.push_back(T3(i, 'k'));
+#if !defined(USING_STD)
+	t_map	sorted(ft::sorted_unique, v.begin(), v.end());
+#else
+	t_map	sorted(v.begin(), v.end());
+#endif
+	printDigest(sorted, 101);
+	printValid(sorted);
+	mp.clear();
+	printValid(mp);
+	return (0);
+}
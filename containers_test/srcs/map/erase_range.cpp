@@ -0,0 +1,61 @@
+#include "common.hpp"
+
+#define T1 int
+#define T2 int
+typedef TESTED_NAMESPACE::map<T1, T2> t_map;
+typedef t_map::value_type T3;
+typedef t_map::iterator ft_iterator;
+
+void	fill(t_map &mp, int n)
+{
+	mp.clear();
+	for (int i = 0; i < n; ++i)
+		mp.insert(T3((i * 37) % n, i));
+}
+
+// Erases [first, last), given as positions, then checks that the rest
+// still takes insertions
+void	erase(t_map &mp, int first, int last)
+{
+	ft_iterator	it = mp.begin();
+	ft_iterator	ite;
+
+	std::advance(it, first);
+	ite = it;
+	std::advance(ite, last - first);
+	std::cout << "erase(" << first << ", " << last << ")" << std::endl;
+	mp.erase(it, ite);
+	printDigest(mp, 13);
+	printValid(mp);
+	for (int i = -3; i < 2000; i += 50)
+		mp.insert(T3(i, -i));
+	printDigest(mp, 13);
+	printValid(mp);
+}
+
+int		main(void)
+{
+	t_map	mp;
+
+	// Up to 16 nodes are erased one by one, more with two splits and a join
+	const int	ranges[][2] = {
+		{ 100, 116 }, { 100, 117 }, { 100, 400 }, { 0, 17 }, { 0, 600 },
+		{ 700, 1000 }, { 983, 1000 }, { 1, 999 }, { 499, 501 }, { 0, 1000 }
+	};
+
+	for (std::size_t r = 0; r < sizeof(ranges) / sizeof(*ranges); ++r)
+	{
+		fill(mp, 1000);
+		erase(mp, ranges[r][0], ranges[r][1]);
+	}
+
+	// Small maps, where the range is the whole map but for one node
+	for (int n = 17; n < 24; ++n)
+	{
+		fill(mp, n);
+		erase(mp, 1, n);
+		fill(mp, n);
+		erase(mp, 0, n - 1);
+	}
+	return (0);
+}
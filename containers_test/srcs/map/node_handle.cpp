@@ -0,0 +1,151 @@
+#include "common.hpp"
+
+#define T1 int
+#define T2 std::string
+typedef TESTED_NAMESPACE::map<T1, T2> t_map;
+typedef t_map::value_type T3;
+typedef t_map::iterator ft_iterator;
+
+// Set if a node was copied instead of being relinked: main() fails
+int		copied = 0;
+
+// C++98 std::map has no node handle: its emulation copies the pair and
+// erases it, as the node moved by ft keeps its pair
+#if !defined(USING_STD)
+_pair<ft_iterator, bool>	move_node(t_map &from, ft_iterator pos, t_map &to)
+{
+	t_map::node_type	nh = from.extract(pos);
+	T1 const			*key = &nh.key();
+
+	std::cout << "extracted: key " << nh.key() << " | value " << nh.mapped() << std::endl;
+
+	t_map::insert_return_type	ret = to.insert(nh);
+
+	std::cout << "node.empty(): " << ret.node.empty() << std::endl;
+	if (ret.inserted && &ret.position->first != key)
+		copied = 1;
+	if (!ret.inserted)
+	{
+		// The node is handed back with its pair, and goes back to from
+		std::cout << "handed back: key " << ret.node.key() << " | value " << ret.node.mapped() << std::endl;
+		from.insert(ret.node);
+	}
+	return _pair<ft_iterator, bool>(ret.position, ret.inserted);
+}
+
+_pair<ft_iterator, bool>	move_node(t_map &from, T1 const &k, t_map &to, T1 const &new_key)
+{
+	t_map::node_type	nh = from.extract(k);
+
+	std::cout << "extract(" << k << ").empty(): " << nh.empty() << std::endl;
+	if (nh.empty())
+	{
+		t_map::insert_return_type	ret = to.insert(nh);
+
+		return _pair<ft_iterator, bool>(ret.position, ret.inserted);
+	}
+	nh.key() = new_key;
+	nh.mapped() += " (moved)";
+
+	t_map::insert_return_type	ret = to.insert(nh);
+
+	if (!ret.inserted)
+		from.insert(ret.node);
+	return _pair<ft_iterator, bool>(ret.position, ret.inserted);
+}
+
+void	merge(t_map &to, t_map &from) { to.merge(from); }
+#else
+_pair<ft_iterator, bool>	move_node(t_map &from, ft_iterator pos, t_map &to)
+{
+	T3	v = *pos;
+
+	std::cout << "extracted: key " << v.first << " | value " << v.second << std::endl;
+	from.erase(pos);
+
+	_pair<ft_iterator, bool>	ret = to.insert(v);
+
+	std::cout << "node.empty(): " << ret.second << std::endl;
+	if (!ret.second)
+	{
+		std::cout << "handed back: key " << v.first << " | value " << v.second << std::endl;
+		from.insert(v);
+	}
+	return ret;
+}
+
+_pair<ft_iterator, bool>	move_node(t_map &from, T1 const &k, t_map &to, T1 const &new_key)
+{
+	ft_iterator	pos = from.find(k);
+
+	std::cout << "extract(" << k << ").empty(): " << (pos == from.end()) << std::endl;
+	if (pos == from.end())
+		return _pair<ft_iterator, bool>(to.end(), false);
+
+	T3	v(new_key, pos->second + " (moved)");
+
+	from.erase(pos);
+
+	_pair<ft_iterator, bool>	ret = to.insert(v);
+
+	if (!ret.second)
+		from.insert(v);
+	return ret;
+}
+
+void	merge(t_map &to, t_map &from)
+{
+	for (ft_iterator it = from.begin(); it != from.end();)
+	{
+		if (to.insert(*it).second)
+			from.erase(it++);
+		else
+			++it;
+	}
+}
+#endif
+
+template <typename T>
+void	printRet(T const &ret, t_map const &to)
+{
+	if (ret.first == to.end())
+		std::cout << "position: end()";
+	else
+		std::cout << "position: " << printPair(ret.first, false);
+	std::cout << " | inserted: " << ret.second << std::endl;
+}
+
+int		main(void)
+{
+	t_map	mp;
+	t_map	mp2;
+
+	for (int i = 0; i < 12; ++i)
+		mp.insert(T3(i, std::string(1, 'a' + i)));
+	mp2.insert(T3(1, "already there"));
+	mp2.insert(T3(20, "z"));
+
+	// An extracted node keeps its pair, and is inserted into mp2
+	printRet(move_node(mp, mp.begin(), mp2), mp2);
+	printRet(move_node(mp, --mp.end(), mp2), mp2);
+	printRet(move_node(mp, mp.find(5), mp2), mp2);
+	// Its key is already in mp2: the node is handed back
+	printRet(move_node(mp, mp.find(1), mp2), mp2);
+	// Its key can be changed before it is inserted
+	printRet(move_node(mp, 2, mp2, 30), mp2);
+	printRet(move_node(mp, 3, mp2, 20), mp2);
+	printRet(move_node(mp, 4, mp, -1), mp);
+	printRet(move_node(mp, 42, mp2, 0), mp2);
+	printSize(mp);
+	printSize(mp2);
+
+	// The pairs whose key is already in the target stay in the source
+	merge(mp2, mp);
+	printSize(mp);
+	printSize(mp2);
+	merge(mp, mp2);
+	merge(mp, mp2);
+	printSize(mp);
+	printSize(mp2);
+	return (copied);
+}
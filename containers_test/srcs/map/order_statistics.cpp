@@ -0,0 +1,112 @@
+#define FT_RB_TREE_ORDER_STATISTICS
+#include "common.hpp"
+#include <iterator>
+#include <vector>
+
+#define T1 int
+#define T2 int
+typedef TESTED_NAMESPACE::map<T1, T2> t_map;
+typedef t_map::value_type T3;
+typedef t_map::const_iterator ft_const_iterator;
+
+// C++98 std::map has no order statistics: they are counted by walking
+#if !defined(USING_STD)
+ft_const_iterator	select(t_map const &mp, std::size_t k) { return mp.select(k); }
+std::size_t			rank(t_map const &mp, T1 const &k) { return mp.rank(k); }
+long				distance(t_map const &mp, ft_const_iterator first, ft_const_iterator last)
+{ return mp.distance(first, last); }
+#else
+ft_const_iterator	select(t_map const &mp, std::size_t k)
+{
+	if (k >= mp.size())
+		return mp.end();
+
+	ft_const_iterator	it = mp.begin();
+
+	std::advance(it, k);
+	return it;
+}
+
+std::size_t			rank(t_map const &mp, T1 const &k)
+{ return std::distance(mp.begin(), mp.lower_bound(k)); }
+
+long				distance(t_map const &mp, ft_const_iterator first, ft_const_iterator last)
+{ return std::distance(mp.begin(), last) - std::distance(mp.begin(), first); }
+#endif
+
+// Every step-th element by select(), the rank of keys in and out of the
+// map, and distances both ways
+void	printStats(t_map const &mp, std::size_t step = 37)
+{
+	std::cout << "size: " << mp.size() << std::endl;
+	for (std::size_t k = 0; k <= mp.size(); k += step)
+	{
+		ft_const_iterator	it = select(mp, k);
+
+		if (it == mp.end())
+			std::cout << "select(" << k << "): end()" << std::endl;
+		else
+			std::cout << "select(" << k << "): " << printPair(it, false) << std::endl;
+	}
+	std::cout << "select(size): " << (select(mp, mp.size()) == mp.end()) << std::endl;
+	for (int key = -5; key < 3000; key += 271)
+		std::cout << "rank(" << key << "): " << rank(mp, key) << std::endl;
+	if (!mp.empty())
+	{
+		ft_const_iterator	mid = select(mp, mp.size() / 2);
+
+		std::cout << "distance: " << distance(mp, mp.begin(), mp.end())
+			<< " | " << distance(mp, mid, mp.end())
+			<< " | " << distance(mp, mp.end(), mid) << std::endl;
+	}
+	printValid(mp);
+	std::cout << "###############################################" << std::endl;
+}
+
+int		main(void)
+{
+	t_map	mp;
+
+	// The sizes are kept along every path that changes the tree
+	for (int i = 0; i < 2000; ++i)
+		mp.insert(T3((i * 7919) % 2000, i));
+	printStats(mp);
+	for (int i = 0; i < 2000; i += 3)
+		mp.erase(i);
+	for (int i = 2000; i < 2300; ++i)
+		mp.insert(mp.end(), T3(i, i));
+	printStats(mp);
+	mp.erase(mp.find(100), mp.find(110));
+	mp.erase(mp.lower_bound(500), mp.lower_bound(1500));
+	printStats(mp, 13);
+
+	// Built from sorted input, then through the set algebra
+	std::vector<T3>	v;
+
+	for (int i = 0; i < 1000; ++i)
+		v.push_back(T3(i * 3, -i));
+#if !defined(USING_STD)
+	t_map	other(ft::sorted_unique, v.begin(), v.end());
+#else
+	t_map	other(v.begin(), v.end());
+#endif
+	printStats(other);
+#if !defined(USING_STD)
+	mp.union_with(other);
+#else
+	mp.insert(other.begin(), other.end());
+	other.clear();
+#endif
+	printStats(mp);
+
+	// Nodes moved between maps
+	t_map	cpy(mp);
+
+	for (int i = 0; i < 2000; i += 10)
+		other[i] = i;
+	mp.swap(other);
+	printStats(mp, 11);
+	printStats(other);
+	printStats(cpy);
+	return (0);
+}
@@ -0,0 +1,110 @@
+#include "common.hpp"
+#if !defined(USING_STD)
+# include "parallel.hpp"
+#endif
+#include <algorithm>
+#include <iterator>
+#include <vector>
+
+#define T1 int
+#define T2 int
+typedef TESTED_NAMESPACE::map<T1, T2> t_map;
+typedef t_map::value_type T3;
+typedef std::pair<T1, T2> t_pair;
+
+enum e_op { UNION, INTERSECTION, DIFFERENCE };
+
+// The keys first + k * step, for k in [0, n), whose values tell which
+// map they come from
+void	fill(t_map &mp, int first, int step, int n, int tag)
+{
+	mp.clear();
+	for (int k = 0; k < n; ++k)
+		mp.insert(T3(first + k * step, tag));
+}
+
+bool	key_less(t_pair const &x, t_pair const &y) { return x.first < y.first; }
+
+std::vector<t_pair>	pairs(t_map const &mp)
+{
+	std::vector<t_pair>	v;
+
+	for (t_map::const_iterator it = mp.begin(); it != mp.end(); ++it)
+		v.push_back(t_pair(it->first, it->second));
+	return v;
+}
+
+// The result of the std algorithm on the same maps: on equal keys, the
+// pair comes from the first range, as this map keeps its own pairs
+std::vector<t_pair>	expected(t_map const &a, t_map const &b, e_op op)
+{
+	const std::vector<t_pair>	x = pairs(a);
+	const std::vector<t_pair>	y = pairs(b);
+	std::vector<t_pair>			v;
+
+	if (op == UNION)
+		std::set_union(x.begin(), x.end(), y.begin(), y.end(), std::back_inserter(v), key_less);
+	else if (op == INTERSECTION)
+		std::set_intersection(x.begin(), x.end(), y.begin(), y.end(), std::back_inserter(v), key_less);
+	else
+		std::set_difference(x.begin(), x.end(), y.begin(), y.end(), std::back_inserter(v), key_less);
+	return v;
+}
+
+// std has no parallel set algebra: the map takes the result of the
+// algorithm, and other is emptied, as ft leaves it
+void	apply(t_map &a, t_map &b, e_op op, unsigned threads)
+{
+#if !defined(USING_STD)
+	if (op == UNION)
+		TESTED_NAMESPACE::parallel_union(a, b, threads);
+	else if (op == INTERSECTION)
+		TESTED_NAMESPACE::parallel_intersection(a, b, threads);
+	else
+		TESTED_NAMESPACE::parallel_difference(a, b, threads);
+#else
+	(void)threads;
+	const std::vector<t_pair>	v = expected(a, b, op);
+
+	a.clear();
+	for (std::size_t i = 0; i < v.size(); ++i)
+		a.insert(a.end(), T3(v[i].first, v[i].second));
+	b.clear();
+#endif
+}
+
+void	test(int a_first, int a_step, int a_n, int b_first, int b_step, int b_n,
+			unsigned threads = 4)
+{
+	const char	*names[] = { "union", "intersection", "difference" };
+	t_map		a;
+	t_map		b;
+
+	for (int op = UNION; op <= DIFFERENCE; ++op)
+	{
+		fill(a, a_first, a_step, a_n, 1);
+		fill(b, b_first, b_step, b_n, 2);
+
+		const std::vector<t_pair>	v = expected(a, b, e_op(op));
+
+		std::cout << "\t-- " << names[op] << " --" << std::endl;
+		apply(a, b, e_op(op), threads);
+		std::cout << "matches: " << (pairs(a) == v) << " | other empty: " << b.empty() << std::endl;
+		printDigest(a, 997);
+		printValid(a);
+	}
+}
+
+int		main(void)
+{
+	// Subtrees of black height 12, the default cutoff, hold at least
+	// 4095 nodes: from a few tens of thousands of keys, the first levels
+	// of the recursion are forked
+	test(0, 2, 60000, 1, 3, 40000);			// interleaved, partly overlapping
+	test(0, 1, 100000, 50000, 1, 100000);	// overlapping halves
+	test(0, 1, 80000, 0, 4, 20000);			// a subset of every fourth key
+	test(0, 3, 50000, 0, 3, 50000, 1);		// one thread: never forked
+	test(0, 3, 50000, 0, 3, 50000, 0);		// one per processor
+	test(0, 1, 0, 0, 1, 50000);				// empty
+	return (0);
+}
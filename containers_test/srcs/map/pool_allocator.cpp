@@ -0,0 +1,69 @@
+#include "common.hpp"
+#include <sstream>
+
+#define T1 int
+#define T2 std::string
+
+// The nodes come from ft::pool_allocator, which std::map is compared with
+// std::allocator: the allocator must not change what the map holds
+#if !defined(USING_STD)
+# include "pool_allocator.hpp"
+typedef ft::pool_allocator<ft::pair<const T1, T2> >	t_alloc;
+#else
+typedef std::allocator<std::pair<const T1, T2> >	t_alloc;
+#endif
+
+typedef TESTED_NAMESPACE::map<T1, T2, std::less<T1>, t_alloc>	t_map;
+typedef t_map::value_type										T3;
+
+std::string	str(int i)
+{
+	std::ostringstream	o;
+
+	o << "v" << i;
+	return o.str();
+}
+
+int		main(void)
+{
+	t_map	mp;
+
+	// Enough nodes for several slabs
+	for (int i = 0; i < 3000; ++i)
+		mp.insert(T3((i * 7919) % 3000, str(i)));
+	printDigest(mp);
+
+	// Freed nodes go to the free list, and are handed out again
+	for (int i = 0; i < 3000; i += 3)
+		mp.erase(i);
+	printDigest(mp);
+	for (int i = 3000; i < 4000; ++i)
+		mp[i] = str(-i);
+	printDigest(mp);
+
+	// A copy has its own pool
+	t_map	cpy(mp);
+
+	mp.erase(mp.begin(), mp.find(2000));
+	printDigest(cpy);
+	printDigest(mp);
+
+	// Swapping swaps the pools along with the nodes
+	t_map	other;
+
+	for (int i = 0; i < 50; ++i)
+		other.insert(T3(i * 100, str(i)));
+	other.swap(mp);
+	printDigest(mp, 7);
+	printDigest(other);
+	mp = other;
+	printDigest(mp);
+
+	// Emptied and filled again
+	mp.clear();
+	printDigest(mp);
+	for (int i = 0; i < 100; ++i)
+		mp.insert(T3(i, str(i)));
+	printDigest(mp, 9);
+	return (0);
+}
@@ -0,0 +1,58 @@
+#include "common.hpp"
+#include <vector>
+
+#define T1 int
+#define T2 int
+typedef TESTED_NAMESPACE::map<T1, T2> t_map;
+typedef t_map::value_type T3;
+
+// C++98 std::map has no sorted_unique constructor: it is built from the
+// same range with the plain range constructor
+template <typename It>
+t_map	*build(It first, It last)
+{
+#if !defined(USING_STD)
+	return new t_map(ft::sorted_unique, first, last);
+#else
+	return new t_map(first, last);
+#endif
+}
+
+int		main(void)
+{
+	// Every size up to a few complete trees, then some larger ones
+	const int	sizes[] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 15, 16, 17, 31, 32, 33, 100, 1000, 4095, 4097 };
+
+	for (std::size_t s = 0; s < sizeof(sizes) / sizeof(*sizes); ++s)
+	{
+		std::vector<T3>	v;
+
+		for (int i = 0; i < sizes[s]; ++i)
+			v.push_back(T3(i * 2, -i));
+
+		t_map	*mp = build(v.begin(), v.end());
+
+		printDigest(*mp, 31);
+		printValid(*mp);
+		// The tree built must stand insertions and erasures
+		for (int i = -1; i < sizes[s] * 2; i += 3)
+			(*mp)[i] = i;
+		for (int i = 0; i < sizes[s] * 2; i += 4)
+			mp->erase(i);
+		printDigest(*mp, 31);
+		printValid(*mp);
+		delete mp;
+	}
+
+	// From a const range of another map
+	t_map	src;
+
+	for (int i = 0; i < 50; ++i)
+		src.insert(T3(i * i, i));
+
+	t_map	*mp = build(src.begin(), src.end());
+
+	printSize(*mp);
+	delete mp;
+	return (0);
+}
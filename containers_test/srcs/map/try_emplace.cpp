@@ -0,0 +1,159 @@
+#include "common.hpp"
+
+#define T1 int
+#define T2 std::string
+typedef TESTED_NAMESPACE::map<T1, T2> t_map;
+typedef t_map::value_type T3;
+typedef t_map::iterator ft_iterator;
+
+// Counts the mapped values built from their argument, not the copies
+struct counted
+{
+	static int	built;
+
+	counted() : value(0) {}
+	counted(int v) : value(v) { ++built; }
+
+	int		value;
+};
+
+int	counted::built = 0;
+
+// C++98 std::map has neither: find() then insert() gives the same map
+#if !defined(USING_STD)
+template <typename MAP, typename Arg>
+_pair<typename MAP::iterator, bool>
+	try_emplace(MAP &mp, typename MAP::key_type const &k, Arg const &arg)
+{ return mp.try_emplace(k, arg); }
+
+template <typename MAP, typename Arg>
+typename MAP::iterator
+	try_emplace(MAP &mp, typename MAP::iterator hint, typename MAP::key_type const &k, Arg const &arg)
+{ return mp.try_emplace(hint, k, arg); }
+
+template <typename MAP>
+_pair<typename MAP::iterator, bool>
+	try_emplace(MAP &mp, typename MAP::key_type const &k)
+{ return mp.try_emplace(k); }
+
+template <typename MAP, typename M>
+_pair<typename MAP::iterator, bool>
+	insert_or_assign(MAP &mp, typename MAP::key_type const &k, M const &obj)
+{ return mp.insert_or_assign(k, obj); }
+
+template <typename MAP, typename M>
+typename MAP::iterator
+	insert_or_assign(MAP &mp, typename MAP::iterator hint, typename MAP::key_type const &k, M const &obj)
+{ return mp.insert_or_assign(hint, k, obj); }
+#else
+template <typename MAP, typename Arg>
+_pair<typename MAP::iterator, bool>
+	try_emplace(MAP &mp, typename MAP::key_type const &k, Arg const &arg)
+{
+	typename MAP::iterator	it = mp.find(k);
+
+	if (it != mp.end())
+		return _pair<typename MAP::iterator, bool>(it, false);
+	return mp.insert(typename MAP::value_type(k, typename MAP::mapped_type(arg)));
+}
+
+template <typename MAP, typename Arg>
+typename MAP::iterator
+	try_emplace(MAP &mp, typename MAP::iterator hint, typename MAP::key_type const &k, Arg const &arg)
+{
+	typename MAP::iterator	it = mp.find(k);
+
+	if (it != mp.end())
+		return it;
+	return mp.insert(hint, typename MAP::value_type(k, typename MAP::mapped_type(arg)));
+}
+
+template <typename MAP>
+_pair<typename MAP::iterator, bool>
+	try_emplace(MAP &mp, typename MAP::key_type const &k)
+{
+	typename MAP::iterator	it = mp.find(k);
+
+	if (it != mp.end())
+		return _pair<typename MAP::iterator, bool>(it, false);
+	return mp.insert(typename MAP::value_type(k, typename MAP::mapped_type()));
+}
+
+template <typename MAP, typename M>
+_pair<typename MAP::iterator, bool>
+	insert_or_assign(MAP &mp, typename MAP::key_type const &k, M const &obj)
+{
+	_pair<typename MAP::iterator, bool>	res = try_emplace(mp, k, obj);
+
+	if (!res.second)
+		res.first->second = obj;
+	return res;
+}
+
+template <typename MAP, typename M>
+typename MAP::iterator
+	insert_or_assign(MAP &mp, typename MAP::iterator hint, typename MAP::key_type const &k, M const &obj)
+{
+	typename MAP::iterator	it = mp.find(k);
+
+	if (it != mp.end())
+	{
+		it->second = obj;
+		return it;
+	}
+	return mp.insert(hint, typename MAP::value_type(k, obj));
+}
+#endif /* !defined(USING_STD) */
+
+template <typename T>
+void	printRet(T const &ret)
+{
+	std::cout << "returned: " << printPair(ret.first, false) << " | inserted: " << ret.second << std::endl;
+}
+
+int		main(void)
+{
+	t_map	mp;
+
+	std::cout << "\t-- try_emplace --" << std::endl;
+	printRet(try_emplace(mp, 42, "forty-two"));
+	printRet(try_emplace(mp, 42, "not assigned"));
+	printRet(try_emplace(mp, 21, std::string(3, 'x')));
+	printRet(try_emplace(mp, 10));
+	printRet(try_emplace(mp, 10));
+	std::cout << "hint: " << printPair(try_emplace(mp, mp.end(), 50, "end"), false) << std::endl;
+	std::cout << "hint: " << printPair(try_emplace(mp, mp.begin(), 1, "begin"), false) << std::endl;
+	std::cout << "hint: " << printPair(try_emplace(mp, mp.begin(), 30, "far"), false) << std::endl;
+	std::cout << "hint: " << printPair(try_emplace(mp, mp.find(42), 42, "present"), false) << std::endl;
+	printSize(mp);
+
+	std::cout << "\t-- insert_or_assign --" << std::endl;
+	printRet(insert_or_assign(mp, 42, "assigned"));
+	printRet(insert_or_assign(mp, 43, "inserted"));
+	printRet(insert_or_assign(mp, 10, std::string("was empty")));
+	std::cout << "hint: " << printPair(insert_or_assign(mp, mp.end(), 100, "end"), false) << std::endl;
+	std::cout << "hint: " << printPair(insert_or_assign(mp, mp.end(), 1, "assigned at begin"), false) << std::endl;
+	std::cout << "hint: " << printPair(insert_or_assign(mp, mp.find(21), 22, "next to 21"), false) << std::endl;
+	printSize(mp);
+
+	// The mapped value is only built when the key is absent
+	TESTED_NAMESPACE::map<T1, counted>	cmp;
+
+	for (int i = 0; i < 100; ++i)
+		try_emplace(cmp, i % 10, i);
+	std::cout << "built: " << counted::built << " | size: " << cmp.size() << std::endl;
+	for (int i = 0; i < 10; ++i)
+		std::cout << cmp[i].value << " ";
+	std::cout << std::endl;
+	for (int i = 0; i < 20; ++i)
+		insert_or_assign(cmp, i, counted(-i));
+	for (int i = 0; i < 20; ++i)
+		std::cout << cmp[i].value << " ";
+	std::cout << std::endl;
+
+	// operator[] goes through try_emplace()
+	mp[7] = "seven";
+	mp[42] += "!";
+	printSize(mp);
+	return (0);
+}
@@ -0,0 +1,56 @@
+#include "common.hpp"
+
+#define T1 int
+#define T2 std::string
+typedef TESTED_NAMESPACE::multimap<T1, T2>::value_type T3;
+typedef TESTED_NAMESPACE::multimap<T1, T2>::iterator ft_iterator;
+
+TESTED_NAMESPACE::multimap<T1, T2> mp;
+
+void	ft_equal_range(T1 const &k)
+{
+	TESTED_NAMESPACE::pair<ft_iterator, ft_iterator> ret = mp.equal_range(k);
+
+	std::cout << "equal_range(" << k << "): " << std::distance(ret.first, ret.second)
+		<< " pairs, count " << mp.count(k) << std::endl;
+	for (; ret.first != ret.second; ++ret.first)
+		std::cout << "- " << printPair(ret.first, false) << std::endl;
+	if (ret.second != mp.end())
+		std::cout << "then " << printPair(ret.second);
+	else
+		std::cout << "then end()" << std::endl;
+}
+
+int		main(void)
+{
+	for (int i = 0; i < 30; ++i)
+		mp.insert(T3(i % 7, std::string(1, 'a' + i)));
+	for (int k = -1; k <= 7; ++k)
+		ft_equal_range(k);
+
+	// The first, a middle and the last of a run of equal keys
+	mp.erase(mp.find(3));
+	ft_equal_range(3);
+	mp.erase(++mp.lower_bound(4));
+	ft_equal_range(4);
+	mp.erase(--mp.upper_bound(5));
+	ft_equal_range(5);
+
+	// All the pairs of a key, by key and by range
+	std::cout << "erase(2): " << mp.erase(2) << std::endl;
+	ft_equal_range(2);
+	ft_equal_range(1);
+	ft_equal_range(3);
+	mp.erase(mp.lower_bound(6), mp.upper_bound(6));
+	ft_equal_range(6);
+	ft_equal_range(5);
+
+	// Part of a run, then more of the same key
+	mp.erase(mp.lower_bound(0), ++mp.lower_bound(0));
+	mp.insert(T3(0, "new"));
+	mp.insert(mp.begin(), T3(0, "newer"));
+	ft_equal_range(0);
+
+	printSize(mp);
+	return (0);
+}
@@ -0,0 +1,50 @@
+#include "common.hpp"
+
+#define T1 int
+#define T2 std::string
+typedef TESTED_NAMESPACE::multimap<T1, T2>::value_type T3;
+typedef TESTED_NAMESPACE::multimap<T1, T2>::iterator ft_iterator;
+
+static int iter = 0;
+
+template <typename MAP>
+void	ft_insert(MAP &mp, ft_iterator hint, T3 const &param)
+{
+	std::cout << "\t-- [" << iter++ << "] --" << std::endl;
+	ft_iterator ret = mp.insert(hint, param);
+	std::cout << "insert return: " << printPair(ret);
+	std::cout << "Created new node: " << (ret != hint) << std::endl;
+}
+
+int		main(void)
+{
+	TESTED_NAMESPACE::multimap<T1, T2> mp;
+
+	// A sorted run, with equal keys, appended at end()
+	mp.insert(mp.end(), T3(10, "a"));
+	mp.insert(mp.end(), T3(20, "b"));
+	mp.insert(mp.end(), T3(20, "c"));
+	mp.insert(mp.end(), T3(20, "d"));
+	mp.insert(mp.end(), T3(30, "e"));
+	for (int i = 0; i < 20; ++i)
+		mp.insert(mp.end(), T3(40 + i / 3, "run"));
+	printSize(mp);
+
+	// Right hints
+	ft_insert(mp, mp.begin(), T3(5, "before begin"));
+	ft_insert(mp, mp.begin(), T3(5, "equal to begin"));
+	ft_insert(mp, mp.find(30), T3(20, "before 30"));
+	ft_insert(mp, mp.find(30), T3(25, "between 20 and 30"));
+	ft_insert(mp, mp.upper_bound(20), T3(20, "after the last 20"));
+	ft_insert(mp, mp.end(), T3(46, "equal to the last"));
+
+	// Wrong hints
+	ft_insert(mp, mp.begin(), T3(100, "far from begin"));
+	ft_insert(mp, mp.end(), T3(0, "far from end"));
+	ft_insert(mp, mp.find(10), T3(41, "far from 10"));
+	ft_insert(mp, mp.find(40), T3(20, "far from 40"));
+
+	printSize(mp);
+	printReverse(mp);
+	return (0);
+}
@@ -0,0 +1,93 @@
+#include "common.hpp"
+
+#define T1 int
+#define T2 std::string
+typedef TESTED_NAMESPACE::multimap<T1, T2> t_map;
+typedef t_map::value_type T3;
+typedef t_map::iterator ft_iterator;
+
+// C++98 std::multimap has no node handle: its emulation copies the pair
+// and erases it, as the node moved by ft keeps its pair
+#if !defined(USING_STD)
+ft_iterator	move_node(t_map &from, ft_iterator pos, t_map &to)
+{
+	t_map::node_type nh = from.extract(pos);
+
+	std::cout << "extracted: key " << nh.key() << " | value " << nh.mapped() << std::endl;
+	return to.insert(nh);
+}
+
+ft_iterator	move_node(t_map &from, T1 const &k, t_map &to, T1 const &new_key)
+{
+	t_map::node_type nh = from.extract(k);
+
+	std::cout << "extract(" << k << ").empty(): " << nh.empty() << std::endl;
+	if (nh.empty())
+		return to.insert(nh);
+	nh.key() = new_key;
+	nh.mapped() += " (moved)";
+	return to.insert(nh);
+}
+
+void	merge(t_map &to, t_map &from) { to.merge(from); }
+#else
+ft_iterator	move_node(t_map &from, ft_iterator pos, t_map &to)
+{
+	T3 v = *pos;
+
+	std::cout << "extracted: key " << v.first << " | value " << v.second << std::endl;
+	from.erase(pos);
+	return to.insert(v);
+}
+
+ft_iterator	move_node(t_map &from, T1 const &k, t_map &to, T1 const &new_key)
+{
+	ft_iterator pos = from.find(k);
+
+	std::cout << "extract(" << k << ").empty(): " << (pos == from.end()) << std::endl;
+	if (pos == from.end())
+		return to.end();
+
+	T3 v(new_key, pos->second + " (moved)");
+
+	from.erase(pos);
+	return to.insert(v);
+}
+
+void	merge(t_map &to, t_map &from)
+{
+	to.insert(from.begin(), from.end());
+	from.clear();
+}
+#endif
+
+int		main(void)
+{
+	t_map	mp;
+	t_map	mp2;
+
+	for (int i = 0; i < 12; ++i)
+		mp.insert(T3(i % 4, std::string(1, 'a' + i)));
+	mp2.insert(T3(1, "already there"));
+	mp2.insert(T3(9, "z"));
+
+	// Nodes keep their pair, and join those with an equal key
+	std::cout << "inserted: " << printPair(move_node(mp, mp.begin(), mp2));
+	std::cout << "inserted: " << printPair(move_node(mp, --mp.end(), mp2));
+	std::cout << "inserted: " << printPair(move_node(mp, mp.find(1), mp2));
+	std::cout << "inserted: " << printPair(move_node(mp, 2, mp2, 9));
+	std::cout << "inserted: " << printPair(move_node(mp, 2, mp, -1));
+	std::cout << "is end(): " << (move_node(mp, 42, mp2, 0) == mp2.end()) << std::endl;
+	printSize(mp);
+	printSize(mp2);
+
+	// Every pair moves, next to those with an equal key
+	merge(mp2, mp);
+	printSize(mp);
+	printSize(mp2);
+	merge(mp, mp2);
+	merge(mp, mp2);
+	printSize(mp);
+	printSize(mp2);
+	return (0);
+}
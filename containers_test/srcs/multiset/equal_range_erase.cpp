@@ -0,0 +1,56 @@
+#include "common.hpp"
+
+#define T1 int
+typedef TESTED_NAMESPACE::multiset<T1>::iterator ft_iterator;
+
+TESTED_NAMESPACE::multiset<T1> st;
+
+void	ft_equal_range(T1 const &k)
+{
+	TESTED_NAMESPACE::pair<ft_iterator, ft_iterator> ret = st.equal_range(k);
+
+	std::cout << "equal_range(" << k << "): " << std::distance(ret.first, ret.second)
+		<< " elements, count " << st.count(k) << std::endl;
+	if (ret.first != st.begin())
+		std::cout << "after " << printPair(--ret.first);
+	else
+		std::cout << "from begin()" << std::endl;
+	if (ret.second != st.end())
+		std::cout << "then " << printPair(ret.second);
+	else
+		std::cout << "then end()" << std::endl;
+}
+
+int		main(void)
+{
+	for (int i = 0; i < 30; ++i)
+		st.insert(i % 7);
+	for (int k = -1; k <= 7; ++k)
+		ft_equal_range(k);
+
+	// The first, a middle and the last of a run of equal elements
+	st.erase(st.find(3));
+	ft_equal_range(3);
+	st.erase(++st.lower_bound(4));
+	ft_equal_range(4);
+	st.erase(--st.upper_bound(5));
+	ft_equal_range(5);
+
+	// All the elements equal to a key, by key and by range
+	std::cout << "erase(2): " << st.erase(2) << std::endl;
+	ft_equal_range(2);
+	ft_equal_range(1);
+	ft_equal_range(3);
+	st.erase(st.lower_bound(6), st.upper_bound(6));
+	ft_equal_range(6);
+	ft_equal_range(5);
+
+	// Part of a run, then more of the same key
+	st.erase(st.lower_bound(0), ++st.lower_bound(0));
+	st.insert(0);
+	st.insert(st.begin(), 0);
+	ft_equal_range(0);
+
+	printSize(st);
+	return (0);
+}
@@ -0,0 +1,55 @@
+#include "common.hpp"
+
+// Strings are equivalent when they start with the same letter, so that
+// the output shows where equivalent elements go
+struct first_letter
+{
+	bool operator()(std::string const &x, std::string const &y) const
+	{ return x.substr(0, 1) < y.substr(0, 1); }
+};
+
+#define T1 std::string
+typedef TESTED_NAMESPACE::multiset<T1, first_letter> t_set;
+typedef t_set::iterator ft_iterator;
+
+static int iter = 0;
+
+void	ft_insert(t_set &st, ft_iterator hint, T1 const &param)
+{
+	std::cout << "\t-- [" << iter++ << "] --" << std::endl;
+	ft_iterator ret = st.insert(hint, param);
+	std::cout << "insert return: " << printPair(ret);
+	std::cout << "Created new node: " << (ret != hint) << std::endl;
+}
+
+int		main(void)
+{
+	t_set	st;
+
+	// A sorted run, with equivalent elements, appended at end()
+	st.insert(st.end(), "a");
+	st.insert(st.end(), "b1");
+	st.insert(st.end(), "b2");
+	st.insert(st.end(), "b3");
+	st.insert(st.end(), "c");
+	for (int i = 0; i < 20; ++i)
+		st.insert(st.end(), std::string(1, 'd' + i / 3) + "run");
+	printSize(st);
+
+	// Right hints
+	ft_insert(st, st.begin(), "A before begin");
+	ft_insert(st, st.begin(), "A equal to begin");
+	ft_insert(st, st.find("c"), "b before c");
+	ft_insert(st, st.find("c"), "bz between b and c");
+	ft_insert(st, st.upper_bound("b"), "b after the last b");
+	ft_insert(st, st.end(), "j equal to the last");
+
+	// Wrong hints
+	ft_insert(st, st.begin(), "z far from begin");
+	ft_insert(st, st.end(), "0 far from end");
+	ft_insert(st, st.find("a"), "f far from a");
+	ft_insert(st, st.find("e"), "b far from e");
+
+	printSize(st);
+	return (0);
+}
@@ -0,0 +1,98 @@
+#include "common.hpp"
+
+// Strings are equivalent when they start with the same letter, so that
+// the output shows where equivalent elements go
+struct first_letter
+{
+	bool operator()(std::string const &x, std::string const &y) const
+	{ return x.substr(0, 1) < y.substr(0, 1); }
+};
+
+#define T1 std::string
+typedef TESTED_NAMESPACE::multiset<T1, first_letter> t_set;
+typedef t_set::iterator ft_iterator;
+
+// C++98 std::multiset has no node handle: its emulation copies the
+// element and erases it, as the node moved by ft keeps its element
+#if !defined(USING_STD)
+ft_iterator	move_node(t_set &from, ft_iterator pos, t_set &to)
+{
+	t_set::node_type nh = from.extract(pos);
+
+	std::cout << "extracted: " << nh.value() << std::endl;
+	return to.insert(nh);
+}
+
+ft_iterator	move_node(t_set &from, T1 const &k, t_set &to, T1 const &new_value)
+{
+	t_set::node_type nh = from.extract(k);
+
+	std::cout << "extract(" << k << ").empty(): " << nh.empty() << std::endl;
+	if (nh.empty())
+		return to.insert(nh);
+	nh.value() = new_value + " (was " + nh.value() + ")";
+	return to.insert(nh);
+}
+
+void	merge(t_set &to, t_set &from) { to.merge(from); }
+#else
+ft_iterator	move_node(t_set &from, ft_iterator pos, t_set &to)
+{
+	T1 v = *pos;
+
+	std::cout << "extracted: " << v << std::endl;
+	from.erase(pos);
+	return to.insert(v);
+}
+
+ft_iterator	move_node(t_set &from, T1 const &k, t_set &to, T1 const &new_value)
+{
+	ft_iterator pos = from.find(k);
+
+	std::cout << "extract(" << k << ").empty(): " << (pos == from.end()) << std::endl;
+	if (pos == from.end())
+		return to.end();
+
+	T1 v = new_value + " (was " + *pos + ")";
+
+	from.erase(pos);
+	return to.insert(v);
+}
+
+void	merge(t_set &to, t_set &from)
+{
+	to.insert(from.begin(), from.end());
+	from.clear();
+}
+#endif
+
+int		main(void)
+{
+	t_set	st;
+	t_set	st2;
+
+	for (int i = 0; i < 12; ++i)
+		st.insert(std::string(1, 'a' + i % 4) + std::string(1, 'a' + i));
+	st2.insert("b already there");
+	st2.insert("z");
+
+	// Nodes keep their element, and join those equivalent to it
+	std::cout << "inserted: " << printPair(move_node(st, st.begin(), st2));
+	std::cout << "inserted: " << printPair(move_node(st, --st.end(), st2));
+	std::cout << "inserted: " << printPair(move_node(st, st.find("b"), st2));
+	std::cout << "inserted: " << printPair(move_node(st, "c", st2, "z"));
+	std::cout << "inserted: " << printPair(move_node(st, "c", st, "0"));
+	std::cout << "is end(): " << (move_node(st, "x", st2, "y") == st2.end()) << std::endl;
+	printSize(st);
+	printSize(st2);
+
+	// Every element moves, next to those equivalent to it
+	merge(st2, st);
+	printSize(st);
+	printSize(st2);
+	merge(st, st2);
+	merge(st, st2);
+	printSize(st);
+	printSize(st2);
+	return (0);
+}
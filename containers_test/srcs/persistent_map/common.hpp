@@ -0,0 +1,64 @@
+#include "../base.hpp"
+#include <map>
+#if !defined(USING_STD)
+# include "persistent_map.hpp"
+# define t_persistent_map_ TESTED_NAMESPACE::persistent_map
+#else
+// std has no persistent map: a std::map whose snapshots are full copies
+// must hold the same contents
+template <class Key, class T, class Compare = std::less<Key> >
+class persistent_map : public std::map<Key, T, Compare>
+{
+	typedef std::map<Key, T, Compare>	base;
+
+	public:
+		typedef typename base::key_type		key_type;
+		typedef typename base::mapped_type	mapped_type;
+		typedef typename base::value_type	value_type;
+		typedef typename base::iterator		iterator;
+		typedef base						snapshot_type;
+
+		persistent_map(void) : base() {}
+		template <class It>
+		persistent_map(It first, It last) : base(first, last) {}
+		explicit persistent_map(const snapshot_type &s) : base(s) {}
+
+		snapshot_type	snapshot(void) const { return *this; }
+
+		std::pair<iterator, bool>	insert_or_assign(const key_type &k, const mapped_type &obj)
+		{
+			std::pair<iterator, bool> ret = this->insert(value_type(k, obj));
+
+			if (!ret.second)
+				ret.first->second = obj;
+			return ret;
+		}
+};
+# define t_persistent_map_ persistent_map
+#endif /* !defined(STD) */
+
+#define _pair TESTED_NAMESPACE::pair
+
+template <typename T>
+std::string	printPair(const T &iterator, bool nl = true, std::ostream &o = std::cout)
+{
+	o << "key: " << iterator->first << " | value: " << iterator->second;
+	if (nl)
+		o << std::endl;
+	return ("");
+}
+
+// Works the same on a map and on a snapshot
+template <typename T_MAP>
+void	printSize(T_MAP const &mp, bool print_content = 1)
+{
+	std::cout << "size: " << mp.size() << std::endl;
+	if (print_content)
+	{
+		typename T_MAP::const_iterator it = mp.begin(), ite = mp.end();
+		std::cout << std::endl << "Content is:" << std::endl;
+		for (; it != ite; ++it)
+			std::cout << "- " << printPair(it, false) << std::endl;
+	}
+	std::cout << "###############################################" << std::endl;
+}
@@ -0,0 +1,94 @@
+#include "common.hpp"
+#include <vector>
+
+#define T1 int
+#define T2 std::string
+typedef t_persistent_map_<T1, T2> t_map;
+typedef t_map::snapshot_type t_snapshot;
+typedef t_map::value_type T3;
+
+template <typename T_MAP>
+void	printLookups(T_MAP const &mp)
+{
+	for (int k = 0; k < 12; k += 3)
+	{
+		std::cout << k << ": count " << mp.count(k);
+		if (mp.find(k) != mp.end())
+			std::cout << " | at " << mp.at(k);
+		if (mp.lower_bound(k) != mp.end())
+			std::cout << " | lower " << mp.lower_bound(k)->first;
+		if (mp.upper_bound(k) != mp.end())
+			std::cout << " | upper " << mp.upper_bound(k)->first;
+		std::cout << std::endl;
+	}
+}
+
+int		main(void)
+{
+	t_map					mp;
+	std::vector<t_snapshot>	versions;
+
+	// Every change is followed by a snapshot: none of them may see the
+	// changes made after it was taken
+	versions.push_back(mp.snapshot());
+	for (int i = 0; i < 10; ++i)
+		mp.insert(T3(i, std::string(i + 1, 'a' + i)));
+	versions.push_back(mp.snapshot());
+
+	std::cout << "insert existing: " << mp.insert(T3(4, "zz")).second << std::endl;
+	_pair<t_map::iterator, bool> ret = mp.insert_or_assign(4, "replaced");
+	std::cout << "insert_or_assign existing: " << ret.second << " | " << ret.first->second << std::endl;
+	ret = mp.insert_or_assign(20, "new");
+	std::cout << "insert_or_assign new: " << ret.second << " | " << ret.first->second << std::endl;
+	versions.push_back(mp.snapshot());
+
+	std::cout << "erase: " << mp.erase(3);
+	std::cout << " " << mp.erase(3) << std::endl;
+	mp.erase(mp.find(0));
+	mp.erase(mp.find(9));
+	versions.push_back(mp.snapshot());
+
+	// A copy of the map changes on its own, and so does a map made from
+	// a snapshot
+	t_map	copy(mp);
+	t_map	from(versions[1]);
+
+	copy.insert_or_assign(5, "copy");
+	copy.erase(6);
+	from.clear();
+	from.insert(T3(42, "from"));
+	mp.insert_or_assign(7, "seven");
+	versions.push_back(mp.snapshot());
+
+	// The map goes away, its snapshots stay
+	t_map	*tmp = new t_map(mp);
+	t_snapshot	last = tmp->snapshot();
+
+	tmp->clear();
+	delete tmp;
+	mp.clear();
+	versions.push_back(mp.snapshot());
+
+	for (std::size_t i = 0; i < versions.size(); ++i)
+	{
+		std::cout << "version " << i << std::endl;
+		printSize(versions[i]);
+		printLookups(versions[i]);
+	}
+	printSize(copy);
+	printSize(from);
+	printSize(last);
+	printSize(mp);
+
+	// Snapshots copy and swap like values
+	t_snapshot	a(versions[2]);
+	t_snapshot	b;
+
+	a.swap(b);
+	printSize(a);
+	printSize(b);
+	b = versions[3];
+	printSize(b);
+	printSize(versions[2]);
+	return (0);
+}
@@ -0,0 +1,57 @@
+#include "common.hpp"
+#include <vector>
+
+#define T1 int
+#define T2 int
+typedef t_persistent_map_<T1, T2> t_map;
+typedef t_map::snapshot_type t_snapshot;
+typedef t_map::value_type T3;
+
+// Sum and count, both ways, for maps too large to print
+template <typename T_MAP>
+void	printDigest(T_MAP const &mp)
+{
+	long	sum = 0;
+	long	weighted = 0;
+	long	i = 0;
+
+	for (typename T_MAP::const_iterator it = mp.begin(); it != mp.end(); ++it, ++i)
+	{
+		sum += it->second;
+		weighted += i * it->first;
+	}
+	for (typename T_MAP::const_reverse_iterator it = mp.rbegin(); it != mp.rend(); ++it)
+		--i;
+	std::cout << "size: " << mp.size() << " | sum: " << sum
+		<< " | weighted: " << weighted << " | walks: " << (i == 0) << std::endl;
+}
+
+int		main(void)
+{
+	t_map					mp;
+	std::vector<t_snapshot>	versions;
+	unsigned				seed = 42;
+
+	// Many rebalancings, with snapshots sharing most of their nodes
+	for (int i = 0; i < 3000; ++i)
+	{
+		seed = seed * 1103515245 + 12345;
+
+		const int	k = (seed >> 8) % 1000;
+
+		if (i % 3 == 2)
+			mp.erase(k);
+		else if (i % 5 == 0)
+			mp.insert_or_assign(k, i);
+		else
+			mp.insert(T3(k, -i));
+		if (i % 250 == 0)
+			versions.push_back(mp.snapshot());
+	}
+	versions.push_back(mp.snapshot());
+	mp.clear();
+	for (std::size_t i = 0; i < versions.size(); ++i)
+		printDigest(versions[i]);
+	printDigest(mp);
+	return (0);
+}
@@ -0,0 +1,123 @@
+#include "common.hpp"
+#include <vector>
+
+#if !defined(USING_STD)
+# define t_heap_ TESTED_NAMESPACE::indexed_priority_queue
+#else
+// std has no indexed heap: a vector whose erased elements are marked,
+// searched whole for its top, pops the same values
+template <class T, class Compare = std::less<T> >
+class indexed_heap
+{
+	public:
+		typedef std::size_t	size_type;
+		typedef std::size_t	handle_type;
+
+		explicit indexed_heap(const Compare& x = Compare()) : _size(0), _comp(x) {}
+
+		bool		empty() const { return _size == 0; }
+		size_type	size() const { return _size; }
+		const T&	top() const { return _values[top_handle()]; }
+		bool		contains(handle_type h) const { return h < _in.size() && _in[h]; }
+		const T&	get(handle_type h) const { return _values[h]; }
+
+		handle_type	top_handle() const
+		{
+			handle_type t = _in.size();
+
+			for (handle_type h = 0; h < _in.size(); ++h)
+				if (_in[h] && (t == _in.size() || _comp(_values[t], _values[h])))
+					t = h;
+			return t;
+		}
+
+		handle_type	push(const T& x)
+		{
+			_values.push_back(x);
+			_in.push_back(true);
+			++_size;
+			return _values.size() - 1;
+		}
+
+		void	pop() { erase(top_handle()); }
+		void	erase(handle_type h) { _in[h] = false; --_size; }
+		void	decrease_key(handle_type h, const T& x) { _values[h] = x; }
+		void	update(handle_type h, const T& x) { _values[h] = x; }
+
+	private:
+		std::vector<T>		_values;
+		std::vector<bool>	_in;
+		size_type			_size;
+		Compare				_comp;
+};
+# define t_heap_ indexed_heap
+#endif /* !defined(USING_STD) */
+
+template <typename T_HEAP>
+void	printTop(T_HEAP &heap)
+{
+	std::cout << "size: " << heap.size() << std::endl;
+	std::cout << std::endl << "Popped in order:" << std::endl;
+	while (!heap.empty()) {
+		std::cout << "- " << heap.top() << std::endl;
+		heap.pop();
+	}
+	std::cout << "###############################################" << std::endl;
+}
+
+int		main(void)
+{
+	// A min-heap, as in Dijkstra's algorithm
+	t_heap_<int, std::greater<int> >	heap;
+	std::vector<std::size_t>			h;
+
+	for (int i = 0; i < 40; ++i)
+		h.push_back(heap.push(100 + (i * 17) % 41));
+	std::cout << "top: " << heap.top() << std::endl;
+
+	// Towards the top only
+	heap.decrease_key(h[5], 3);
+	heap.decrease_key(h[30], 50);
+	heap.decrease_key(h[12], heap.get(h[12]) - 1);
+	std::cout << "top after decrease_key: " << heap.top() << std::endl;
+	std::cout << "get(h[30]): " << heap.get(h[30]) << std::endl;
+
+	// Anywhere, both ways
+	heap.update(h[5], 1000);
+	heap.update(h[0], 1);
+	heap.update(h[39], 999);
+	heap.update(h[20], 0);
+	std::cout << "top after update: " << heap.top() << std::endl;
+
+	// The top, a leaf, the last element, and elements in between
+	heap.erase(h[20]);
+	heap.erase(h[39]);
+	heap.erase(h[7]);
+	heap.erase(h[25]);
+	std::cout << "top after erase: " << heap.top() << std::endl;
+	std::cout << "contains(h[7]): " << heap.contains(h[7]) << std::endl;
+	std::cout << "contains(h[8]): " << heap.contains(h[8]) << std::endl;
+
+	// The other elements keep their handles while the heap changes
+	for (int i = 0; i < 10; ++i)
+		heap.push(200 - i);
+	heap.update(h[8], 2);
+	heap.decrease_key(h[9], -5);
+	std::cout << "get(h[8]): " << heap.get(h[8]) << std::endl;
+	std::cout << "get(h[9]): " << heap.get(h[9]) << std::endl;
+	printTop(heap);
+
+	// A max-heap of strings
+	t_heap_<std::string>	str_heap;
+	std::size_t				salut = str_heap.push("salut");
+	std::size_t				super = str_heap.push("super");
+
+	str_heap.push("tu vas bien?");
+	str_heap.push("et toi?");
+	str_heap.update(salut, "zzz");
+	str_heap.erase(super);
+	str_heap.push("abc");
+	printTop(str_heap);
+
+	return (0);
+}
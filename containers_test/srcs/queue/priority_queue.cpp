@@ -0,0 +1,48 @@
+#include "common.hpp"
+
+#define TESTED_TYPE foo<int>
+#define t_queue_ TESTED_NAMESPACE::priority_queue<TESTED_TYPE>
+
+template <typename T_QUEUE>
+void	printTop(T_QUEUE &qu_)
+{
+	std::cout << "size: " << qu_.size() << std::endl;
+	std::cout << std::endl << "Popped in order:" << std::endl;
+	while (!qu_.empty()) {
+		std::cout << "- " << qu_.top() << std::endl;
+		qu_.pop();
+	}
+	std::cout << "###############################################" << std::endl;
+}
+
+int		main(void)
+{
+	t_queue_	qu_;
+
+	std::cout << "empty: " << qu_.empty() << std::endl;
+	std::cout << "size: " << qu_.size() << std::endl;
+
+	qu_.push(41);
+	qu_.push(29);
+	qu_.push(10);
+	qu_.push(42);
+	qu_.push(42);
+	qu_.push(-3);
+	std::cout << "top: " << qu_.top() << std::endl;
+	qu_.pop();
+	std::cout << "top after pop: " << qu_.top() << std::endl;
+	qu_.push(100);
+	std::cout << "top after push: " << qu_.top() << std::endl;
+	printTop(qu_);
+
+	// Enough elements for a few levels of the heap
+	for (int i = 0; i < 200; ++i)
+		qu_.push((i * 7919) % 211);
+	for (int i = 0; i < 150; ++i)
+		qu_.pop();
+	for (int i = 0; i < 20; ++i)
+		qu_.push(i * 3);
+	printTop(qu_);
+
+	return (0);
+}
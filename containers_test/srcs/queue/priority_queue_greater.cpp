@@ -0,0 +1,66 @@
+#include "common.hpp"
+#include <deque>
+#include <vector>
+
+#define TESTED_TYPE int
+typedef std::deque<TESTED_TYPE> container_type;
+#define t_queue_ TESTED_NAMESPACE::priority_queue<TESTED_TYPE, container_type, std::greater<TESTED_TYPE> >
+
+template <typename T_QUEUE>
+void	printTop(T_QUEUE &qu_)
+{
+	std::cout << "size: " << qu_.size() << std::endl;
+	std::cout << std::endl << "Popped in order:" << std::endl;
+	while (!qu_.empty()) {
+		std::cout << "- " << qu_.top() << std::endl;
+		qu_.pop();
+	}
+	std::cout << "###############################################" << std::endl;
+}
+
+int		main(void)
+{
+	container_type	ctnr;
+
+	ctnr.push_back(21);
+	ctnr.push_back(42);
+	ctnr.push_back(1337);
+	ctnr.push_back(19);
+	ctnr.push_back(0);
+	ctnr.push_back(183792);
+
+	// The container is made into a heap
+	t_queue_		qu_(std::greater<TESTED_TYPE>(), ctnr);
+
+	std::cout << "top: " << qu_.top() << std::endl;
+	qu_.push(-1);
+	qu_.push(20);
+	printTop(qu_);
+
+	// The range is added to the elements of the container
+	std::vector<TESTED_TYPE>	v;
+
+	for (int i = 0; i < 100; ++i)
+		v.push_back((i * 37) % 101 - 50);
+	t_queue_		range_qu_(v.begin(), v.end(), std::greater<TESTED_TYPE>(), ctnr);
+
+	std::cout << "top: " << range_qu_.top() << std::endl;
+	for (int i = 0; i < 30; ++i)
+		range_qu_.pop();
+	range_qu_.push(-50);
+	range_qu_.push(5);
+	printTop(range_qu_);
+
+	// Strings, in the reverse order of std::less
+	TESTED_NAMESPACE::priority_queue<std::string, std::vector<std::string>,
+		std::greater<std::string> >	str_qu_;
+
+	str_qu_.push("salut");
+	str_qu_.push("tu vas bien?");
+	str_qu_.push("super");
+	str_qu_.push("et toi?");
+	str_qu_.push("");
+	printTop(str_qu_);
+
+	return (0);
+}
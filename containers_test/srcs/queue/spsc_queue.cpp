@@ -0,0 +1,174 @@
+#include "common.hpp"
+#include <algorithm>
+#include <vector>
+
+#if !defined(USING_STD)
+# include "spsc_queue.hpp"
+# define t_ring_ TESTED_NAMESPACE::spsc_queue
+#else
+# include <deque>
+// std has no bounded queue: a deque that refuses elements beyond the
+// capacity, rounded up to a power of two, pushes and pops the same
+template <class T>
+class bounded_queue
+{
+	public:
+		typedef std::size_t	size_type;
+		typedef T			value_type;
+
+		explicit bounded_queue(size_type capacity) : _capacity(1)
+		{
+			while (_capacity < capacity)
+				_capacity <<= 1;
+		}
+
+		size_type	capacity() const { return _capacity; }
+		size_type	size() const { return _q.size(); }
+		bool		empty() const { return _q.empty(); }
+
+		bool	push(const T& x)
+		{
+			if (_q.size() == _capacity)
+				return false;
+			_q.push_back(x);
+			return true;
+		}
+
+		template <class It>
+		size_type	push_n(It first, size_type n)
+		{
+			size_type i = 0;
+
+			for (; i < n && _q.size() < _capacity; ++i, ++first)
+				_q.push_back(*first);
+			return i;
+		}
+
+		T		*front() { return _q.empty() ? 0 : &_q.front(); }
+		void	pop() { _q.pop_front(); }
+
+		bool	pop(T& x)
+		{
+			if (_q.empty())
+				return false;
+			x = _q.front();
+			_q.pop_front();
+			return true;
+		}
+
+		template <class Out>
+		size_type	pop_n(Out out, size_type n)
+		{
+			size_type i = 0;
+
+			for (; i < n && !_q.empty(); ++i, ++out)
+			{
+				*out = _q.front();
+				_q.pop_front();
+			}
+			return i;
+		}
+
+	private:
+		std::deque<T>	_q;
+		size_type		_capacity;
+};
+# define t_ring_ bounded_queue
+#endif /* !defined(USING_STD) */
+
+template <typename T_RING>
+void	printState(T_RING &ring)
+{
+	std::cout << "capacity: " << ring.capacity() << " | size: " << ring.size()
+		<< " | empty: " << ring.empty() << " | front: ";
+	if (ring.front() == 0)
+		std::cout << "none" << std::endl;
+	else
+		std::cout << *ring.front() << std::endl;
+}
+
+int		main(void)
+{
+	t_ring_<int>	ring(5);
+	int				x = -1;
+
+	// Empty: nothing to pop
+	printState(ring);
+	std::cout << "pop: " << ring.pop(x) << " " << x << std::endl;
+
+	// Full: the push beyond the capacity fails, and leaves it as it was
+	for (int i = 0; i < 10; ++i)
+		std::cout << ring.push(i);
+	std::cout << std::endl;
+	printState(ring);
+	while (ring.pop(x))
+		std::cout << x << " ";
+	std::cout << std::endl;
+	printState(ring);
+
+	// push_n() and pop_n() across the end of the ring, many times: the
+	// elements come out in the order they went in
+	std::vector<int>	in;
+	std::vector<int>	out;
+	int					next = 0;
+
+	for (int i = 0; i < 100; ++i)
+		in.push_back(i * 7);
+	for (int round = 0; round < 12; ++round)
+	{
+		const std::size_t	pushed = ring.push_n(in.begin() + next % 50, 3 + round % 5);
+		int					popped[8];
+		const std::size_t	n = ring.pop_n(popped, 2 + round % 4);
+
+		next += pushed;
+		std::cout << "pushed: " << pushed << " | popped:";
+		for (std::size_t i = 0; i < n; ++i)
+		{
+			std::cout << " " << popped[i];
+			out.push_back(popped[i]);
+		}
+		std::cout << " | size: " << ring.size() << std::endl;
+	}
+	std::cout << "fifo: " << std::equal(out.begin(), out.end(), in.begin()) << std::endl;
+
+	// A push_n() larger than the room left, a pop_n() larger than size()
+	std::cout << "push_n: " << ring.push_n(in.begin(), 20) << std::endl;
+	printState(ring);
+
+	std::vector<int>	rest(20, -1);
+
+	std::cout << "pop_n: " << ring.pop_n(rest.begin(), 20) << std::endl;
+	for (std::size_t i = 0; i < rest.size(); ++i)
+		std::cout << rest[i] << " ";
+	std::cout << std::endl;
+	printState(ring);
+
+	// front() and pop() one at a time, in the middle of the ring: pop()
+	// only removes an element that front() returned
+	ring.push_n(in.begin() + 10, 6);
+	for (int i = 0; i < 2 && ring.front() != 0; ++i)
+		ring.pop();
+	*ring.front() = 42;
+	ring.push(1);
+	ring.push(2);
+	ring.push(3);
+	while (ring.front() != 0)
+	{
+		std::cout << *ring.front() << " ";
+		ring.pop();
+	}
+	std::cout << std::endl;
+
+	// Strings, some of them still in the queue when it is destroyed
+	t_ring_<std::string>	str(3);
+	std::string				s;
+	const std::string		words[] = { "salut", "super", "tu vas bien?", "et toi?", "abc" };
+
+	std::cout << "push_n: " << str.push_n(words, 5) << std::endl;
+	std::cout << "pop: " << str.pop(s) << " " << s << std::endl;
+	std::cout << "push_n: " << str.push_n(words + 3, 2) << std::endl;
+	std::cout << "push: " << str.push("full") << std::endl;
+	std::cout << "pop: " << str.pop(s) << " " << s << std::endl;
+	printState(str);
+	return (0);
+}
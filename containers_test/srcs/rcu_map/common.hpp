@@ -0,0 +1,78 @@
+#include "../base.hpp"
+#include <map>
+#if !defined(USING_STD)
+# include "rcu_map.hpp"
+# define t_rcu_map_ TESTED_NAMESPACE::rcu_map
+#else
+// std has no rcu map: readers of a single std::map, used from one
+// thread, must see the same contents
+template <class Key, class T, class Compare = std::less<Key> >
+class rcu_map
+{
+	typedef std::map<Key, T, Compare>	map_type;
+
+	public:
+		typedef typename map_type::key_type		key_type;
+		typedef typename map_type::mapped_type	mapped_type;
+		typedef typename map_type::value_type	value_type;
+		typedef typename map_type::size_type	size_type;
+
+		class reader
+		{
+			public:
+				explicit reader(rcu_map &m) : _map(&m._map) {}
+
+				bool	find(const key_type &k, mapped_type &value) const
+				{
+					typename map_type::const_iterator it = _map->find(k);
+
+					if (it == _map->end())
+						return false;
+					value = it->second;
+					return true;
+				}
+
+				bool	contains(const key_type &k) const { return _map->count(k) != 0; }
+
+				bool	lower_bound(const key_type &k, key_type &key, mapped_type &value) const
+				{
+					typename map_type::const_iterator it = _map->lower_bound(k);
+
+					if (it == _map->end())
+						return false;
+					key = it->first;
+					value = it->second;
+					return true;
+				}
+
+				size_type	size(void) const { return _map->size(); }
+
+			private:
+				const map_type	*_map;
+		};
+
+		bool	insert(const value_type &x) { return _map.insert(x).second; }
+
+		template <class It>
+		void	insert(It first, It last) { _map.insert(first, last); }
+
+		bool	insert_or_assign(const key_type &k, const mapped_type &obj)
+		{
+			std::pair<typename map_type::iterator, bool> ret = _map.insert(value_type(k, obj));
+
+			if (!ret.second)
+				ret.first->second = obj;
+			return ret.second;
+		}
+
+		size_type	erase(const key_type &k) { return _map.erase(k); }
+		void		clear(void) { _map.clear(); }
+		void		reclaim(void) {}
+
+	private:
+		map_type	_map;
+};
+# define t_rcu_map_ rcu_map
+#endif /* !defined(STD) */
+
+#define _pair TESTED_NAMESPACE::pair
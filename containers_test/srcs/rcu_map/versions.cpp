@@ -0,0 +1,89 @@
+#include "common.hpp"
+#include <vector>
+
+#define T1 int
+#define T2 std::string
+typedef t_rcu_map_<T1, T2> t_map;
+typedef t_map::reader t_reader;
+typedef t_map::value_type T3;
+
+// The version a reader is given, walked by lower_bound() from key to key
+void	printVersion(t_reader const &rd)
+{
+	T1		key = -1000;
+	T2		value;
+
+	std::cout << "size: " << rd.size() << std::endl;
+	while (rd.lower_bound(key, key, value))
+	{
+		std::cout << "- key: " << key << " | value: " << value << std::endl;
+		++key;
+	}
+	std::cout << "###############################################" << std::endl;
+}
+
+void	printFind(t_reader const &rd, T1 k)
+{
+	T2		value = "none";
+	const bool	found = rd.find(k, value);
+
+	std::cout << "find(" << k << "): " << found << " " << value
+		<< " | contains: " << rd.contains(k) << std::endl;
+}
+
+int		main(void)
+{
+	t_map		mp;
+	t_reader	rd(mp);
+
+	printVersion(rd);
+
+	// Each change is published: the reader sees it on its next lookup
+	for (int i = 0; i < 8; ++i)
+	{
+		std::cout << "insert: " << mp.insert(T3(i * 5, std::string(i + 1, 'a' + i))) << std::endl;
+		printVersion(rd);
+	}
+	std::cout << "insert existing: " << mp.insert(T3(10, "no")) << std::endl;
+	std::cout << "insert_or_assign: " << mp.insert_or_assign(10, "ten")
+		<< " " << mp.insert_or_assign(-5, "minus") << std::endl;
+	printVersion(rd);
+	printFind(rd, 10);
+	printFind(rd, 11);
+
+	// A second reader, then a third that reuses its slot
+	{
+		t_reader	other(mp);
+
+		std::cout << "erase: " << mp.erase(15);
+		std::cout << " " << mp.erase(15) << std::endl;
+		printVersion(other);
+		printFind(rd, 15);
+	}
+	t_reader	third(mp);
+
+	std::vector<T3>	v;
+
+	for (int i = 0; i < 20; ++i)
+		v.push_back(T3(i * 3, std::string(i % 4 + 1, 'z')));
+	mp.insert(v.begin(), v.end());
+	printVersion(third);
+
+	// The old versions go away: the readers still see the current one
+	mp.reclaim();
+	printVersion(rd);
+	for (int i = 0; i < 60; i += 2)
+		mp.erase(i);
+	mp.reclaim();
+	printVersion(rd);
+	printVersion(third);
+	mp.clear();
+	mp.reclaim();
+	printVersion(rd);
+	printFind(third, 3);
+	mp.insert_or_assign(3, "three");
+	mp.reclaim();
+	printVersion(third);
+	printFind(rd, 3);
+	return (0);
+}
@@ -31,6 +31,82 @@ void	printSize(T_SET const &st, bool print_content = 1)
 	std::cout << "###############################################" << std::endl;
 }
 
+// For sets of many nodes: the walks both ways must agree, and every
+// step-th element is printed
+template <typename T_SET>
+void	printDigest(T_SET const &st, std::size_t step = 97)
+{
+	typename T_SET::const_iterator			it = st.begin();
+	typename T_SET::const_reverse_iterator	rit = st.rbegin();
+	std::size_t								forward = 0;
+	std::size_t								backward = 0;
+
+	std::cout << "size: " << st.size() << std::endl;
+	for (; it != st.end(); ++it, ++forward)
+		if (forward % step == 0)
+			std::cout << "[" << forward << "] " << printPair(it, false) << std::endl;
+	for (; rit != st.rend(); ++rit)
+		++backward;
+	std::cout << "forward: " << forward << " | backward: " << backward << std::endl;
+	if (!st.empty())
+		std::cout << "first: " << printPair(st.begin(), false)
+			<< " | last: " << printPair(--st.end(), false) << std::endl;
+	std::cout << "###############################################" << std::endl;
+}
+
+// ft only: checks the red-black tree under the container, from the node
+// of end(), whose parent is the root. Returns the black height of the
+// subtree at x, or -1 if a rule is broken: a wrong parent link, a red
+// child of a red node, unequal black heights or, with order statistics,
+// a wrong subtree size.
+#if !defined(USING_STD)
+template <typename N>
+int		blackHeight(N x, N parent)
+{
+	if (x == 0)
+		return (0);
+	if (x->parent() != parent)
+		return (-1);
+
+	const int	black = int(x->color());
+
+	if (!black && ((x->_left && !int(x->_left->color()))
+		|| (x->_right && !int(x->_right->color()))))
+		return (-1);
+# ifdef FT_RB_TREE_ORDER_STATISTICS
+	if (x->_size != 1 + (x->_left ? x->_left->_size : 0)
+		+ (x->_right ? x->_right->_size : 0))
+		return (-1);
+# endif
+	const int	left = blackHeight<N>(x->_left, x);
+	const int	right = blackHeight<N>(x->_right, x);
+
+	if (left < 0 || left != right)
+		return (-1);
+	return (left + black);
+}
+
+// The root is black, and the rules hold below it
+template <typename N>
+bool	validTree(N header)
+{
+	const N	root = header->parent();
+
+	return (root == 0 || (int(root->color()) && blackHeight<N>(root, header) >= 0));
+}
+#endif /* !defined(USING_STD) */
+
+template <typename T>
+void	printValid(T const &c)
+{
+#if !defined(USING_STD)
+	std::cout << "valid: " << validTree(c.end()._node) << std::endl;
+#else
+	(void)c;
+	std::cout << "valid: " << true << std::endl;
+#endif
+}
+
 template <typename T1>
 void	printReverse(TESTED_NAMESPACE::set<T1> &st)
 {
@@ -0,0 +1,44 @@
+#define FT_RB_TREE_COMPACT
+#include "common.hpp"
+
+// The colors are packed into the parent pointers: every change of links
+// or colors goes through them. Nodes of char are as small as they get.
+#define T1 char
+typedef TESTED_NAMESPACE::set<T1> t_set;
+
+int		main(void)
+{
+	t_set	st;
+	t_set	other;
+
+	for (int i = 0; i < 256; ++i)
+		st.insert(char((i * 101) % 256));
+	printDigest(st, 17);
+	printValid(st);
+	for (int i = 0; i < 256; i += 3)
+		st.erase(char(i));
+	printDigest(st, 17);
+	printValid(st);
+	st.erase(st.find(char(10)), st.find(char(100)));
+	printDigest(st, 7);
+	printValid(st);
+
+	for (int i = 0; i < 256; i += 2)
+		other.insert(char(i));
+#if !defined(USING_STD)
+	st.union_with(other);
+#else
+	st.insert(other.begin(), other.end());
+	other.clear();
+#endif
+	printDigest(st, 7);
+	printValid(st);
+	printValid(other);
+
+	t_set	cpy(st);
+
+	cpy.erase(cpy.begin(), cpy.find(char(0)));
+	printDigest(cpy, 7);
+	printValid(cpy);
+	return (0);
+}
@@ -0,0 +1,50 @@
+#include "common.hpp"
+
+#define T1 std::string
+typedef TESTED_NAMESPACE::set<T1> t_set;
+typedef t_set::iterator ft_iterator;
+
+std::string	key(int i)
+{
+	std::string	s(3, 'a');
+
+	for (int j = 2; j >= 0; --j, i /= 26)
+		s[j] = 'a' + i % 26;
+	return s;
+}
+
+// Erases the keys in [from, to) by range, then checks that the rest
+// still takes insertions and erasures
+void	erase(t_set &st, int from, int to)
+{
+	std::cout << "erase(" << key(from) << ", " << key(to) << ")" << std::endl;
+	st.erase(st.lower_bound(key(from)), st.lower_bound(key(to)));
+	printDigest(st, 11);
+	printValid(st);
+	for (int i = 0; i < 2000; i += 7)
+		st.insert(key(i));
+	for (int i = 0; i < 2000; i += 9)
+		st.erase(key(i));
+	printDigest(st, 11);
+	printValid(st);
+}
+
+int		main(void)
+{
+	t_set	st;
+
+	// The keys step by two: 16 of them are erased one by one, 17 and more
+	// with two splits and a join
+	const int	ranges[][2] = {
+		{ 0, 32 }, { 0, 34 }, { 500, 1500 }, { 1, 2000 }, { 0, 1999 }, { 1000, 3000 }
+	};
+
+	for (std::size_t r = 0; r < sizeof(ranges) / sizeof(*ranges); ++r)
+	{
+		st.clear();
+		for (int i = 0; i < 2000; i += 2)
+			st.insert(key(i));
+		erase(st, ranges[r][0], ranges[r][1]);
+	}
+	return (0);
+}
@@ -0,0 +1,140 @@
+#include "common.hpp"
+
+#define T1 std::string
+typedef TESTED_NAMESPACE::set<T1> t_set;
+typedef t_set::iterator ft_iterator;
+
+// Set if a node was copied instead of being relinked: main() fails
+int		copied = 0;
+
+// C++98 std::set has no node handle: its emulation copies the value and
+// erases it, as the node moved by ft keeps its value
+#if !defined(USING_STD)
+_pair<ft_iterator, bool>	move_node(t_set &from, ft_iterator pos, t_set &to)
+{
+	t_set::node_type	nh = from.extract(pos);
+	T1 const			*value = &nh.value();
+
+	std::cout << "extracted: " << nh.value() << std::endl;
+
+	t_set::insert_return_type	ret = to.insert(nh);
+
+	std::cout << "node.empty(): " << ret.node.empty() << std::endl;
+	if (ret.inserted && &*ret.position != value)
+		copied = 1;
+	if (!ret.inserted)
+	{
+		// The node is handed back with its value, and goes back to from
+		std::cout << "handed back: " << ret.node.value() << std::endl;
+		from.insert(ret.node);
+	}
+	return _pair<ft_iterator, bool>(ret.position, ret.inserted);
+}
+
+_pair<ft_iterator, bool>	move_node(t_set &from, T1 const &k, t_set &to, T1 const &new_value)
+{
+	t_set::node_type	nh = from.extract(k);
+
+	std::cout << "extract(" << k << ").empty(): " << nh.empty() << std::endl;
+	if (!nh.empty())
+		nh.value() = new_value;
+
+	t_set::insert_return_type	ret = to.insert(nh);
+
+	if (!ret.inserted && !ret.node.empty())
+		from.insert(ret.node);
+	return _pair<ft_iterator, bool>(ret.position, ret.inserted);
+}
+
+void	merge(t_set &to, t_set &from) { to.merge(from); }
+#else
+_pair<ft_iterator, bool>	move_node(t_set &from, ft_iterator pos, t_set &to)
+{
+	T1	v = *pos;
+
+	std::cout << "extracted: " << v << std::endl;
+	from.erase(pos);
+
+	_pair<ft_iterator, bool>	ret = to.insert(v);
+
+	std::cout << "node.empty(): " << ret.second << std::endl;
+	if (!ret.second)
+	{
+		std::cout << "handed back: " << v << std::endl;
+		from.insert(v);
+	}
+	return ret;
+}
+
+_pair<ft_iterator, bool>	move_node(t_set &from, T1 const &k, t_set &to, T1 const &new_value)
+{
+	ft_iterator	pos = from.find(k);
+
+	std::cout << "extract(" << k << ").empty(): " << (pos == from.end()) << std::endl;
+	if (pos == from.end())
+		return _pair<ft_iterator, bool>(to.end(), false);
+	from.erase(pos);
+
+	_pair<ft_iterator, bool>	ret = to.insert(new_value);
+
+	if (!ret.second)
+		from.insert(new_value);
+	return ret;
+}
+
+void	merge(t_set &to, t_set &from)
+{
+	for (ft_iterator it = from.begin(); it != from.end();)
+	{
+		if (to.insert(*it).second)
+			from.erase(it++);
+		else
+			++it;
+	}
+}
+#endif
+
+template <typename T>
+void	printRet(T const &ret, t_set const &to)
+{
+	if (ret.first == to.end())
+		std::cout << "position: end()";
+	else
+		std::cout << "position: " << printPair(ret.first, false);
+	std::cout << " | inserted: " << ret.second << std::endl;
+}
+
+int		main(void)
+{
+	t_set	st;
+	t_set	st2;
+
+	for (int i = 0; i < 12; ++i)
+		st.insert(std::string(i % 3 + 1, 'a' + i));
+	st2.insert("bb");
+	st2.insert("zz");
+
+	// An extracted node keeps its value, and is inserted into st2
+	printRet(move_node(st, st.begin(), st2), st2);
+	printRet(move_node(st, --st.end(), st2), st2);
+	printRet(move_node(st, st.find("g"), st2), st2);
+	// Its value is already in st2: the node is handed back
+	printRet(move_node(st, st.find("bb"), st2), st2);
+	// Its value can be changed before it is inserted
+	printRet(move_node(st, "ccc", st2, "yy"), st2);
+	printRet(move_node(st, "ee", st2, "zz"), st2);
+	printRet(move_node(st, "fff", st, "0"), st);
+	printRet(move_node(st, "none", st2, ""), st2);
+	printSize(st);
+	printSize(st2);
+
+	// The values already in the target stay in the source
+	merge(st2, st);
+	printSize(st);
+	printSize(st2);
+	merge(st, st2);
+	merge(st, st2);
+	printSize(st);
+	printSize(st2);
+	return (copied);
+}
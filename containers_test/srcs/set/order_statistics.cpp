@@ -0,0 +1,95 @@
+#define FT_RB_TREE_ORDER_STATISTICS
+#define FT_RB_TREE_COMPACT
+#include "common.hpp"
+#include <iterator>
+
+// Both options at once: the sizes next to the packed colors
+#define T1 std::string
+typedef TESTED_NAMESPACE::set<T1> t_set;
+typedef t_set::const_iterator ft_const_iterator;
+
+std::string	key(int i)
+{
+	std::string	s(3, 'a');
+
+	for (int j = 2; j >= 0; --j, i /= 26)
+		s[j] = 'a' + i % 26;
+	return s;
+}
+
+// C++98 std::set has no order statistics: they are counted by walking
+#if !defined(USING_STD)
+ft_const_iterator	select(t_set const &st, std::size_t k) { return st.select(k); }
+std::size_t			rank(t_set const &st, T1 const &k) { return st.rank(k); }
+long				distance(t_set const &st, ft_const_iterator first, ft_const_iterator last)
+{ return st.distance(first, last); }
+#else
+ft_const_iterator	select(t_set const &st, std::size_t k)
+{
+	if (k >= st.size())
+		return st.end();
+
+	ft_const_iterator	it = st.begin();
+
+	std::advance(it, k);
+	return it;
+}
+
+std::size_t			rank(t_set const &st, T1 const &k)
+{ return std::distance(st.begin(), st.lower_bound(k)); }
+
+long				distance(t_set const &st, ft_const_iterator first, ft_const_iterator last)
+{ return std::distance(st.begin(), last) - std::distance(st.begin(), first); }
+#endif
+
+void	printStats(t_set const &st, std::size_t step = 29)
+{
+	std::cout << "size: " << st.size() << std::endl;
+	for (std::size_t k = 0; k < st.size(); k += step)
+		std::cout << "select(" << k << "): " << *select(st, k) << std::endl;
+	std::cout << "select(size): " << (select(st, st.size()) == st.end()) << std::endl;
+	for (int i = 0; i < 3000; i += 173)
+		std::cout << "rank(" << key(i) << "): " << rank(st, key(i)) << std::endl;
+	if (!st.empty())
+		std::cout << "distance: " << distance(st, st.begin(), st.end())
+			<< " | " << distance(st, st.find(*select(st, st.size() / 3)), st.end())
+			<< std::endl;
+	printValid(st);
+	std::cout << "###############################################" << std::endl;
+}
+
+int		main(void)
+{
+	t_set	st;
+
+	for (int i = 0; i < 3000; i += 2)
+		st.insert(key(i));
+	printStats(st);
+	for (int i = 0; i < 3000; i += 6)
+		st.erase(key(i));
+	printStats(st);
+	st.erase(st.lower_bound(key(100)), st.lower_bound(key(1200)));
+	printStats(st, 7);
+
+	t_set	other;
+
+	for (int i = 0; i < 3000; i += 5)
+		other.insert(key(i));
+#if !defined(USING_STD)
+	st.intersect_with(other);
+#else
+	{
+		t_set	both;
+
+		for (ft_const_iterator it = st.begin(); it != st.end(); ++it)
+			if (other.count(*it))
+				both.insert(*it);
+		st.swap(both);
+		other.clear();
+	}
+#endif
+	printStats(st, 3);
+	st.clear();
+	printStats(st);
+	return (0);
+}
@@ -0,0 +1,95 @@
+#include "common.hpp"
+#if !defined(USING_STD)
+# include "parallel.hpp"
+#endif
+#include <algorithm>
+#include <iterator>
+#include <vector>
+
+#define T1 int
+typedef TESTED_NAMESPACE::set<T1> t_set;
+
+enum e_op { UNION, INTERSECTION, DIFFERENCE };
+
+// The keys first + k * step, for k in [0, n)
+void	fill(t_set &st, int first, int step, int n)
+{
+	st.clear();
+	for (int k = 0; k < n; ++k)
+		st.insert(first + k * step);
+}
+
+// The result of the std algorithm on the same sets
+std::vector<T1>	expected(t_set const &a, t_set const &b, e_op op)
+{
+	std::vector<T1>	v;
+
+	if (op == UNION)
+		std::set_union(a.begin(), a.end(), b.begin(), b.end(), std::back_inserter(v));
+	else if (op == INTERSECTION)
+		std::set_intersection(a.begin(), a.end(), b.begin(), b.end(), std::back_inserter(v));
+	else
+		std::set_difference(a.begin(), a.end(), b.begin(), b.end(), std::back_inserter(v));
+	return v;
+}
+
+// std has no parallel set algebra: the set takes the result of the
+// algorithm, and other is emptied, as ft leaves it
+void	apply(t_set &a, t_set &b, e_op op, unsigned threads)
+{
+#if !defined(USING_STD)
+	if (op == UNION)
+		TESTED_NAMESPACE::parallel_union(a, b, threads);
+	else if (op == INTERSECTION)
+		TESTED_NAMESPACE::parallel_intersection(a, b, threads);
+	else
+		TESTED_NAMESPACE::parallel_difference(a, b, threads);
+#else
+	(void)threads;
+	std::vector<T1>	v = expected(a, b, op);
+
+	a = t_set(v.begin(), v.end());
+	b.clear();
+#endif
+}
+
+void	test(int a_first, int a_step, int a_n, int b_first, int b_step, int b_n,
+			unsigned threads = 4)
+{
+	const char	*names[] = { "union", "intersection", "difference" };
+	t_set		a;
+	t_set		b;
+
+	for (int op = UNION; op <= DIFFERENCE; ++op)
+	{
+		fill(a, a_first, a_step, a_n);
+		fill(b, b_first, b_step, b_n);
+
+		const std::vector<T1>	v = expected(a, b, e_op(op));
+
+		std::cout << "\t-- " << names[op] << " --" << std::endl;
+		apply(a, b, e_op(op), threads);
+		std::cout << "matches: " << (a.size() == v.size() && std::equal(v.begin(), v.end(), a.begin()))
+			<< " | other empty: " << b.empty() << std::endl;
+		printDigest(a, 997);
+		printValid(a);
+		// The result stands further changes
+		a.insert(-1);
+		a.erase(a_first);
+		printValid(a);
+	}
+}
+
+int		main(void)
+{
+	// Subtrees of black height 12, the default cutoff, hold at least
+	// 4095 nodes: from a few tens of thousands of keys, the first levels
+	// of the recursion are forked
+	test(0, 2, 60000, 1, 3, 40000);			// interleaved, partly overlapping
+	test(0, 1, 100000, 50000, 1, 100000);	// overlapping halves
+	test(0, 1, 80000, 0, 4, 20000);			// a subset of every fourth key
+	test(0, 3, 50000, 0, 3, 50000, 1);		// one thread: never forked
+	test(0, 3, 50000, 0, 3, 50000, 0);		// one per processor
+	test(0, 1, 0, 0, 1, 50000);				// empty
+	return (0);
+}
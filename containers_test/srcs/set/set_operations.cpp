@@ -0,0 +1,90 @@
+#include "common.hpp"
+#include <algorithm>
+#include <iterator>
+#include <vector>
+
+#define T1 int
+typedef TESTED_NAMESPACE::set<T1> t_set;
+
+enum e_op { UNION, INTERSECTION, DIFFERENCE };
+
+// The keys first + k * step, for k in [0, n)
+void	fill(t_set &st, int first, int step, int n)
+{
+	st.clear();
+	for (int k = 0; k < n; ++k)
+		st.insert(first + k * step);
+}
+
+// The result of the std algorithm on the same sets
+std::vector<T1>	expected(t_set const &a, t_set const &b, e_op op)
+{
+	std::vector<T1>	v;
+
+	if (op == UNION)
+		std::set_union(a.begin(), a.end(), b.begin(), b.end(), std::back_inserter(v));
+	else if (op == INTERSECTION)
+		std::set_intersection(a.begin(), a.end(), b.begin(), b.end(), std::back_inserter(v));
+	else
+		std::set_difference(a.begin(), a.end(), b.begin(), b.end(), std::back_inserter(v));
+	return v;
+}
+
+// C++98 std::set has no set algebra: it takes the result of the algorithm,
+// and other is emptied, as ft leaves it
+void	apply(t_set &a, t_set &b, e_op op)
+{
+#if !defined(USING_STD)
+	if (op == UNION)
+		a.union_with(b);
+	else if (op == INTERSECTION)
+		a.intersect_with(b);
+	else
+		a.difference_with(b);
+#else
+	std::vector<T1>	v = expected(a, b, op);
+
+	a = t_set(v.begin(), v.end());
+	b.clear();
+#endif
+}
+
+void	test(int a_first, int a_step, int a_n, int b_first, int b_step, int b_n)
+{
+	const char	*names[] = { "union", "intersection", "difference" };
+	t_set		a;
+	t_set		b;
+
+	for (int op = UNION; op <= DIFFERENCE; ++op)
+	{
+		fill(a, a_first, a_step, a_n);
+		fill(b, b_first, b_step, b_n);
+
+		const std::vector<T1>	v = expected(a, b, e_op(op));
+
+		std::cout << "\t-- " << names[op] << " --" << std::endl;
+		apply(a, b, e_op(op));
+		std::cout << "matches: " << (a.size() == v.size() && std::equal(v.begin(), v.end(), a.begin()))
+			<< " | other empty: " << b.empty() << std::endl;
+		printDigest(a, 17);
+		printValid(a);
+		// The result stands further changes
+		a.insert(-1);
+		a.erase(a_first);
+		printValid(a);
+	}
+}
+
+int		main(void)
+{
+	test(0, 1, 100, 50, 1, 100);	// overlapping
+	test(0, 2, 300, 1, 2, 300);		// interleaved, disjoint
+	test(0, 1, 100, 1000, 1, 100);	// disjoint, one after the other
+	test(0, 3, 500, 0, 3, 500);		// equal
+	test(0, 1, 1000, 10, 7, 20);	// a few keys into many
+	test(10, 7, 20, 0, 1, 1000);	// many keys into a few
+	test(0, 1, 0, 0, 1, 50);		// empty
+	test(0, 1, 50, 0, 1, 0);
+	test(0, 5, 4000, 3, 11, 1500);	// larger, partly overlapping
+	return (0);
+}
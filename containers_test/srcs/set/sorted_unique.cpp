@@ -0,0 +1,53 @@
+#include "common.hpp"
+#include <vector>
+
+#define T1 std::string
+typedef TESTED_NAMESPACE::set<T1> t_set;
+
+// C++98 std::set has no sorted_unique constructor: it is built from the
+// same range with the plain range constructor
+template <typename It>
+t_set	*build(It first, It last)
+{
+#if !defined(USING_STD)
+	return new t_set(ft::sorted_unique, first, last);
+#else
+	return new t_set(first, last);
+#endif
+}
+
+std::string	key(int i)
+{
+	std::string	s(4, 'a');
+
+	for (int j = 3; j >= 0; --j, i /= 26)
+		s[j] = 'a' + i % 26;
+	return s;
+}
+
+int		main(void)
+{
+	const int	sizes[] = { 0, 1, 2, 3, 7, 8, 9, 63, 64, 65, 700, 3000 };
+
+	for (std::size_t s = 0; s < sizeof(sizes) / sizeof(*sizes); ++s)
+	{
+		std::vector<T1>	v;
+
+		for (int i = 0; i < sizes[s]; ++i)
+			v.push_back(key(i * 3));
+
+		t_set	*st = build(v.begin(), v.end());
+
+		printDigest(*st, 29);
+		printValid(*st);
+		// The tree built must stand insertions and erasures
+		for (int i = 0; i < sizes[s] * 3; i += 2)
+			st->insert(key(i));
+		for (int i = 0; i < sizes[s] * 3; i += 5)
+			st->erase(key(i));
+		printDigest(*st, 29);
+		printValid(*st);
+		delete st;
+	}
+	return (0);
+}
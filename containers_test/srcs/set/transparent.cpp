@@ -0,0 +1,102 @@
+#include "common.hpp"
+#if !defined(USING_STD)
+# include "functional.hpp"
+#endif
+
+// A key that counts how many times it is built, copies included
+struct label
+{
+	static int	built;
+
+	label(char const *s) : name(s) { ++built; }
+	label(label const &src) : name(src.name) { ++built; }
+
+	std::string	name;
+};
+
+int	label::built = 0;
+
+std::ostream	&operator<<(std::ostream &o, label const &l) { return o << l.name; }
+
+// Compares labels with each other and with C strings. Under ft it is
+// transparent, so that the lookups take a C string as is.
+struct by_name
+{
+#if !defined(USING_STD)
+	typedef void	is_transparent;
+#endif
+
+	bool operator()(label const &x, label const &y) const { return x.name < y.name; }
+	bool operator()(label const &x, char const *y) const { return x.name < y; }
+	bool operator()(char const *x, label const &y) const { return x < y.name; }
+};
+
+typedef TESTED_NAMESPACE::set<label, by_name>	t_set;
+
+// C++98 std::set has no transparent lookup: it is given a label
+#if !defined(USING_STD)
+# define LOOKUP_KEY(s) (s)
+# define LOOKUP_STRING(s) (s)
+typedef TESTED_NAMESPACE::set<std::string, TESTED_NAMESPACE::less<> >	t_sset;
+#else
+# define LOOKUP_KEY(s) label(s)
+# define LOOKUP_STRING(s) std::string(s)
+typedef TESTED_NAMESPACE::set<std::string>	t_sset;
+#endif
+
+template <typename SET, typename K>
+void	lookup(SET const &st, K const &k, char const *name)
+{
+	typename SET::const_iterator	it;
+
+	std::cout << "\t-- " << name << " --" << std::endl;
+	it = st.find(k);
+	if (it == st.end())
+		std::cout << "find: end()" << std::endl;
+	else
+		std::cout << "find: " << printPair(it);
+	std::cout << "count: " << st.count(k) << std::endl;
+	it = st.lower_bound(k);
+	if (it == st.end())
+		std::cout << "lower_bound: end()" << std::endl;
+	else
+		std::cout << "lower_bound: " << printPair(it);
+	it = st.upper_bound(k);
+	if (it == st.end())
+		std::cout << "upper_bound: end()" << std::endl;
+	else
+		std::cout << "upper_bound: " << printPair(it);
+	std::cout << "equal_range: " << std::distance(st.equal_range(k).first, st.equal_range(k).second) << std::endl;
+}
+
+int		main(void)
+{
+	char const	*names[] = { "delta", "alpha", "echo", "charlie", "bravo", "golf" };
+	char const	*lookups[] = { "charlie", "alpha", "golf", "foxtrot", "aaa", "zulu" };
+	t_set		st;
+	t_sset		sst;
+
+	for (int i = 0; i < 6; ++i)
+	{
+		st.insert(names[i]);
+		sst.insert(names[i]);
+	}
+	printSize(st);
+
+	// Under ft, the lookups build no key
+	int		built = label::built;
+
+	for (int i = 0; i < 6; ++i)
+		lookup(st, LOOKUP_KEY(lookups[i]), lookups[i]);
+#if !defined(USING_STD)
+	if (label::built != built)
+		return (1);
+#else
+	(void)built;
+#endif
+
+	// less<> compares a std::string and a C string with operator<
+	for (int i = 0; i < 6; ++i)
+		lookup(sst, LOOKUP_STRING(lookups[i]), lookups[i]);
+	return (0);
+}
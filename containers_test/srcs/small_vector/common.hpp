@@ -0,0 +1,90 @@
+#include "../base.hpp"
+#if !defined(USING_STD)
+# include "small_vector.hpp"
+# include "stack.hpp"
+# define t_small_vector_ TESTED_NAMESPACE::small_vector
+#else
+# include <vector>
+# include <stack>
+
+// std has no small_vector: a vector that remembers whether it ever held
+// more than N elements. The elements of ft::small_vector leave the
+// object at that point, and only come back in a copy
+template <class T, std::size_t N>
+class small_vector : public std::vector<T>
+{
+	typedef std::vector<T>	base;
+
+	public:
+		typedef typename base::size_type	size_type;
+		typedef typename base::iterator		iterator;
+
+		static const size_type	inline_capacity = N;
+
+		small_vector(void) : base(), _spilled(false) {}
+		explicit small_vector(size_type n, const T &val = T()) : base(n, val), _spilled(n > N) {}
+		template <class It>
+		small_vector(It first, It last) : base(first, last), _spilled(false) { grew(); }
+		small_vector(const small_vector &x) : base(x), _spilled(x.size() > N) {}
+
+		small_vector	&operator=(const small_vector &x) { base::operator=(x); return grew(); }
+
+		bool	is_inline(void) const { return !_spilled; }
+
+		void	assign(size_type n, const T &val) { base::assign(n, val); grew(); }
+		template <class It>
+		void	assign(It first, It last) { base::assign(first, last); grew(); }
+		void	reserve(size_type n) { base::reserve(n); _spilled = _spilled || n > N; }
+		void	resize(size_type n, T c = T()) { base::resize(n, c); grew(); }
+		void	push_back(const T &x) { base::push_back(x); grew(); }
+
+		iterator	insert(iterator pos, const T &x)
+		{
+			iterator it = base::insert(pos, x);
+
+			grew();
+			return it;
+		}
+		void	insert(iterator pos, size_type n, const T &x) { base::insert(pos, n, x); grew(); }
+		template <class It>
+		void	insert(iterator pos, It first, It last) { base::insert(pos, first, last); grew(); }
+
+		void	swap(small_vector &x) { base::swap(x); grew(); x.grew(); }
+
+	private:
+		small_vector	&grew(void)
+		{
+			_spilled = _spilled || this->size() > N;
+			return *this;
+		}
+
+		bool	_spilled;
+};
+
+template <class T, std::size_t N>
+const typename small_vector<T, N>::size_type	small_vector<T, N>::inline_capacity;
+
+template <class T, std::size_t N>
+void	swap(small_vector<T, N> &x, small_vector<T, N> &y) { x.swap(y); }
+
+# define t_small_vector_ small_vector
+#endif /* !defined(STD) */
+
+template <typename T_VEC>
+void	printSize(T_VEC const &vct, bool print_content = true)
+{
+	const std::string isCapacityOk = (vct.capacity() >= vct.size()) ? "OK" : "KO";
+
+	std::cout << "size: " << vct.size() << std::endl;
+	std::cout << "capacity: " << isCapacityOk << std::endl;
+	std::cout << "inline: " << vct.is_inline() << std::endl;
+	if (print_content)
+	{
+		typename T_VEC::const_iterator it = vct.begin();
+		typename T_VEC::const_iterator ite = vct.end();
+		std::cout << std::endl << "Content is:" << std::endl;
+		for (; it != ite; ++it)
+			std::cout << "- " << *it << std::endl;
+	}
+	std::cout << "###############################################" << std::endl;
+}
@@ -0,0 +1,90 @@
+#include "common.hpp"
+
+#define TESTED_TYPE std::string
+typedef t_small_vector_<TESTED_TYPE, 3> t_vec;
+
+t_vec	make(int n, char c)
+{
+	t_vec	vct;
+
+	for (int i = 0; i < n; ++i)
+		vct.push_back(std::string(i + 1, c));
+	return vct;
+}
+
+int		main(void)
+{
+	t_vec	small = make(2, 'a');
+	t_vec	big = make(7, 'b');
+
+	// A copy lives inline whenever the elements fit
+	t_vec	shrunk(big);
+
+	shrunk.erase(shrunk.begin() + 2, shrunk.end());
+
+	t_vec	copy_small(small);
+	t_vec	copy_big(big);
+	t_vec	copy_shrunk(shrunk);
+
+	printSize(shrunk);
+	printSize(copy_small);
+	printSize(copy_big);
+	printSize(copy_shrunk);
+
+	// Assignment between inline and heap states
+	t_vec	a = make(1, 'c');
+	t_vec	b = make(5, 'd');
+
+	a = big;
+	printSize(a);
+	a = small;
+	printSize(a);
+	b = small;
+	printSize(b);
+	copy_small = big;
+	printSize(copy_small);
+	t_vec	&same = copy_small;
+
+	copy_small = same;
+	printSize(copy_small);
+
+	std::cout << "SWAP inline / inline" << std::endl;
+	t_vec	x = make(3, 'x');
+	t_vec	y = make(1, 'y');
+
+	x.swap(y);
+	printSize(x);
+	printSize(y);
+
+	std::cout << "SWAP inline / heap" << std::endl;
+	t_vec	z = make(6, 'z');
+
+	x.swap(z);
+	printSize(x);
+	printSize(z);
+	z.swap(x);
+	printSize(x);
+	printSize(z);
+
+	std::cout << "SWAP heap / heap" << std::endl;
+	t_vec	w = make(4, 'w');
+
+	t_vec::const_iterator it_w = w.begin();
+	t_vec::const_iterator it_big = big.begin();
+
+	w.swap(big);
+	printSize(w);
+	printSize(big);
+	// Heap buffers are exchanged, not copied
+	std::cout << (it_w == big.begin()) << " " << (it_big == w.begin()) << std::endl;
+
+	std::cout << "SWAP non-member and self" << std::endl;
+	swap(small, w);
+	printSize(small);
+	printSize(w);
+	small.swap(small);
+	printSize(small);
+
+	std::cout << "eq: " << (copy_big == w) << " | lt: " << (small < w) << std::endl;
+	return (0);
+}
@@ -0,0 +1,88 @@
+#include "common.hpp"
+
+template <typename T>
+T		val(int i);
+
+template <>
+int		val<int>(int i) { return i * 3; }
+
+template <>
+std::string	val<std::string>(int i) { return std::string(i % 4 + 1, 'a' + i % 26); }
+
+template <typename T>
+void	test(void)
+{
+	typedef t_small_vector_<T, 4>	t_vec;
+
+	t_vec	vct;
+
+	std::cout << "inline_capacity: " << t_vec::inline_capacity << std::endl;
+	printSize(vct);
+
+	// Up to N elements stay inline, the next one spills them to the heap
+	for (int i = 0; i < 6; ++i)
+	{
+		vct.push_back(val<T>(i));
+		std::cout << "push_back: " << vct.size() << " | inline: " << vct.is_inline() << std::endl;
+	}
+	printSize(vct);
+
+	// Once on the heap, shrinking does not bring them back
+	vct.erase(vct.begin() + 1, vct.end());
+	printSize(vct);
+	vct.clear();
+	printSize(vct);
+
+	// Insertion in the middle and at the end, up to the limit and past it
+	t_vec	ins(2, val<T>(1));
+
+	ins.insert(ins.begin() + 1, val<T>(2));
+	ins.insert(ins.end(), val<T>(3));
+	printSize(ins);
+	ins.insert(ins.begin() + 2, 3, val<T>(4));
+	printSize(ins);
+
+	t_vec	range;
+
+	range.insert(range.end(), ins.begin(), ins.begin() + 3);
+	printSize(range);
+	range.insert(range.begin() + 1, ins.begin(), ins.end());
+	printSize(range);
+
+	// A value that lives in the vector, pushed at the moment it spills
+	t_vec	self(4, val<T>(5));
+
+	self[3] = val<T>(6);
+	self.push_back(self[3]);
+	self.insert(self.begin(), self.back());
+	printSize(self);
+
+	// reserve(), resize() and assign() across the limit
+	t_vec	res;
+
+	res.reserve(4);
+	printSize(res);
+	res.resize(3, val<T>(7));
+	printSize(res);
+	res.resize(9, val<T>(8));
+	printSize(res);
+
+	t_vec	asn;
+
+	asn.assign(4, val<T>(9));
+	printSize(asn);
+	asn.assign(ins.begin(), ins.end());
+	printSize(asn);
+	asn.assign(2, val<T>(10));
+	printSize(asn);
+	res.reserve(5);
+	asn.reserve(5);
+	printSize(asn);
+}
+
+int		main(void)
+{
+	test<int>();
+	test<std::string>();
+	return (0);
+}
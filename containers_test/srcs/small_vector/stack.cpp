@@ -0,0 +1,65 @@
+#include "common.hpp"
+
+#define TESTED_TYPE foo<int>
+typedef t_small_vector_<TESTED_TYPE, 4> container_type;
+#define t_stack_ TESTED_NAMESPACE::stack<TESTED_TYPE, container_type>
+
+template <class T_STACK>
+void	cmp(const T_STACK &lhs, const T_STACK &rhs)
+{
+	static int i = 0;
+
+	std::cout << "############### [" << i++ << "] ###############"  << std::endl;
+	std::cout << "eq: " << (lhs == rhs) << " | ne: " << (lhs != rhs) << std::endl;
+	std::cout << "lt: " << (lhs <  rhs) << " | le: " << (lhs <= rhs) << std::endl;
+	std::cout << "gt: " << (lhs >  rhs) << " | ge: " << (lhs >= rhs) << std::endl;
+}
+
+template <typename T_STACK>
+void	printStack(T_STACK stck)
+{
+	std::cout << "size: " << stck.size() << std::endl;
+	std::cout << std::endl << "Content was:" << std::endl;
+	while (stck.size() != 0) {
+		std::cout << "- " << stck.top() << std::endl;
+		stck.pop();
+	}
+	std::cout << "###############################################" << std::endl;
+}
+
+int		main(void)
+{
+	container_type	ctnr;
+
+	ctnr.push_back(21);
+	ctnr.push_back(42);
+	ctnr.push_back(1337);
+	printSize(ctnr);
+
+	t_stack_	stck(ctnr);
+	t_stack_	stck2(ctnr);
+
+	std::cout << "empty: " << stck.empty() << std::endl;
+	cmp(stck, stck2);
+
+	// Past the inline storage of the underlying small_vector, and back
+	for (int i = 0; i < 6; ++i)
+		stck.push(i * 10);
+	std::cout << "top: " << stck.top() << std::endl;
+	printStack(stck);
+	cmp(stck, stck2);
+	cmp(stck2, stck);
+
+	stck.top() = 99;
+	for (int i = 0; i < 5; ++i)
+		stck.pop();
+	std::cout << "top: " << stck.top() << std::endl;
+	printStack(stck);
+	cmp(stck, stck2);
+
+	while (!stck.empty())
+		stck.pop();
+	std::cout << "empty: " << stck.empty() << std::endl;
+	cmp(stck, stck2);
+	return (0);
+}
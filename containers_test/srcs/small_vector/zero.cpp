@@ -0,0 +1,37 @@
+#include "common.hpp"
+
+#define TESTED_TYPE std::string
+
+// Without inline storage, the first element already goes to the heap
+int		main(void)
+{
+	typedef t_small_vector_<TESTED_TYPE, 0>	t_vec;
+
+	t_vec	vct;
+
+	std::cout << "inline_capacity: " << t_vec::inline_capacity << std::endl;
+	printSize(vct);
+
+	vct.push_back("first");
+	printSize(vct);
+	for (int i = 0; i < 10; ++i)
+		vct.insert(vct.begin() + i / 2, std::string(i + 1, 'x'));
+	printSize(vct);
+	vct.erase(vct.begin() + 2, vct.end() - 2);
+	printSize(vct);
+
+	t_vec	empty;
+	t_vec	copy(vct);
+	t_vec	none(empty);
+
+	printSize(copy);
+	printSize(none);
+	empty.swap(copy);
+	printSize(empty);
+	printSize(copy);
+	copy = none;
+	printSize(copy);
+	copy.reserve(0);
+	printSize(copy);
+	return (0);
+}
@@ -0,0 +1,67 @@
+#include "../base.hpp"
+#include <map>
+#include <vector>
+#include <algorithm>
+#if !defined(USING_STD)
+# include "unordered_map.hpp"
+# define t_unordered_map_ TESTED_NAMESPACE::unordered_map
+#else
+// C++98 has no hash containers: a std::map holds the same pairs, and
+// the pairs are printed sorted by key
+# define t_unordered_map_ std::map
+#endif /* !defined(STD) */
+
+#define _pair TESTED_NAMESPACE::pair
+
+template <typename T>
+std::string	printPair(const T &iterator, bool nl = true, std::ostream &o = std::cout)
+{
+	o << "key: " << iterator->first << " | value: " << iterator->second;
+	if (nl)
+		o << std::endl;
+	return ("");
+}
+
+// The pairs in key order, as an unordered_map visits them in none
+template <typename T_MAP>
+void	printSize(T_MAP const &mp, bool print_content = 1)
+{
+	typedef std::pair<typename T_MAP::key_type, typename T_MAP::mapped_type>	sorted_pair;
+
+	std::cout << "size: " << mp.size() << std::endl;
+	std::cout << "empty: " << mp.empty() << std::endl;
+	if (print_content)
+	{
+		std::vector<sorted_pair>	content;
+		std::size_t					visited = 0;
+
+		for (typename T_MAP::const_iterator it = mp.begin(); it != mp.end(); ++it, ++visited)
+			content.push_back(sorted_pair(it->first, it->second));
+		std::sort(content.begin(), content.end());
+		std::cout << "visited: " << visited << std::endl;
+		std::cout << std::endl << "Content is:" << std::endl;
+		for (std::size_t i = 0; i < content.size(); ++i)
+			std::cout << "- " << printPair(&content[i], false) << std::endl;
+	}
+	std::cout << "###############################################" << std::endl;
+}
+
+// The hash policy of ft, which std::map has not: its output is the
+// same as long as the table keeps its invariants
+template <typename T_MAP>
+void	printPolicy(T_MAP const &mp, std::size_t min_buckets = 0)
+{
+	bool	ok = true;
+
+#if !defined(USING_STD)
+	const std::size_t	n = mp.bucket_count();
+
+	// A power of two, at least min_buckets, not fuller than allowed
+	ok = (n & (n - 1)) == 0 && n >= min_buckets
+		&& (n == 0 ? mp.size() == 0 : mp.load_factor() <= mp.max_load_factor());
+#else
+	(void)mp;
+	(void)min_buckets;
+#endif
+	std::cout << "hash policy: " << (ok ? "ok" : "broken") << std::endl;
+}
@@ -0,0 +1,54 @@
+#include "common.hpp"
+
+#define T1 int
+#define T2 std::string
+typedef t_unordered_map_<T1, T2>::value_type T3;
+
+int		main(void)
+{
+	t_unordered_map_<T1, T2>	mp;
+
+	for (int i = 0; i < 40; ++i)
+		mp.insert(T3(i * 5, std::string(1, 'a' + i % 26)));
+
+	t_unordered_map_<T1, T2>	copy(mp);
+	t_unordered_map_<T1, T2>	range(mp.begin(), mp.end());
+	t_unordered_map_<T1, T2>	assigned;
+
+	assigned[1] = "will be replaced";
+	assigned = mp;
+	std::cout << "copy == mp: " << (copy == mp) << std::endl;
+	std::cout << "range == mp: " << (range == mp) << std::endl;
+	std::cout << "assigned == mp: " << (assigned == mp) << std::endl;
+	printSize(copy);
+	printPolicy(copy);
+
+	// The copies are deep
+	copy[0] = "changed";
+	copy.erase(5);
+	copy[1000] = "new";
+	range.clear();
+	assigned = assigned;
+	std::cout << "copy == mp: " << (copy == mp) << std::endl;
+	std::cout << "copy != mp: " << (copy != mp) << std::endl;
+	std::cout << "assigned == mp: " << (assigned == mp) << std::endl;
+	printSize(mp);
+	printSize(copy);
+	printSize(range);
+
+	// Equal pairs inserted in another order
+	t_unordered_map_<T1, T2>	reversed;
+
+	for (int i = 39; i >= 0; --i)
+		reversed.insert(T3(i * 5, std::string(1, 'a' + i % 26)));
+	std::cout << "reversed == mp: " << (reversed == mp) << std::endl;
+	reversed[0] = "z";
+	std::cout << "reversed == mp: " << (reversed == mp) << std::endl;
+
+	mp.swap(copy);
+	printSize(mp);
+	swap(mp, range);
+	printSize(mp);
+	printSize(range, false);
+	return (0);
+}
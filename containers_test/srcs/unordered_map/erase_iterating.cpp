@@ -0,0 +1,57 @@
+#include "common.hpp"
+
+#define T1 int
+#define T2 int
+typedef t_unordered_map_<T1, T2>::value_type T3;
+typedef t_unordered_map_<T1, T2>::iterator ft_iterator;
+
+int		main(void)
+{
+	t_unordered_map_<T1, T2>	mp;
+
+	for (int i = 0; i < 1000; ++i)
+		mp.insert(T3(i, i % 10));
+
+	// Erasing does not invalidate the other iterators
+	std::size_t	erased = 0;
+
+	for (ft_iterator it = mp.begin(); it != mp.end();)
+	{
+		if (it->second % 3 == 0)
+		{
+			mp.erase(it++);
+			++erased;
+		}
+		else
+			++it;
+	}
+	std::cout << "erased: " << erased << std::endl;
+	printSize(mp, false);
+	printPolicy(mp);
+
+	// Values changed through the iterators
+	for (ft_iterator it = mp.begin(); it != mp.end(); ++it)
+		it->second *= 2;
+
+	long	sum = 0;
+
+	for (ft_iterator it = mp.begin(); it != mp.end(); ++it)
+		sum += it->second;
+	std::cout << "sum: " << sum << std::endl;
+
+	// Everything, one at a time, then the table is filled again
+	for (ft_iterator it = mp.begin(); it != mp.end();)
+		mp.erase(it++);
+	printSize(mp);
+	for (int i = 0; i < 40; ++i)
+		mp.insert(T3(i * 11, i));
+	for (ft_iterator it = mp.begin(); it != mp.end();)
+	{
+		if (it->first % 2)
+			mp.erase(it++);
+		else
+			++it;
+	}
+	printSize(mp);
+	return (0);
+}
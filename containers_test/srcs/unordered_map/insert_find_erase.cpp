@@ -0,0 +1,89 @@
+#include "common.hpp"
+
+#define T1 std::string
+#define T2 int
+typedef t_unordered_map_<T1, T2>::value_type T3;
+typedef t_unordered_map_<T1, T2>::iterator ft_iterator;
+
+t_unordered_map_<T1, T2> mp;
+
+void	ft_insert(T3 const &x)
+{
+	_pair<ft_iterator, bool> ret = mp.insert(x);
+
+	std::cout << "insert " << x.first << ": " << printPair(ret.first, false)
+		<< " | inserted: " << ret.second << std::endl;
+}
+
+void	ft_find(T1 const &k)
+{
+	ft_iterator ret = mp.find(k);
+
+	if (ret != mp.end())
+		printPair(ret);
+	else
+		std::cout << "find(" << k << ") returned end()" << std::endl;
+	std::cout << "count(" << k << "): " << mp.count(k) << std::endl;
+}
+
+int		main(void)
+{
+	printSize(mp);
+	ft_find("absent");
+
+	ft_insert(T3("one", 1));
+	ft_insert(T3("two", 2));
+	ft_insert(T3("three", 3));
+	ft_insert(T3("one", 100));
+	ft_insert(T3("", 0));
+	mp.insert(mp.begin(), T3("four", 4));
+	mp.insert(mp.end(), T3("two", 200));
+	printSize(mp);
+
+	ft_find("one");
+	ft_find("four");
+	ft_find("");
+	ft_find("five");
+
+	mp["five"] = 5;
+	mp["one"] += 10;
+	std::cout << "mp[\"six\"]: " << mp["six"] << std::endl;
+	std::cout << "at(\"two\"): " << mp.at("two") << std::endl;
+	try {
+		mp.at("seven");
+		std::cout << "at(\"seven\") did not throw" << std::endl;
+	} catch (std::out_of_range &) {
+		std::cout << "at(\"seven\") threw out_of_range" << std::endl;
+	}
+	printSize(mp);
+
+	// Enough keys to grow the table several times
+	for (int i = 0; i < 500; ++i)
+		mp.insert(T3(std::string(1, 'a' + i % 26) + std::string(i / 26 + 1, '#'), i));
+	printSize(mp, false);
+	printPolicy(mp);
+	ft_find("a#");
+	ft_find("z####");
+
+	std::cout << "erase(\"one\"): " << mp.erase("one") << std::endl;
+	std::cout << "erase(\"one\"): " << mp.erase("one") << std::endl;
+	mp.erase(mp.find("two"));
+	ft_find("one");
+	ft_find("two");
+	for (int i = 0; i < 500; i += 2)
+		mp.erase(std::string(1, 'a' + i % 26) + std::string(i / 26 + 1, '#'));
+	printSize(mp);
+
+	// Erased slots are reused
+	for (int i = 0; i < 500; i += 3)
+		mp.insert(T3(std::string(1, 'a' + i % 26) + std::string(i / 26 + 1, '#'), -i));
+	printSize(mp, false);
+	printPolicy(mp);
+
+	mp.erase(mp.begin(), mp.end());
+	printSize(mp);
+	ft_find("three");
+	mp["back"] = 1;
+	printSize(mp);
+	return (0);
+}
@@ -0,0 +1,95 @@
+#include "common.hpp"
+
+#define T1 int
+#define T2 int
+typedef t_unordered_map_<T1, T2>::value_type T3;
+
+template <typename T_MAP>
+void	ft_rehash(T_MAP &mp, std::size_t n)
+{
+	std::cout << "\t-- rehash(" << n << ") --" << std::endl;
+#if !defined(USING_STD)
+	mp.rehash(n);
+#endif
+	printPolicy(mp, n);
+	printSize(mp, mp.size() < 50);
+}
+
+// Inserting n pairs after reserve(n) does not grow the table
+template <typename T_MAP>
+void	ft_reserve(T_MAP &mp, std::size_t n, int first)
+{
+	bool	same = true;
+
+	std::cout << "\t-- reserve(" << n << ") --" << std::endl;
+#if !defined(USING_STD)
+	mp.reserve(mp.size() + n);
+
+	const std::size_t	buckets = mp.bucket_count();
+#endif
+	for (std::size_t i = 0; i < n; ++i)
+		mp.insert(T3(first + int(i), int(i)));
+#if !defined(USING_STD)
+	same = mp.bucket_count() == buckets;
+#endif
+	std::cout << "no growth: " << same << std::endl;
+	printPolicy(mp);
+	printSize(mp, mp.size() < 50);
+}
+
+template <typename T_MAP>
+void	ft_max_load_factor(T_MAP &mp, float z)
+{
+	std::cout << "\t-- max_load_factor(" << z << ") --" << std::endl;
+#if !defined(USING_STD)
+	mp.max_load_factor(z);
+#else
+	(void)z;
+#endif
+	for (int i = 0; i < 300; ++i)
+		mp.insert(T3(i * 7, i));
+	printPolicy(mp);
+	printSize(mp, false);
+}
+
+int		main(void)
+{
+	t_unordered_map_<T1, T2>	mp;
+
+	ft_rehash(mp, 0);
+	ft_rehash(mp, 100);
+	for (int i = 0; i < 20; ++i)
+		mp[i * 3] = i;
+	ft_rehash(mp, 1000);
+	ft_rehash(mp, 10);
+	ft_rehash(mp, 0);
+
+	ft_reserve(mp, 100, 1000);
+	ft_reserve(mp, 1000, 5000);
+	mp.clear();
+	ft_reserve(mp, 30, 0);
+
+	// A fuller and an emptier table, and values that are ignored
+	ft_max_load_factor(mp, 0.5f);
+	ft_max_load_factor(mp, 1.0f);
+	ft_max_load_factor(mp, 0.0f);
+	ft_max_load_factor(mp, -1.0f);
+#if !defined(USING_STD)
+	std::cout << "max_load_factor: " << mp.max_load_factor() << std::endl;
+#else
+	std::cout << "max_load_factor: " << 1 << std::endl;
+#endif
+
+	// Growing keeps every pair
+	for (int i = 0; i < 4000; ++i)
+		mp[i] = -i;
+	printPolicy(mp);
+	printSize(mp, false);
+
+	long	sum = 0;
+
+	for (int i = 0; i < 4000; ++i)
+		sum += mp.find(i)->second;
+	std::cout << "sum: " << sum << std::endl;
+	return (0);
+}
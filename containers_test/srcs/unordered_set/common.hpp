@@ -0,0 +1,65 @@
+#include "../base.hpp"
+#include <set>
+#include <vector>
+#include <algorithm>
+#if !defined(USING_STD)
+# include "unordered_set.hpp"
+# define t_unordered_set_ TESTED_NAMESPACE::unordered_set
+#else
+// C++98 has no hash containers: a std::set holds the same elements,
+// and the elements are printed sorted
+# define t_unordered_set_ std::set
+#endif /* !defined(STD) */
+
+#define _pair TESTED_NAMESPACE::pair
+
+template <typename T>
+std::string	printPair(const T &iterator, bool nl = true, std::ostream &o = std::cout)
+{
+	o << "value: " << *iterator;
+	if (nl)
+		o << std::endl;
+	return ("");
+}
+
+// The elements in order, as an unordered_set visits them in none
+template <typename T_SET>
+void	printSize(T_SET const &st, bool print_content = 1)
+{
+	std::cout << "size: " << st.size() << std::endl;
+	std::cout << "empty: " << st.empty() << std::endl;
+	if (print_content)
+	{
+		std::vector<typename T_SET::value_type>	content;
+		std::size_t								visited = 0;
+
+		for (typename T_SET::const_iterator it = st.begin(); it != st.end(); ++it, ++visited)
+			content.push_back(*it);
+		std::sort(content.begin(), content.end());
+		std::cout << "visited: " << visited << std::endl;
+		std::cout << std::endl << "Content is:" << std::endl;
+		for (std::size_t i = 0; i < content.size(); ++i)
+			std::cout << "- " << printPair(&content[i], false) << std::endl;
+	}
+	std::cout << "###############################################" << std::endl;
+}
+
+// The hash policy of ft, which std::set has not: its output is the
+// same as long as the table keeps its invariants
+template <typename T_SET>
+void	printPolicy(T_SET const &st, std::size_t min_buckets = 0)
+{
+	bool	ok = true;
+
+#if !defined(USING_STD)
+	const std::size_t	n = st.bucket_count();
+
+	// A power of two, at least min_buckets, not fuller than allowed
+	ok = (n & (n - 1)) == 0 && n >= min_buckets
+		&& (n == 0 ? st.size() == 0 : st.load_factor() <= st.max_load_factor());
+#else
+	(void)st;
+	(void)min_buckets;
+#endif
+	std::cout << "hash policy: " << (ok ? "ok" : "broken") << std::endl;
+}
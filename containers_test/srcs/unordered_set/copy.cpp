@@ -0,0 +1,46 @@
+#include "common.hpp"
+
+#define T1 int
+
+int		main(void)
+{
+	t_unordered_set_<T1>	st;
+
+	for (int i = 0; i < 40; ++i)
+		st.insert(i * 5);
+
+	t_unordered_set_<T1>	copy(st);
+	t_unordered_set_<T1>	range(st.begin(), st.end());
+	t_unordered_set_<T1>	assigned;
+
+	assigned.insert(1);
+	assigned = st;
+	std::cout << "copy == st: " << (copy == st) << std::endl;
+	std::cout << "range == st: " << (range == st) << std::endl;
+	std::cout << "assigned == st: " << (assigned == st) << std::endl;
+	printSize(copy);
+	printPolicy(copy);
+
+	// The copies are deep
+	copy.erase(5);
+	copy.insert(1000);
+	range.clear();
+	std::cout << "copy == st: " << (copy == st) << std::endl;
+	std::cout << "copy != st: " << (copy != st) << std::endl;
+	printSize(st, false);
+	printSize(copy);
+	printSize(range);
+
+	// Equal elements inserted in another order
+	t_unordered_set_<T1>	reversed;
+
+	for (int i = 39; i >= 0; --i)
+		reversed.insert(i * 5);
+	std::cout << "reversed == st: " << (reversed == st) << std::endl;
+
+	st.swap(copy);
+	printSize(st);
+	swap(st, range);
+	printSize(st);
+	return (0);
+}
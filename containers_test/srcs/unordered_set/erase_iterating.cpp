@@ -0,0 +1,51 @@
+#include "common.hpp"
+
+#define T1 int
+typedef t_unordered_set_<T1>::iterator ft_iterator;
+
+int		main(void)
+{
+	t_unordered_set_<T1>	st;
+
+	for (int i = 0; i < 1000; ++i)
+		st.insert(i);
+
+	// Erasing does not invalidate the other iterators
+	std::size_t	erased = 0;
+
+	for (ft_iterator it = st.begin(); it != st.end();)
+	{
+		if (*it % 3 == 0)
+		{
+			st.erase(it++);
+			++erased;
+		}
+		else
+			++it;
+	}
+	std::cout << "erased: " << erased << std::endl;
+	printSize(st, false);
+	printPolicy(st);
+
+	long	sum = 0;
+
+	for (ft_iterator it = st.begin(); it != st.end(); ++it)
+		sum += *it;
+	std::cout << "sum: " << sum << std::endl;
+
+	// Everything, one at a time, then the table is filled again
+	for (ft_iterator it = st.begin(); it != st.end();)
+		st.erase(it++);
+	printSize(st);
+	for (int i = 0; i < 40; ++i)
+		st.insert(i * 11);
+	for (ft_iterator it = st.begin(); it != st.end();)
+	{
+		if (*it % 2)
+			st.erase(it++);
+		else
+			++it;
+	}
+	printSize(st);
+	return (0);
+}
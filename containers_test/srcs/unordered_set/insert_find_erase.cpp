@@ -0,0 +1,71 @@
+#include "common.hpp"
+
+#define T1 std::string
+typedef t_unordered_set_<T1>::iterator ft_iterator;
+
+t_unordered_set_<T1> st;
+
+void	ft_insert(T1 const &x)
+{
+	_pair<ft_iterator, bool> ret = st.insert(x);
+
+	std::cout << "insert " << x << ": " << printPair(ret.first, false)
+		<< " | inserted: " << ret.second << std::endl;
+}
+
+void	ft_find(T1 const &k)
+{
+	ft_iterator ret = st.find(k);
+
+	if (ret != st.end())
+		printPair(ret);
+	else
+		std::cout << "find(" << k << ") returned end()" << std::endl;
+	std::cout << "count(" << k << "): " << st.count(k) << std::endl;
+}
+
+int		main(void)
+{
+	printSize(st);
+	ft_find("absent");
+
+	ft_insert("one");
+	ft_insert("two");
+	ft_insert("one");
+	ft_insert("");
+	st.insert(st.begin(), "three");
+	st.insert(st.end(), "two");
+	printSize(st);
+	ft_find("one");
+	ft_find("");
+	ft_find("four");
+
+	// Enough elements to grow the table several times
+	for (int i = 0; i < 500; ++i)
+		st.insert(std::string(1, 'a' + i % 26) + std::string(i / 26 + 1, '#'));
+	printSize(st, false);
+	printPolicy(st);
+	ft_find("a#");
+	ft_find("z####");
+
+	std::cout << "erase(\"one\"): " << st.erase("one") << std::endl;
+	std::cout << "erase(\"one\"): " << st.erase("one") << std::endl;
+	st.erase(st.find("two"));
+	ft_find("one");
+	ft_find("two");
+	for (int i = 0; i < 500; i += 2)
+		st.erase(std::string(1, 'a' + i % 26) + std::string(i / 26 + 1, '#'));
+	printSize(st);
+
+	// Erased slots are reused
+	for (int i = 0; i < 500; i += 3)
+		st.insert(std::string(1, 'a' + i % 26) + std::string(i / 26 + 1, '#'));
+	printSize(st, false);
+	printPolicy(st);
+
+	st.erase(st.begin(), st.end());
+	printSize(st);
+	ft_insert("back");
+	printSize(st);
+	return (0);
+}
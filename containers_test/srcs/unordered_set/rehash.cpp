@@ -0,0 +1,85 @@
+#include "common.hpp"
+
+#define T1 int
+
+template <typename T_SET>
+void	ft_rehash(T_SET &st, std::size_t n)
+{
+	std::cout << "\t-- rehash(" << n << ") --" << std::endl;
+#if !defined(USING_STD)
+	st.rehash(n);
+#endif
+	printPolicy(st, n);
+	printSize(st, st.size() < 50);
+}
+
+// Inserting n elements after reserve(n) does not grow the table
+template <typename T_SET>
+void	ft_reserve(T_SET &st, std::size_t n, int first)
+{
+	bool	same = true;
+
+	std::cout << "\t-- reserve(" << n << ") --" << std::endl;
+#if !defined(USING_STD)
+	st.reserve(st.size() + n);
+
+	const std::size_t	buckets = st.bucket_count();
+#endif
+	for (std::size_t i = 0; i < n; ++i)
+		st.insert(first + int(i));
+#if !defined(USING_STD)
+	same = st.bucket_count() == buckets;
+#endif
+	std::cout << "no growth: " << same << std::endl;
+	printPolicy(st);
+	printSize(st, st.size() < 50);
+}
+
+template <typename T_SET>
+void	ft_max_load_factor(T_SET &st, float z)
+{
+	std::cout << "\t-- max_load_factor(" << z << ") --" << std::endl;
+#if !defined(USING_STD)
+	st.max_load_factor(z);
+#else
+	(void)z;
+#endif
+	for (int i = 0; i < 300; ++i)
+		st.insert(i * 7);
+	printPolicy(st);
+	printSize(st, false);
+}
+
+int		main(void)
+{
+	t_unordered_set_<T1>	st;
+
+	ft_rehash(st, 0);
+	ft_rehash(st, 100);
+	for (int i = 0; i < 20; ++i)
+		st.insert(i * 3);
+	ft_rehash(st, 1000);
+	ft_rehash(st, 10);
+
+	ft_reserve(st, 100, 1000);
+	ft_reserve(st, 1000, 5000);
+	st.clear();
+	ft_reserve(st, 30, 0);
+
+	ft_max_load_factor(st, 0.5f);
+	ft_max_load_factor(st, 1.0f);
+	ft_max_load_factor(st, 0.0f);
+
+	// Growing keeps every element
+	for (int i = 0; i < 4000; ++i)
+		st.insert(-i);
+	printPolicy(st);
+	printSize(st, false);
+
+	std::size_t	found = 0;
+
+	for (int i = 0; i < 4000; ++i)
+		found += st.count(-i);
+	std::cout << "found: " << found << std::endl;
+	return (0);
+}
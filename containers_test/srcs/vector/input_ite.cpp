@@ -0,0 +1,78 @@
+#include "common.hpp"
+#include <iterator>
+#include <list>
+#include <sstream>
+
+// Values of both kinds: int is copied in bulk, std::string one by one
+template <typename T>
+T		val(int i);
+
+template <>
+int		val<int>(int i) { return i * 3; }
+
+template <>
+std::string	val<std::string>(int i) { return std::string(i % 4 + 1, 'a' + i % 26); }
+
+// The words of a stream, which istream_iterator reads once
+template <typename T>
+std::string	words(int first, int n)
+{
+	std::ostringstream	o;
+
+	for (int i = first; i < first + n; ++i)
+		o << val<T>(i) << " ";
+	return o.str();
+}
+
+template <typename T>
+void	test(void)
+{
+	typedef std::istream_iterator<T>			in_ite;
+	typedef TESTED_NAMESPACE::vector<T>		t_vct;
+
+	// Range constructor: single pass, then forward
+	std::istringstream	in(words<T>(0, 12));
+	t_vct				vct((in_ite(in)), in_ite());
+	printSize(vct);
+
+	std::list<T>		lst;
+	for (int i = 20; i < 26; ++i)
+		lst.push_back(val<T>(i));
+	t_vct				vct2(lst.begin(), lst.end());
+	printSize(vct2);
+
+	// assign(): larger, smaller, then empty
+	std::istringstream	in2(words<T>(30, 20));
+	vct2.assign(in_ite(in2), in_ite());
+	printSize(vct2);
+	std::istringstream	in3(words<T>(50, 3));
+	vct2.assign(in_ite(in3), in_ite());
+	printSize(vct2);
+	std::istringstream	in4("");
+	vct2.assign(in_ite(in4), in_ite());
+	printSize(vct2);
+	vct2.assign(lst.begin(), lst.end());
+	printSize(vct2);
+
+	// insert(): at the end, in the middle and at the front
+	std::istringstream	in5(words<T>(60, 5));
+	vct.insert(vct.end(), in_ite(in5), in_ite());
+	printSize(vct);
+	std::istringstream	in6(words<T>(70, 7));
+	vct.insert(vct.begin() + 4, in_ite(in6), in_ite());
+	printSize(vct);
+	std::istringstream	in7(words<T>(80, 2));
+	vct.insert(vct.begin(), in_ite(in7), in_ite());
+	printSize(vct);
+	std::istringstream	in8("");
+	vct.insert(vct.begin() + 1, in_ite(in8), in_ite());
+	vct.insert(vct.begin() + 3, lst.begin(), lst.end());
+	printSize(vct);
+}
+
+int		main(void)
+{
+	test<int>();
+	test<std::string>();
+	return (0);
+}
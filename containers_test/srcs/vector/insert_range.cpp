@@ -0,0 +1,71 @@
+#include "common.hpp"
+
+// Values of both kinds: int is moved in bulk, std::string one by one
+template <typename T>
+T		val(int i);
+
+template <>
+int		val<int>(int i) { return i * 7; }
+
+template <>
+std::string	val<std::string>(int i) { return std::string(i % 5 + 1, 'a' + i % 26); }
+
+template <typename T>
+void	fill(TESTED_NAMESPACE::vector<T> &vct, int first, int n)
+{
+	vct.clear();
+	for (int i = first; i < first + n; ++i)
+		vct.push_back(val<T>(i));
+}
+
+// Both implementations reallocate when the capacity is short, and only then
+template <typename T>
+void	insert(TESTED_NAMESPACE::vector<T> &vct, std::size_t pos,
+			   TESTED_NAMESPACE::vector<T> const &src, std::size_t first, std::size_t last)
+{
+	const std::size_t	cap = vct.capacity();
+
+	vct.insert(vct.begin() + pos, src.begin() + first, src.begin() + last);
+	std::cout << "reallocated: " << (vct.capacity() != cap) << std::endl;
+	printSize(vct);
+}
+
+template <typename T>
+void	test(void)
+{
+	TESTED_NAMESPACE::vector<T>	vct;
+	TESTED_NAMESPACE::vector<T>	src;
+
+	fill(src, 100, 10);
+
+	std::cout << "\t### With reallocation ###" << std::endl;
+	fill(vct, 0, 6);
+	insert(vct, 3, src, 0, 10);
+	insert(vct, vct.size(), src, 2, 5);
+	insert(vct, 0, src, 0, 0);
+
+	std::cout << "\t### Without reallocation ###" << std::endl;
+	fill(vct, 0, 6);
+	vct.reserve(40);
+	// Fewer elements than those after the position, then more
+	insert(vct, 4, src, 0, 1);
+	insert(vct, 1, src, 0, 9);
+	insert(vct, vct.size(), src, 5, 10);
+	insert(vct, vct.size() - 1, src, 3, 5);
+
+	std::cout << "\t### From the vector itself ###" << std::endl;
+	// A range before the position is not moved by the insertion
+	fill(vct, 0, 8);
+	insert(vct, vct.size(), vct, 0, vct.size());
+	insert(vct, 5, vct, 0, 3);
+	vct.reserve(vct.size() * 3);
+	insert(vct, vct.size(), vct, 0, vct.size());
+	insert(vct, 10, vct, 2, 6);
+}
+
+int		main(void)
+{
+	test<int>();
+	test<std::string>();
+	return (0);
+}
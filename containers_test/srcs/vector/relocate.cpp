@@ -0,0 +1,63 @@
+#include "common.hpp"
+
+// Trivially copyable class: moved with memmove, like int
+struct point
+{
+	int		x;
+	int		y;
+};
+
+std::ostream	&operator<<(std::ostream &o, point const &p)
+{ return o << "(" << p.x << ", " << p.y << ")"; }
+
+template <typename T>
+T		val(int i);
+
+template <>
+int		val<int>(int i) { return i * 5; }
+
+template <>
+point	val<point>(int i) { point p = { i, -i }; return p; }
+
+template <>
+std::string	val<std::string>(int i) { return std::string(i % 3 + 1, 'a' + i % 26); }
+
+template <typename T>
+void	test(void)
+{
+	TESTED_NAMESPACE::vector<T>	vct;
+
+	// Growth by push_back() and reserve()
+	for (int i = 0; i < 20; ++i)
+		vct.push_back(val<T>(i));
+	vct.reserve(100);
+	printSize(vct);
+
+	// Fill insert, with and without reallocation, of a value that
+	// lives in the vector itself
+	vct.insert(vct.begin() + 3, 4, vct[10]);
+	vct.insert(vct.end(), 2, vct[0]);
+	vct.insert(vct.begin(), 1, vct.back());
+	printSize(vct);
+	vct.insert(vct.begin() + 7, 90, vct[8]);
+	vct.insert(vct.begin() + 1, vct[2]);
+	std::cout << "size: " << vct.size() << " | [0]: " << vct[0]
+		<< " | [7]: " << vct[7] << " | [100]: " << vct[100] << std::endl;
+
+	// Erase at the front, in the middle and at the end
+	vct.erase(vct.begin() + 6, vct.begin() + 100);
+	vct.erase(vct.begin());
+	vct.erase(vct.begin() + 4);
+	vct.erase(vct.end() - 3, vct.end());
+	printSize(vct);
+	vct.erase(vct.begin(), vct.end());
+	printSize(vct);
+}
+
+int		main(void)
+{
+	test<int>();
+	test<point>();
+	test<std::string>();
+	return (0);
+}
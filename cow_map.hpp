@@ -0,0 +1,429 @@
+#ifndef _FT_COW_MAP_HPP
+#define _FT_COW_MAP_HPP
+
+#include <functional>
+#include <memory>
+#include <new>
+
+#include "algorithm.hpp"
+#include "atomic.hpp"
+#include "utility.hpp"
+#include "map.hpp"
+#include "pool_allocator.hpp"
+
+/*************************************************************
+ * cow_map
+
+ * An ft::map whose copies are free until they change: copies share
+	one map, with a count of the cow_maps that point to it, and the
+	first non-const operation of a copy makes it its own map, with a
+	deep copy, unless it is the only one left.
+ * cow_maps sharing a map may live on different threads: the count is
+	atomic, and the shared map is never changed. A const operation
+	only reads the map, without touching the count.
+ * Iterators are all const_iterators, and lookups never copy the map:
+	a copy passed by value and only read stays shared. The first change
+	to a shared copy invalidates every iterator taken from it, as they
+	point into the map it no longer uses. The elements
+	are changed through insert_or_assign(), or through the references
+	of operator[] and at(): these mark the map as unshareable, as
+	std::string did, as the reference could change it later. An
+	unshareable map is copied at once by the next copy of the cow_map,
+	until make_shareable() says the references are no longer used.
+ * Alloc must not keep state: cow_map<..., pool_allocator<...> > does
+	not compile.
+*************************************************************/
+
+namespace ft
+{
+	template <typename Key, typename T, typename Compare = std::less<Key>,
+			  typename Alloc = std::allocator<ft::pair<const Key, T> > >
+	class cow_map
+	{
+
+	public:
+		/*************************************************************
+		 * Types
+		 *************************************************************/
+		typedef ft::map<Key, T, Compare, Alloc>	map_type;
+
+		typedef typename map_type::key_type					key_type;
+		typedef typename map_type::mapped_type				mapped_type;
+		typedef typename map_type::value_type				value_type;
+		typedef typename map_type::key_compare				key_compare;
+		typedef typename map_type::value_compare			value_compare;
+		typedef typename map_type::allocator_type			allocator_type;
+		typedef typename map_type::pointer					pointer;
+		typedef typename map_type::const_pointer			const_pointer;
+		typedef typename map_type::reference				reference;
+		typedef typename map_type::const_reference			const_reference;
+		typedef typename map_type::const_iterator			iterator;
+		typedef typename map_type::const_iterator			const_iterator;
+		typedef typename map_type::size_type				size_type;
+		typedef typename map_type::difference_type			difference_type;
+		typedef typename map_type::const_reverse_iterator	reverse_iterator;
+		typedef typename map_type::const_reverse_iterator	const_reverse_iterator;
+
+	private:
+		struct shared_map
+		{
+			explicit shared_map(const map_type &m) : map(m), refs(1), shareable(true) {}
+
+			shared_map(const key_compare &comp, const allocator_type &alloc)
+				: map(comp, alloc), refs(1), shareable(true) {}
+
+			map_type	map;
+			std::size_t	refs;		// cow_maps pointing here
+			bool		shareable;	// No reference was given out
+		};
+
+		typedef typename Alloc::template rebind<shared_map>::other	shared_allocator;
+		typedef ft::is_pool_allocator<shared_allocator>				pooled;
+
+	public:
+		/*************************************************************
+		 * Construct/Copy/Destroy
+		 *************************************************************/
+		// Default constructor creates no elements
+		cow_map() : _p(create(key_compare(), allocator_type())) {}
+
+		explicit cow_map(const key_compare &comp,
+						 const allocator_type &alloc = allocator_type())
+			: _p(create(comp, alloc)) {}
+
+		explicit cow_map(const map_type &m) : _p(create(m)) {}
+
+		// Shares the map of x, in O(1), unless it is unshareable
+		cow_map(const cow_map &x) : _p(share(x._p)) {}
+
+		// The map is built apart and swapped into the empty one of the
+		// block, instead of being copied into it
+		template <typename InputIterator>
+		cow_map(InputIterator first, InputIterator last,
+				const Compare &comp = Compare(),
+				const allocator_type &alloc = allocator_type())
+			: _p(create(comp, alloc))
+		{
+			try
+			{
+				map_type m(first, last, comp, alloc);
+
+				_p->map.swap(m);
+			}
+			catch (...)
+			{ release(_p); throw; }
+		}
+
+		~cow_map() { release(_p); }
+
+		/*************************************************************
+		 *  Assignment operator
+		 *************************************************************/
+		cow_map &operator=(const cow_map &x)
+		{
+			cow_map tmp(x);
+
+			swap(tmp);
+			return *this;
+		}
+
+		/*************************************************************
+		 *  The map itself, read only
+		 *************************************************************/
+		const map_type &get() const { return _p->map; }
+
+		allocator_type get_allocator() const { return _p->map.get_allocator(); }
+
+		/*************************************************************
+		 * Iterators
+		 *************************************************************/
+		const_iterator begin() const { return _p->map.begin(); }
+
+		const_iterator end() const { return _p->map.end(); }
+
+		const_reverse_iterator rbegin() const { return _p->map.rbegin(); }
+
+		const_reverse_iterator rend() const { return _p->map.rend(); }
+
+		/*************************************************************
+		 * Capacity
+		 *************************************************************/
+		bool empty() const { return _p->map.empty(); }
+
+		size_type size() const { return _p->map.size(); }
+
+		size_type max_size() const { return _p->map.max_size(); }
+
+		/*************************************************************
+		 * Element access
+		 *************************************************************/
+		// Both mark the map as unshareable
+		mapped_type &operator[](const key_type &k) { return leak()[k]; }
+
+		mapped_type &at(const key_type &k) { return leak().at(k); }
+		const mapped_type &at(const key_type &k) const { return _p->map.at(k); }
+
+		// No reference given out by operator[] or at() is used anymore:
+		// the next copies share the map again. An unshareable map is never
+		// shared, so the flag is only written while no other thread reads it.
+		void make_shareable()
+		{
+			if (!_p->shareable)
+				_p->shareable = true;
+		}
+
+		/*************************************************************
+		 * Modifiers
+		 *************************************************************/
+		// A key already there changes nothing: the map stays shared
+		ft::pair<const_iterator, bool> insert(const value_type &x)
+		{
+			const const_iterator it = _p->map.find(x.first);
+
+			if (it != _p->map.end())
+				return ft::make_pair(it, false);
+			return own().insert(x);
+		}
+
+		// The hint is dropped when the map has to be copied first, as it
+		// points into the shared one
+		const_iterator insert(const_iterator position, const value_type &x)
+		{
+			if (ft::atomic_load(&_p->refs) != 1)
+				return own().insert(x).first;
+			return _p->map.insert(position, x);
+		}
+
+		template <typename InputIterator>
+		void insert(InputIterator first, InputIterator last)
+		{ own().insert(first, last); }
+
+		ft::pair<const_iterator, bool> try_emplace(const key_type &k)
+		{
+			const const_iterator it = _p->map.find(k);
+
+			if (it != _p->map.end())
+				return ft::make_pair(it, false);
+			return own().try_emplace(k);
+		}
+
+		template <typename Arg>
+		ft::pair<const_iterator, bool> try_emplace(const key_type &k, const Arg &arg)
+		{
+			const const_iterator it = _p->map.find(k);
+
+			if (it != _p->map.end())
+				return ft::make_pair(it, false);
+			return own().try_emplace(k, arg);
+		}
+
+		template <typename M>
+		ft::pair<const_iterator, bool> insert_or_assign(const key_type &k, const M &obj)
+		{ return own().insert_or_assign(k, obj); }
+
+		// An iterator into a shared map is found again in the copy
+		void erase(const_iterator position)
+		{
+			if (ft::atomic_load(&_p->refs) != 1)
+			{
+				const key_type k = position->first;
+
+				own().erase(k);
+			}
+			else
+				_p->map.erase(position._const_cast());
+		}
+
+		size_type erase(const key_type &x)
+		{
+			if (_p->map.find(x) == _p->map.end())
+				return 0;
+			return own().erase(x);
+		}
+
+		void erase(const_iterator first, const_iterator last)
+		{
+			if (ft::atomic_load(&_p->refs) != 1)
+			{
+				if (first == last)
+					return;
+				// The bounds, found again in the copy
+				const key_type k = first->first;
+				const bool to_end = last == end();
+				map_type &m = own();
+
+				if (to_end)
+					m.erase(m.find(k), m.end());
+				else
+				{
+					const key_type l = last->first;
+
+					m.erase(m.find(k), m.find(l));
+				}
+			}
+			else
+				_p->map.erase(first._const_cast(), last._const_cast());
+		}
+
+		void swap(cow_map &x) { ft::swap(_p, x._p); }
+
+		// Lets go of a shared map without copying it
+		void clear()
+		{
+			if (ft::atomic_load(&_p->refs) == 1)
+				_p->map.clear();
+			else
+			{
+				shared_map *p = create(key_comp(), get_allocator());
+
+				release(_p);
+				_p = p;
+			}
+		}
+
+		/*************************************************************
+		 * Observers
+		 *************************************************************/
+		key_compare key_comp() const { return _p->map.key_comp(); }
+
+		value_compare value_comp() const { return _p->map.value_comp(); }
+
+		/*************************************************************
+		 * Map operations
+		 *************************************************************/
+		const_iterator find(const key_type &x) const { return _p->map.find(x); }
+
+		size_type count(const key_type &x) const { return _p->map.count(x); }
+
+		const_iterator lower_bound(const key_type &x) const
+		{ return _p->map.lower_bound(x); }
+
+		const_iterator upper_bound(const key_type &x) const
+		{ return _p->map.upper_bound(x); }
+
+		ft::pair<const_iterator, const_iterator> equal_range(const key_type &x) const
+		{ return _p->map.equal_range(x); }
+
+	private:
+		// The block is allocated and freed by allocators built on the spot,
+		// which a pool_allocator cannot do: it frees its slabs when the
+		// temporary is destroyed
+		shared_map *create(const map_type &m)
+		{
+			shared_map *p = allocate_block();
+
+			try
+			{ new (p) shared_map(m); }
+			catch (...)
+			{ shared_allocator().deallocate(p, 1); throw; }
+			return p;
+		}
+
+		// A block around an empty map
+		shared_map *create(const key_compare &comp, const allocator_type &alloc)
+		{
+			shared_map *p = allocate_block();
+
+			try
+			{ new (p) shared_map(comp, alloc); }
+			catch (...)
+			{ shared_allocator().deallocate(p, 1); throw; }
+			return p;
+		}
+
+		static shared_map *allocate_block()
+		{
+			typedef char pooled_maps_cannot_be_shared[pooled::value ? -1 : 1];
+
+			(void)sizeof(pooled_maps_cannot_be_shared);
+
+			shared_allocator a;
+
+			return a.allocate(1);
+		}
+
+		shared_map *share(shared_map *p)
+		{
+			if (!p->shareable)
+				return create(p->map);
+			ft::atomic_fetch_add(&p->refs, std::size_t(1));
+			return p;
+		}
+
+		static void release(shared_map *p)
+		{
+			if (ft::atomic_fetch_sub(&p->refs, std::size_t(1)) != 1)
+				return;
+
+			shared_allocator a;
+
+			p->~shared_map();
+			a.deallocate(p, 1);
+		}
+
+		// The map, copied first if another cow_map shares it. A count of
+		// 1 cannot grow behind our back: only this cow_map could share it.
+		map_type &own()
+		{
+			if (ft::atomic_load(&_p->refs) != 1)
+			{
+				shared_map *p = create(_p->map);
+
+				release(_p);
+				_p = p;
+			}
+			return _p->map;
+		}
+
+		map_type &leak()
+		{
+			map_type &m = own();
+
+			_p->shareable = false;
+			return m;
+		}
+
+		shared_map	*_p;
+
+	}; // cow_map
+
+	/*************************************************************
+	 *  Relational operators
+	 *************************************************************/
+	template <typename Key, typename T, typename Compare, typename Alloc>
+	bool operator==(const cow_map<Key, T, Compare, Alloc> &x,
+					const cow_map<Key, T, Compare, Alloc> &y)
+	{ return x.get() == y.get(); }
+
+	template <typename Key, typename T, typename Compare, typename Alloc>
+	bool operator!=(const cow_map<Key, T, Compare, Alloc> &x,
+					const cow_map<Key, T, Compare, Alloc> &y)
+	{ return x.get() != y.get(); }
+
+	template <typename Key, typename T, typename Compare, typename Alloc>
+	bool operator<(const cow_map<Key, T, Compare, Alloc> &x,
+				   const cow_map<Key, T, Compare, Alloc> &y)
+	{ return x.get() < y.get(); }
+
+	template <typename Key, typename T, typename Compare, typename Alloc>
+	bool operator>(const cow_map<Key, T, Compare, Alloc> &x,
+				   const cow_map<Key, T, Compare, Alloc> &y)
+	{ return y < x; }
+
+	template <typename Key, typename T, typename Compare, typename Alloc>
+	bool operator<=(const cow_map<Key, T, Compare, Alloc> &x,
+					const cow_map<Key, T, Compare, Alloc> &y)
+	{ return !(y < x); }
+
+	template <typename Key, typename T, typename Compare, typename Alloc>
+	bool operator>=(const cow_map<Key, T, Compare, Alloc> &x,
+					const cow_map<Key, T, Compare, Alloc> &y)
+	{ return !(x < y); }
+
+	template <typename Key, typename T, typename Compare, typename Alloc>
+	void swap(cow_map<Key, T, Compare, Alloc> &x, cow_map<Key, T, Compare, Alloc> &y)
+	{ x.swap(y); }
+
+} // namespace ft
+
+#endif /* _FT_COW_MAP_HPP */
@@ -0,0 +1,743 @@
+#ifndef _FT_DEQUE_HPP
+#define _FT_DEQUE_HPP
+
+#include <memory>
+#include <iterator>
+#include <stdexcept>
+
+#include "algorithm.hpp"
+#include "type_traits.hpp"
+#include "iterator.hpp"
+#include "utility.hpp"
+
+namespace ft
+{
+
+	/*************************************************************
+	 * deque_iterator
+
+	 * A position in a deque: the element, the bounds of the block
+		that holds it, and the slot of that block in the map of the
+		deque. Moving past the end of a block goes on to the next
+		block of the map.
+	*************************************************************/
+	template <bool Is_const, class T>
+	class deque_iterator
+	{
+		template <bool, class>
+		friend class deque_iterator;
+
+		template <class, class>
+		friend class deque;
+
+	public:
+		/*************************************************************
+		 * Types
+		 *************************************************************/
+		typedef std::ptrdiff_t							difference_type;
+		typedef std::size_t								size_type;
+		typedef typename ft::conditional<Is_const, const T, T>::type value_type;
+		typedef value_type*								pointer;
+		typedef value_type&								reference;
+		typedef std::random_access_iterator_tag			iterator_category;
+
+		typedef deque_iterator<Is_const, T>				self;
+		typedef T**										map_pointer;
+
+		// Elements in a block: as many as fit in 512 bytes, at least one
+		static size_type block_size()
+		{ return sizeof(T) < 512 ? size_type(512 / sizeof(T)) : size_type(1); }
+
+		/*************************************************************
+		 * Construct/Copy/Destroy
+		 *************************************************************/
+		deque_iterator() : _cur(0), _first(0), _last(0), _node(0) {}
+
+		deque_iterator(T *x, map_pointer y)
+			: _cur(x), _first(*y), _last(*y + block_size()), _node(y) {}
+
+		// Copy constructor adapted to both const and regular iterator
+		template <bool B>
+		deque_iterator(const deque_iterator<B, T> &x, typename ft::enable_if<!B>::type * = 0)
+			: _cur(x._cur), _first(x._first), _last(x._last), _node(x._node) {}
+
+		/*************************************************************
+		 * Accessing operators
+		 *************************************************************/
+		reference operator*() const { return *_cur; }
+		pointer operator->() const { return _cur; }
+		reference operator[](difference_type n) const { return *(*this + n); }
+
+		/*************************************************************
+		 * Incrementing operators
+		 *************************************************************/
+		self &operator++()
+		{
+			if (++_cur == _last)
+			{
+				set_node(_node + 1);
+				_cur = _first;
+			}
+			return *this;
+		}
+
+		self operator++(int)
+		{
+			self tmp(*this);
+
+			++*this;
+			return tmp;
+		}
+
+		self &operator--()
+		{
+			if (_cur == _first)
+			{
+				set_node(_node - 1);
+				_cur = _last;
+			}
+			--_cur;
+			return *this;
+		}
+
+		self operator--(int)
+		{
+			self tmp(*this);
+
+			--*this;
+			return tmp;
+		}
+
+		/*************************************************************
+		 * Arithmetic operators
+		 *************************************************************/
+		self &operator+=(difference_type n)
+		{
+			const difference_type bs = difference_type(block_size());
+			const difference_type offset = n + (_cur - _first);
+
+			if (offset >= 0 && offset < bs)
+				_cur += n;
+			else
+			{
+				const difference_type node_offset =
+					offset > 0 ? offset / bs : -((-offset - 1) / bs) - 1;
+
+				set_node(_node + node_offset);
+				_cur = _first + (offset - node_offset * bs);
+			}
+			return *this;
+		}
+
+		self &operator-=(difference_type n) { return *this += -n; }
+
+		self operator+(difference_type n) const
+		{
+			self tmp(*this);
+
+			return tmp += n;
+		}
+
+		self operator-(difference_type n) const
+		{
+			self tmp(*this);
+
+			return tmp -= n;
+		}
+
+		// When adding a number from the front of the iterator: n + it
+		friend self operator+(difference_type n, const self &x) { return x + n; }
+
+		template <bool B>
+		difference_type operator-(const deque_iterator<B, T> &x) const
+		{
+			return difference_type(block_size()) * (_node - x._node - 1)
+				+ (_cur - _first) + (x._last - x._cur);
+		}
+
+		/*************************************************************
+		 * Boolean operators
+		 *************************************************************/
+		template <bool B>
+		bool operator==(const deque_iterator<B, T> &x) const { return _cur == x._cur; }
+
+		template <bool B>
+		bool operator!=(const deque_iterator<B, T> &x) const { return _cur != x._cur; }
+
+		template <bool B>
+		bool operator<(const deque_iterator<B, T> &x) const
+		{ return _node == x._node ? _cur < x._cur : _node < x._node; }
+
+		template <bool B>
+		bool operator>(const deque_iterator<B, T> &x) const { return x < *this; }
+
+		template <bool B>
+		bool operator<=(const deque_iterator<B, T> &x) const { return !(x < *this); }
+
+		template <bool B>
+		bool operator>=(const deque_iterator<B, T> &x) const { return !(*this < x); }
+
+	private:
+		void set_node(map_pointer node)
+		{
+			_node = node;
+			_first = *node;
+			_last = _first + block_size();
+		}
+
+		T			*_cur;
+		T			*_first;
+		T			*_last;
+		map_pointer	_node;
+	}; // deque_iterator
+
+	/*************************************************************
+	 * deque
+
+	 * A double-ended queue: fixed time insertion and removal at both
+		ends, and fixed time access to any element.
+
+	 * The elements are stored in blocks of a fixed size, which never
+		move once allocated. A map, an array of pointers to the blocks,
+		keeps them in order, with free slots on both sides: pushing at
+		either end fills the first or last block, or allocates a new
+		one in the next slot of the map. Only the map is reallocated
+		when it runs out of slots, in time proportional to the number
+		of blocks, so that growing never copies an element.
+	 * There is always a block past the last element: the end iterator
+		points into it.
+	*************************************************************/
+	template <class T, class Alloc = std::allocator<T> >
+	class deque
+	{
+
+	public:
+		/*************************************************************
+		 * Types
+		 *************************************************************/
+		typedef Alloc									allocator_type;
+		typedef typename allocator_type::reference		reference;
+		typedef typename allocator_type::const_reference	const_reference;
+		typedef T										value_type;
+		typedef ft::deque_iterator<false, value_type>	iterator;
+		typedef ft::deque_iterator<true, value_type>	const_iterator;
+		typedef std::size_t								size_type;
+		typedef std::ptrdiff_t							difference_type;
+		typedef typename allocator_type::pointer		pointer;
+		typedef typename allocator_type::const_pointer	const_pointer;
+		typedef ft::reverse_iterator<iterator>			reverse_iterator;
+		typedef ft::reverse_iterator<const_iterator>	const_reverse_iterator;
+
+		/*************************************************************
+		 * Construct/Copy/Destroy
+		 *************************************************************/
+		// Creates a deque with no elements
+		explicit deque(const allocator_type &alloc = allocator_type())
+			: _alloc(alloc), _map(0), _map_size(0)
+		{ initialize_map(0); }
+
+		// Fill constructor
+		explicit deque(size_type n, const value_type &val = value_type(),
+					   const allocator_type &alloc = allocator_type())
+			: _alloc(alloc), _map(0), _map_size(0)
+		{
+			initialize_map(n);
+			try
+			{ insert(end(), n, val); }
+			catch (...)
+			{ release(); throw; }
+		}
+
+		// Range constructor
+		template <class InputIterator>
+		deque(InputIterator first, InputIterator last,
+			  const allocator_type &alloc = allocator_type(),
+			  typename ft::enable_if<!ft::is_integral<InputIterator>::value>::type * = 0)
+			: _alloc(alloc), _map(0), _map_size(0)
+		{
+			initialize_map(0);
+			try
+			{
+				for (; first != last; ++first)
+					push_back(*first);
+			}
+			catch (...)
+			{ release(); throw; }
+		}
+
+		deque(const deque &x) : _alloc(x._alloc), _map(0), _map_size(0)
+		{
+			initialize_map(x.size());
+			try
+			{
+				for (const_iterator it = x.begin(); it != x.end(); ++it)
+					push_back(*it);
+			}
+			catch (...)
+			{ release(); throw; }
+		}
+
+		~deque() { release(); }
+
+		/*************************************************************
+		 * Assigning operator
+		 *************************************************************/
+		deque &operator=(const deque &x)
+		{
+			if (this != &x)
+				assign(x.begin(), x.end());
+			return *this;
+		}
+
+		// Existing elements are assigned in place, the remainder is either
+		// appended or erased.
+		template <class InputIterator>
+		void assign(InputIterator first, InputIterator last,
+					typename ft::enable_if<!ft::is_integral<InputIterator>::value>::type * = 0)
+		{
+			iterator cur(begin());
+
+			for (; first != last && cur != end(); ++cur, ++first)
+				*cur = *first;
+			if (first == last)
+				erase(cur, end());
+			else
+				for (; first != last; ++first)
+					push_back(*first);
+		}
+
+		void assign(size_type n, const value_type &val)
+		{
+			if (n > size())
+			{
+				ft::fill(begin(), end(), val);
+				insert(end(), n - size(), val);
+			}
+			else
+			{
+				erase(begin() + n, end());
+				ft::fill(begin(), end(), val);
+			}
+		}
+
+		/*************************************************************
+		 * Get a copy of the memory allocation object
+		 *************************************************************/
+		allocator_type get_allocator() const { return _alloc; }
+
+		/*************************************************************
+		 * Iterators
+		 *************************************************************/
+		iterator begin() { return _start; }
+		const_iterator begin() const { return _start; }
+
+		iterator end() { return _finish; }
+		const_iterator end() const { return _finish; }
+
+		reverse_iterator rbegin() { return reverse_iterator(end()); }
+		const_reverse_iterator rbegin() const { return const_reverse_iterator(end()); }
+
+		reverse_iterator rend() { return reverse_iterator(begin()); }
+		const_reverse_iterator rend() const { return const_reverse_iterator(begin()); }
+
+		/*************************************************************
+		 * Capacity
+		 *************************************************************/
+		size_type size() const { return _finish - _start; }
+
+		size_type max_size() const { return _alloc.max_size(); }
+
+		void resize(size_type sz, value_type c = value_type())
+		{
+			const size_type len = size();
+
+			if (sz > len)
+				insert(end(), sz - len, c);
+			else if (sz < len)
+				erase(begin() + sz, end());
+		}
+
+		bool empty() const { return _finish == _start; }
+
+		/*************************************************************
+		 * Element access
+		 *************************************************************/
+		reference operator[](size_type n) { return _start[difference_type(n)]; }
+		const_reference operator[](size_type n) const { return _start[difference_type(n)]; }
+
+		reference at(size_type n)
+		{
+			range_check(n);
+			return (*this)[n];
+		}
+
+		const_reference at(size_type n) const
+		{
+			range_check(n);
+			return (*this)[n];
+		}
+
+		reference front() { return *_start; }
+		const_reference front() const { return *_start; }
+
+		reference back() { return *(_finish - 1); }
+		const_reference back() const { return *(_finish - 1); }
+
+		/*************************************************************
+		 * Modifiers
+		 *************************************************************/
+		void push_back(const value_type &x)
+		{
+			if (_finish._cur != _finish._last - 1)
+			{
+				_alloc.construct(_finish._cur, x);
+				++_finish._cur;
+			}
+			else
+				push_back_aux(x);
+		}
+
+		void push_front(const value_type &x)
+		{
+			if (_start._cur != _start._first)
+			{
+				_alloc.construct(_start._cur - 1, x);
+				--_start._cur;
+			}
+			else
+				push_front_aux(x);
+		}
+
+		void pop_back()
+		{
+			if (_finish._cur == _finish._first)
+			{
+				deallocate_node(_finish._first);
+				_finish.set_node(_finish._node - 1);
+				_finish._cur = _finish._last;
+			}
+			--_finish._cur;
+			_alloc.destroy(_finish._cur);
+		}
+
+		void pop_front()
+		{
+			_alloc.destroy(_start._cur);
+			if (_start._cur == _start._last - 1)
+			{
+				deallocate_node(_start._first);
+				_start.set_node(_start._node + 1);
+				_start._cur = _start._first;
+			}
+			else
+				++_start._cur;
+		}
+
+		iterator insert(iterator position, const value_type &x)
+		{
+			const difference_type pos = position - begin();
+
+			if (pos == 0)
+			{
+				push_front(x);
+				return begin();
+			}
+			insert(position, 1, x);
+			return begin() + pos;
+		}
+
+		// The elements are made room for on the side of position that has
+		// fewer elements, which are shifted by n.
+		void insert(iterator position, size_type n, const value_type &x)
+		{
+			if (n == 0)
+				return;
+			// x may live inside the deque, so copy it before shifting
+			const value_type copy(x);
+			const size_type pos = position - begin();
+
+			if (pos < size() - pos)
+			{
+				for (size_type i(0); i < n; ++i)
+					push_front(copy);
+				ft::copy(begin() + n, begin() + (n + pos), begin());
+			}
+			else
+			{
+				const size_type len = size();
+
+				for (size_type i(0); i < n; ++i)
+					push_back(copy);
+				ft::copy_backward(begin() + pos, begin() + len, end());
+			}
+			ft::fill(begin() + pos, begin() + (pos + n), copy);
+		}
+
+		template <class InputIterator>
+		void insert(iterator position, InputIterator first, InputIterator last,
+					typename ft::enable_if<!ft::is_integral<InputIterator>::value>::type * = 0)
+		{
+			range_insert(position, first, last,
+				typename ft::iterator_traits<InputIterator>::iterator_category());
+		}
+
+		iterator erase(iterator position) { return erase(position, position + 1); }
+
+		// The elements on the shorter side of the range are shifted over it
+		iterator erase(iterator first, iterator last)
+		{
+			const size_type n = last - first;
+			const size_type before = first - begin();
+
+			if (n == 0)
+				return first;
+			if (before < size() - n - before)
+			{
+				ft::copy_backward(begin(), first, last);
+				for (size_type i(0); i < n; ++i)
+					pop_front();
+			}
+			else
+			{
+				ft::copy(last, end(), first);
+				for (size_type i(0); i < n; ++i)
+					pop_back();
+			}
+			return begin() + before;
+		}
+
+		void swap(deque &x)
+		{
+			ft::swap(_alloc, x._alloc);
+			ft::swap(_map, x._map);
+			ft::swap(_map_size, x._map_size);
+			ft::swap(_start, x._start);
+			ft::swap(_finish, x._finish);
+		}
+
+		// Keeps the block of the end iterator, and frees the others
+		void clear()
+		{
+			while (!empty())
+				pop_back();
+		}
+
+	private:
+		typedef typename Alloc::template rebind<value_type *>::other	map_allocator;
+		typedef value_type												**map_pointer;
+
+		enum { initial_map_size = 8 };
+
+		allocator_type	_alloc;
+		map_pointer		_map;
+		size_type		_map_size;
+		iterator		_start;
+		iterator		_finish;
+
+		// Same message as libstdc++
+		void range_check(size_type n) const
+		{
+			if (n >= size())
+				std::__throw_out_of_range_fmt(__N("deque::_M_range_check: __n "
+					"(which is %zu)>= this->size() (which is %zu)"), n, size());
+		}
+
+		value_type *allocate_node()
+		{ return _alloc.allocate(iterator::block_size()); }
+
+		void deallocate_node(value_type *p)
+		{ _alloc.deallocate(p, iterator::block_size()); }
+
+		// A map with room for n elements after the first block, which is
+		// the only one allocated, in the middle of the map
+		void initialize_map(size_type n)
+		{
+			const size_type nodes = n / iterator::block_size() + 1;
+
+			_map_size = nodes + 2 > size_type(initial_map_size)
+				? nodes + 2 : size_type(initial_map_size);
+			_map = map_allocator(_alloc).allocate(_map_size);
+
+			map_pointer start = _map + (_map_size - nodes) / 2;
+
+			try
+			{ *start = allocate_node(); }
+			catch (...)
+			{
+				map_allocator(_alloc).deallocate(_map, _map_size);
+				_map = 0;
+				throw;
+			}
+			_start.set_node(start);
+			_start._cur = _start._first;
+			_finish = _start;
+		}
+
+		// Destroys the elements, and frees the blocks and the map
+		void release()
+		{
+			clear();
+			deallocate_node(_start._first);
+			map_allocator(_alloc).deallocate(_map, _map_size);
+		}
+
+		// Called when the last block is full but for the end slot
+		void push_back_aux(const value_type &x)
+		{
+			reserve_map_at_back();
+			*(_finish._node + 1) = allocate_node();
+			try
+			{ _alloc.construct(_finish._cur, x); }
+			catch (...)
+			{
+				deallocate_node(*(_finish._node + 1));
+				throw;
+			}
+			_finish.set_node(_finish._node + 1);
+			_finish._cur = _finish._first;
+		}
+
+		// Called when the first block is full
+		void push_front_aux(const value_type &x)
+		{
+			reserve_map_at_front();
+			*(_start._node - 1) = allocate_node();
+			try
+			{ _alloc.construct(*(_start._node - 1) + iterator::block_size() - 1, x); }
+			catch (...)
+			{
+				deallocate_node(*(_start._node - 1));
+				throw;
+			}
+			_start.set_node(_start._node - 1);
+			_start._cur = _start._last - 1;
+		}
+
+		void reserve_map_at_back()
+		{
+			if (_finish._node + 2 > _map + _map_size)
+				reallocate_map(false);
+		}
+
+		void reserve_map_at_front()
+		{
+			if (_start._node == _map)
+				reallocate_map(true);
+		}
+
+		// Makes room for one more block at the front or at the back: the
+		// blocks are centered in the map if it is at most half full, and
+		// moved to a map twice as large otherwise.
+		void reallocate_map(bool at_front)
+		{
+			const size_type old_nodes = _finish._node - _start._node + 1;
+			const size_type new_nodes = old_nodes + 1;
+			map_pointer new_start;
+
+			if (_map_size > 2 * new_nodes)
+			{
+				new_start = _map + (_map_size - new_nodes) / 2 + (at_front ? 1 : 0);
+				if (new_start < _start._node)
+					ft::copy(_start._node, _finish._node + 1, new_start);
+				else
+					ft::copy_backward(_start._node, _finish._node + 1, new_start + old_nodes);
+			}
+			else
+			{
+				const size_type new_map_size = _map_size * 2 + 2;
+				map_pointer new_map = map_allocator(_alloc).allocate(new_map_size);
+
+				new_start = new_map + (new_map_size - new_nodes) / 2 + (at_front ? 1 : 0);
+				ft::copy(_start._node, _finish._node + 1, new_start);
+				map_allocator(_alloc).deallocate(_map, _map_size);
+				_map = new_map;
+				_map_size = new_map_size;
+			}
+			_start.set_node(new_start);
+			_finish.set_node(new_start + old_nodes - 1);
+		}
+
+		// Input iterators can only be walked once: they are copied aside
+		// and then inserted as a forward range.
+		template <class InputIterator>
+		void range_insert(iterator position, InputIterator first,
+						  InputIterator last, std::input_iterator_tag)
+		{
+			if (position == end())
+			{
+				for (; first != last; ++first)
+					push_back(*first);
+			}
+			else if (first != last)
+			{
+				deque tmp(first, last, _alloc);
+
+				insert(position, tmp.begin(), tmp.end());
+			}
+		}
+
+		// Room is made as in the fill insert(), with copies of the range
+		// that are then overwritten in order.
+		template <class ForwardIterator>
+		void range_insert(iterator position, ForwardIterator first,
+						  ForwardIterator last, std::forward_iterator_tag)
+		{
+			const size_type n = ft::distance(first, last);
+			const size_type pos = position - begin();
+
+			if (n == 0)
+				return;
+			if (pos < size() - pos)
+			{
+				for (ForwardIterator it(first); it != last; ++it)
+					push_front(*it);
+				ft::copy(begin() + n, begin() + (n + pos), begin());
+			}
+			else
+			{
+				const size_type len = size();
+
+				for (ForwardIterator it(first); it != last; ++it)
+					push_back(*it);
+				ft::copy_backward(begin() + pos, begin() + len, end());
+			}
+			ft::copy(first, last, begin() + pos);
+		}
+	}; // deque
+
+	/*************************************************************
+	 *  Relational operators
+	 *************************************************************/
+	template <class T, class Alloc>
+	bool operator==(const deque<T, Alloc> &l, const deque<T, Alloc> &r)
+	{
+		if (l.size() != r.size())
+			return false;
+		return ft::equal(l.begin(), l.end(), r.begin());
+	}
+
+	template <class T, class Alloc>
+	bool operator!=(const deque<T, Alloc> &l, const deque<T, Alloc> &r) { return !(l == r); }
+
+	template <class T, class Alloc>
+	bool operator<(const deque<T, Alloc> &l, const deque<T, Alloc> &r)
+	{
+		return ft::lexicographical_compare(l.begin(), l.end(), r.begin(), r.end());
+	}
+
+	template <class T, class Alloc>
+	bool operator<=(const deque<T, Alloc> &l, const deque<T, Alloc> &r) { return !(r < l); }
+
+	template <class T, class Alloc>
+	bool operator>(const deque<T, Alloc> &l, const deque<T, Alloc> &r) { return r < l; }
+
+	template <class T, class Alloc>
+	bool operator>=(const deque<T, Alloc> &l, const deque<T, Alloc> &r) { return !(l < r); }
+
+	// See ft::deque::swap().
+	template <class T, class Alloc>
+	void swap(deque<T, Alloc> &x, deque<T, Alloc> &y) { x.swap(y); }
+
+} // namespace ft
+
+#endif /* _FT_DEQUE_HPP */
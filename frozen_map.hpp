@@ -0,0 +1,524 @@
+#ifndef _FT_FROZEN_MAP_HPP
+#define _FT_FROZEN_MAP_HPP
+
+#include <functional>
+#include <memory>
+
+#include "algorithm.hpp"
+#include "type_traits.hpp"
+#include "iterator.hpp"
+#include "utility.hpp"
+#include "map.hpp"
+
+/*************************************************************
+ * frozen_map
+
+ * A read-only copy of a map, for maps that stop changing once they are
+	loaded. It has the lookup and iteration interface of ft::map, but
+	no insert or erase.
+ * The keys are stored in an array in Eytzinger order: the order of a
+	breadth-first walk of a complete binary search tree, whose root is
+	at index 1 and the children of i at 2i and 2i + 1. The values are
+	in a second array, at the same indices.
+ * A lookup walks down that implicit tree: it only reads keys, packed
+	in one array, and its first levels stay in cache. Each step moves
+	to 2i or 2i + 1 from the result of the comparison, without a
+	branch, and the nodes a few levels below are prefetched while the
+	current one is compared.
+ * Iterators follow the in-order successor in the implicit tree, in
+	amortized constant time. They stay valid as long as the frozen_map.
+*************************************************************/
+
+namespace ft
+{
+	namespace eytzinger_detail
+	{
+		inline std::size_t trailing_zeros(std::size_t i)
+		{
+#if defined(__GNUC__) || defined(__clang__)
+			return __builtin_ctzll(static_cast<unsigned long long>(i));
+#else
+			std::size_t n = 0;
+
+			for (; !(i & 1); i >>= 1)
+				++n;
+			return n;
+#endif
+		}
+
+		// First node of the in-order walk of the subtree at i
+		inline std::size_t leftmost(std::size_t i, std::size_t n)
+		{
+			while (2 * i <= n)
+				i = 2 * i;
+			return i;
+		}
+
+		// Last node of the in-order walk of the subtree at i
+		inline std::size_t rightmost(std::size_t i, std::size_t n)
+		{
+			while (2 * i + 1 <= n)
+				i = 2 * i + 1;
+			return i;
+		}
+
+		// In-order successor of i, 0 after the last node: up to the first
+		// ancestor reached from its left child
+		inline std::size_t next(std::size_t i, std::size_t n)
+		{
+			if (2 * i + 1 <= n)
+				return leftmost(2 * i + 1, n);
+			return i >> (trailing_zeros(~i) + 1);
+		}
+
+		// In-order predecessor of i, the last node before 0
+		inline std::size_t prev(std::size_t i, std::size_t n)
+		{
+			if (i == 0)
+				return rightmost(1, n);
+			if (2 * i <= n)
+				return rightmost(2 * i, n);
+			return i >> (trailing_zeros(i) + 1);
+		}
+
+		// The address is not dereferenced, it may be past the array
+		inline void prefetch(const void *base, std::size_t offset)
+		{
+#if defined(__GNUC__) || defined(__clang__)
+			__builtin_prefetch(reinterpret_cast<const void *>(
+				reinterpret_cast<std::size_t>(base) + offset));
+#else
+			(void)base;
+			(void)offset;
+#endif
+		}
+	}
+
+	template <typename Key, typename T, typename Compare = std::less<Key>,
+			  typename Alloc = std::allocator<ft::pair<const Key, T> > >
+	class frozen_map
+	{
+
+	public:
+		/*************************************************************
+		 * Types
+		 *************************************************************/
+		typedef Key										key_type;
+		typedef T										mapped_type;
+		typedef ft::pair<const key_type, mapped_type>	value_type;
+		typedef Compare									key_compare;
+		typedef Alloc 									allocator_type;
+
+		/*************************************************************
+		 * value_compare
+		 * In C++98, it is required to inherit binary_function<value_type,value_type,bool>
+		 *************************************************************/
+		class value_compare : public std::binary_function<value_type, value_type, bool>
+		{
+			friend class frozen_map;
+
+		protected:
+			Compare comp;
+			// constructed with map's comparison object
+			value_compare(Compare c) : comp(c) {}
+
+		public:
+			typedef bool result_type;
+			typedef value_type first_argument_type;
+			typedef value_type second_argument_type;
+
+			bool operator()(const value_type &x, const value_type &y) const
+			{ return comp(x.first, y.first); }
+		};
+
+		typedef typename __gnu_cxx::__alloc_traits<Alloc>::template rebind<value_type>
+			::other							pair_alloc_type;
+		typedef typename __gnu_cxx::__alloc_traits<Alloc>::template rebind<key_type>
+			::other							key_alloc_type;
+
+		typedef __gnu_cxx::__alloc_traits<pair_alloc_type>	alloc_traits;
+
+		typedef typename alloc_traits::const_pointer	pointer;
+		typedef typename alloc_traits::const_pointer	const_pointer;
+		typedef typename alloc_traits::const_reference	reference;
+		typedef typename alloc_traits::const_reference	const_reference;
+		typedef std::size_t								size_type;
+		typedef std::ptrdiff_t							difference_type;
+
+	private:
+		/*************************************************************
+		 * frozen_map iterator
+
+		 * An index into the arrays, 0 for end(). Values cannot change,
+			so there is only a const iterator.
+		 *************************************************************/
+		struct frozen_map_iterator
+		{
+			typedef std::ptrdiff_t					difference_type;
+			typedef typename frozen_map::value_type	value_type;
+			typedef const value_type				*pointer;
+			typedef const value_type				&reference;
+			typedef std::bidirectional_iterator_tag	iterator_category;
+
+			typedef frozen_map_iterator	self;
+
+			frozen_map_iterator() : _values(0), _i(0), _n(0) {}
+
+			frozen_map_iterator(const value_type *values, size_type i, size_type n)
+				: _values(values), _i(i), _n(n) {}
+
+			reference operator*() const { return _values[_i]; }
+
+			pointer operator->() const { return _values + _i; }
+
+			self &operator++()
+			{
+				_i = eytzinger_detail::next(_i, _n);
+				return *this;
+			}
+
+			self operator++(int)
+			{
+				self tmp = *this;
+				++*this;
+				return tmp;
+			}
+
+			self &operator--()
+			{
+				_i = eytzinger_detail::prev(_i, _n);
+				return *this;
+			}
+
+			self operator--(int)
+			{
+				self tmp = *this;
+				--*this;
+				return tmp;
+			}
+
+			friend bool operator==(const self &x, const self &y)
+			{ return x._i == y._i; }
+
+			friend bool operator!=(const self &x, const self &y)
+			{ return x._i != y._i; }
+
+			const value_type	*_values;
+			size_type			_i;
+			size_type			_n;
+		}; // frozen_map_iterator
+
+	public:
+		typedef frozen_map_iterator						iterator;
+		typedef frozen_map_iterator						const_iterator;
+		typedef ft::reverse_iterator<iterator>			reverse_iterator;
+		typedef ft::reverse_iterator<const_iterator>	const_reverse_iterator;
+
+		/*************************************************************
+		 * Construct/Copy/Destroy
+		 *************************************************************/
+		// Default constructor creates no elements
+		frozen_map() : _comp(), _alloc(), _key_alloc(), _keys(0), _values(0), _size(0) {}
+
+		explicit frozen_map(const key_compare &comp,
+							const allocator_type &alloc = allocator_type())
+			: _comp(comp), _alloc(alloc), _key_alloc(alloc), _keys(0), _values(0),
+			  _size(0) {}
+
+		// Freezes the content of m
+		template <typename MapAlloc>
+		explicit frozen_map(const ft::map<Key, T, Compare, MapAlloc> &m,
+							const allocator_type &alloc = allocator_type())
+			: _comp(m.key_comp()), _alloc(alloc), _key_alloc(alloc), _keys(0),
+			  _values(0), _size(0)
+		{ build(m.begin(), m.size()); }
+
+		frozen_map(const frozen_map &x)
+			: _comp(x._comp), _alloc(x._alloc), _key_alloc(x._key_alloc), _keys(0),
+			  _values(0), _size(0)
+		{ build(x.begin(), x.size()); }
+
+		// Builds a map from a range, through an ft::map: the first of
+		// several equivalent keys is kept.
+		template <typename InputIterator>
+		frozen_map(InputIterator first, InputIterator last,
+				   const Compare &comp = Compare(),
+				   const allocator_type &alloc = allocator_type())
+			: _comp(comp), _alloc(alloc), _key_alloc(alloc), _keys(0), _values(0),
+			  _size(0)
+		{
+			const ft::map<Key, T, Compare, Alloc> m(first, last, comp, alloc);
+
+			build(m.begin(), m.size());
+		}
+
+		// Builds a map from a range already sorted by key, without
+		// duplicates, for the same interface as ft::map. The range is
+		// walked twice: once to count it, and once to copy it.
+		template <typename ForwardIterator>
+		frozen_map(ft::sorted_unique_t, ForwardIterator first, ForwardIterator last,
+				   const Compare &comp = Compare(),
+				   const allocator_type &alloc = allocator_type())
+			: _comp(comp), _alloc(alloc), _key_alloc(alloc), _keys(0), _values(0),
+			  _size(0)
+		{ build(first, ft::distance(first, last)); }
+
+		~frozen_map() { clear(); }
+
+		/*************************************************************
+		 *  Assignment operator
+		 *************************************************************/
+		frozen_map &operator=(const frozen_map &x)
+		{
+			if (this != &x)
+			{
+				frozen_map tmp(x);
+
+				swap(tmp);
+			}
+			return *this;
+		}
+
+		/*************************************************************
+		 *  Get a copy of the memory allocation object
+		 *************************************************************/
+		allocator_type get_allocator() const { return allocator_type(_alloc); }
+
+		/*************************************************************
+		 * Iterators
+		 *************************************************************/
+		// Iteration is done in ascending order according to the keys.
+		const_iterator begin() const
+		{
+			return const_iterator(_values,
+				_size == 0 ? 0 : eytzinger_detail::leftmost(1, _size), _size);
+		}
+
+		const_iterator end() const { return const_iterator(_values, 0, _size); }
+
+		const_reverse_iterator rbegin() const { return const_reverse_iterator(end()); }
+
+		const_reverse_iterator rend() const { return const_reverse_iterator(begin()); }
+
+		/*************************************************************
+		 * Capacity
+		 *************************************************************/
+		bool empty() const { return _size == 0; }
+
+		size_type size() const { return _size; }
+
+		size_type max_size() const { return alloc_traits::max_size(_alloc); }
+
+		/*************************************************************
+		 * Element access
+		 *************************************************************/
+		// std::out_of_range  If no such data is present.
+		const mapped_type &at(const key_type &k) const
+		{
+			const size_type i = find_index(k);
+
+			if (i == 0)
+				std::__throw_out_of_range(__N("frozen_map::at"));
+			return _values[i].second;
+		}
+
+		void swap(frozen_map &x)
+		{
+			ft::swap(_comp, x._comp);
+			ft::swap(_alloc, x._alloc);
+			ft::swap(_key_alloc, x._key_alloc);
+			ft::swap(_keys, x._keys);
+			ft::swap(_values, x._values);
+			ft::swap(_size, x._size);
+		}
+
+		/*************************************************************
+		 * Observers
+		 *************************************************************/
+		key_compare key_comp() const { return _comp; }
+
+		value_compare value_comp() const { return value_compare(_comp); }
+
+		/*************************************************************
+		 * Map operations
+		 *************************************************************/
+		const_iterator find(const key_type &k) const
+		{ return const_iterator(_values, find_index(k), _size); }
+
+		size_type count(const key_type &k) const { return find_index(k) != 0; }
+
+		// First element whose key is not less than k
+		const_iterator lower_bound(const key_type &k) const
+		{ return const_iterator(_values, lower_bound_index(k), _size); }
+
+		// First element whose key is greater than k
+		const_iterator upper_bound(const key_type &k) const
+		{ return const_iterator(_values, upper_bound_index(k), _size); }
+
+		ft::pair<const_iterator, const_iterator> equal_range(const key_type &k) const
+		{
+			const size_type i = lower_bound_index(k);
+
+			if (i != 0 && !_comp(k, _keys[i]))
+				return ft::make_pair(const_iterator(_values, i, _size),
+									 ++const_iterator(_values, i, _size));
+			return ft::make_pair(const_iterator(_values, i, _size),
+								 const_iterator(_values, i, _size));
+		}
+
+	private:
+		/*************************************************************
+		 * Search
+
+		 * The walk goes right while the key is less than k, and ends
+			below a leaf. The last node it left to the left is the lower
+			bound: the ones it took from i are the trailing ones of i, and
+			are shifted out with the zero before them.
+		 *************************************************************/
+		size_type lower_bound_index(const key_type &k) const
+		{
+			size_type i = 1;
+
+			while (i <= _size)
+			{
+				eytzinger_detail::prefetch(_keys, i * prefetch_stride() * sizeof(Key));
+				i = 2 * i + static_cast<size_type>(_comp(_keys[i], k));
+			}
+			return i >> (eytzinger_detail::trailing_zeros(~i) + 1);
+		}
+
+		size_type upper_bound_index(const key_type &k) const
+		{
+			size_type i = 1;
+
+			while (i <= _size)
+			{
+				eytzinger_detail::prefetch(_keys, i * prefetch_stride() * sizeof(Key));
+				i = 2 * i + static_cast<size_type>(!_comp(k, _keys[i]));
+			}
+			return i >> (eytzinger_detail::trailing_zeros(~i) + 1);
+		}
+
+		// 0 if k is not in the map
+		size_type find_index(const key_type &k) const
+		{
+			const size_type i = lower_bound_index(k);
+
+			return i != 0 && !_comp(k, _keys[i]) ? i : 0;
+		}
+
+		// The descendants of i, d levels down, are the 2^d keys from
+		// i * 2^d on: as many of them as fit in a cache line are
+		// prefetched.
+		static size_type prefetch_stride()
+		{
+			size_type stride = 1;
+
+			while (stride * 2 * sizeof(Key) <= 64)
+				stride *= 2;
+			return stride;
+		}
+
+		/*************************************************************
+		 * Build
+
+		 * The n sorted values from first are copied in the order of an
+			in-order walk of the implicit tree. Both arrays start at
+			index 1, so that the children of i are 2i and 2i + 1.
+		 *************************************************************/
+		template <typename ForwardIterator>
+		void build(ForwardIterator first, size_type n)
+		{
+			if (n == 0)
+				return;
+
+			_values = _alloc.allocate(n + 1);
+			try
+			{
+				_keys = _key_alloc.allocate(n + 1);
+			}
+			catch (...)
+			{
+				_alloc.deallocate(_values, n + 1);
+				_values = 0;
+				throw;
+			}
+
+			size_type built = 0;
+
+			try
+			{
+				for (size_type i = eytzinger_detail::leftmost(1, n); i != 0;
+					 i = eytzinger_detail::next(i, n), ++first)
+				{
+					_alloc.construct(_values + i, *first);
+					try
+					{
+						_key_alloc.construct(_keys + i, _values[i].first);
+					}
+					catch (...)
+					{
+						_alloc.destroy(_values + i);
+						throw;
+					}
+					++built;
+				}
+			}
+			catch (...)
+			{
+				destroy_first(built, n);
+				deallocate(n);
+				throw;
+			}
+			_size = n;
+		}
+
+		// Destroys the first count values, in order, of arrays of n
+		void destroy_first(size_type count, size_type n)
+		{
+			for (size_type i = eytzinger_detail::leftmost(1, n); count > 0;
+				 i = eytzinger_detail::next(i, n), --count)
+			{
+				_key_alloc.destroy(_keys + i);
+				_alloc.destroy(_values + i);
+			}
+		}
+
+		void deallocate(size_type n)
+		{
+			_key_alloc.deallocate(_keys, n + 1);
+			_alloc.deallocate(_values, n + 1);
+			_keys = 0;
+			_values = 0;
+		}
+
+		void clear()
+		{
+			if (_size == 0)
+				return;
+			for (size_type i = 1; i <= _size; ++i)
+			{
+				_key_alloc.destroy(_keys + i);
+				_alloc.destroy(_values + i);
+			}
+			deallocate(_size);
+			_size = 0;
+		}
+
+		key_compare		_comp;
+		pair_alloc_type	_alloc;
+		key_alloc_type	_key_alloc;
+		key_type		*_keys;		// _size + 1 keys, from index 1
+		value_type		*_values;	// Their values, at the same indices
+		size_type		_size;
+
+	}; // frozen_map
+
+	template <typename Key, typename T, typename Compare, typename Alloc>
+	void swap(frozen_map<Key, T, Compare, Alloc> &x,
+			  frozen_map<Key, T, Compare, Alloc> &y)
+	{ x.swap(y); }
+
+} // namespace ft
+
+#endif /* _FT_FROZEN_MAP_HPP */
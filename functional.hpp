@@ -0,0 +1,124 @@
+#ifndef _FT_FUNCTIONAL_HPP
+# define _FT_FUNCTIONAL_HPP
+
+# include <cstddef>
+# include <functional>
+# include <string>
+
+/*************************************************************
+ * A partial functional library implementation that includes:
+	1. hash
+	2. less
+*************************************************************/
+
+namespace ft {
+
+	/*************************************************************
+	 * hash
+
+	 * Function object turning a key into a std::size_t, used by the
+		unordered containers. C++98 has none, so it is provided for
+		integral, floating point and pointer types and for std::string.
+		Other key types need their own specialization.
+	 * The unordered containers mix the bits of the result themselves,
+		so an integer is simply its own hash.
+	*************************************************************/
+	template <class T>
+	struct hash;
+
+	template <class T>
+	struct integral_hash
+	{
+		typedef T			argument_type;
+		typedef std::size_t	result_type;
+
+		std::size_t operator()(T x) const { return static_cast<std::size_t>(x); }
+	};
+
+	template <> struct hash<bool>				: public ft::integral_hash<bool> {};
+	template <> struct hash<signed char>		: public ft::integral_hash<signed char> {};
+	template <> struct hash<unsigned char>		: public ft::integral_hash<unsigned char> {};
+	template <> struct hash<char>				: public ft::integral_hash<char> {};
+	template <> struct hash<wchar_t>			: public ft::integral_hash<wchar_t> {};
+	template <> struct hash<short>				: public ft::integral_hash<short> {};
+	template <> struct hash<unsigned short>		: public ft::integral_hash<unsigned short> {};
+	template <> struct hash<int>				: public ft::integral_hash<int> {};
+	template <> struct hash<unsigned int>		: public ft::integral_hash<unsigned int> {};
+	template <> struct hash<long>				: public ft::integral_hash<long> {};
+	template <> struct hash<unsigned long>		: public ft::integral_hash<unsigned long> {};
+	template <> struct hash<long long>			: public ft::integral_hash<long long> {};
+	template <> struct hash<unsigned long long>	: public ft::integral_hash<unsigned long long> {};
+
+	// Hashes the bytes of an object, with FNV-1a
+	inline std::size_t hash_bytes(const void *p, std::size_t n)
+	{
+		const unsigned char	*bytes = static_cast<const unsigned char *>(p);
+		std::size_t			h = static_cast<std::size_t>(2166136261UL);
+
+		for (std::size_t i = 0; i < n; ++i)
+		{
+			h ^= bytes[i];
+			h *= static_cast<std::size_t>(16777619UL);
+		}
+		return h;
+	}
+
+	// 0.0 and -0.0 compare equal, so they must hash the same
+	template <class T>
+	struct floating_point_hash
+	{
+		typedef T			argument_type;
+		typedef std::size_t	result_type;
+
+		std::size_t operator()(T x) const
+		{ return x == T(0) ? 0 : ft::hash_bytes(&x, sizeof(x)); }
+	};
+
+	template <> struct hash<float>	: public ft::floating_point_hash<float> {};
+	template <> struct hash<double>	: public ft::floating_point_hash<double> {};
+
+	template <class T>
+	struct hash<T*>
+	{
+		typedef T*			argument_type;
+		typedef std::size_t	result_type;
+
+		std::size_t operator()(T *p) const { return reinterpret_cast<std::size_t>(p); }
+	};
+
+	template <>
+	struct hash<std::string>
+	{
+		typedef std::string	argument_type;
+		typedef std::size_t	result_type;
+
+		std::size_t operator()(const std::string &s) const
+		{ return ft::hash_bytes(s.data(), s.size()); }
+	};
+
+	/*************************************************************
+	 * less
+
+	 * Same as std::less. less<> (less<void>) is transparent, as in
+		C++14: it compares two objects of any types with operator<,
+		so that a map<std::string, T, ft::less<> > can find a const char *
+		without building a std::string.
+	*************************************************************/
+	template <class T = void>
+	struct less : public std::binary_function<T, T, bool>
+	{
+		bool operator()(const T &x, const T &y) const { return x < y; }
+	};
+
+	template <>
+	struct less<void>
+	{
+		typedef void	is_transparent;
+
+		template <class T, class U>
+		bool operator()(const T &x, const U &y) const { return x < y; }
+	};
+
+} // namespace ft
+
+#endif /* _FT_FUNCTIONAL_HPP */
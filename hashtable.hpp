@@ -0,0 +1,753 @@
+#ifndef _FT_HASHTABLE_HPP
+#define _FT_HASHTABLE_HPP
+
+#include <memory>
+#include <cstring>
+
+#if defined(__SSE2__)
+# include <emmintrin.h>
+#endif
+
+#include "algorithm.hpp"
+#include "functional.hpp"
+#include "type_traits.hpp"
+#include "utility.hpp"
+
+/*************************************************************
+ * An open addressing hash table, in the style of Swiss tables.
+
+ * Designed for use in implementing the unordered containers
+	(unordered_map and unordered_set).
+
+ * The values are stored inline, in an array of slots. Next to it, an
+	array of control bytes tells for each slot whether it is empty,
+	deleted, or full; a full slot keeps 7 bits of the hash of its key.
+	A lookup reads the control bytes of a group of 16 slots at once,
+	with SSE2 when it is available, and only compares the keys whose
+	7 bits match. It ends at the first group that has an empty slot.
+
+ * Groups are probed quadratically: the capacity is a power of two
+	and at least one group. Erasing leaves a tombstone (deleted) in a
+	group with no empty slot, which later insertions can reuse.
+
+ * The table grows when it would be fuller than max_load_factor()
+	(7/8 by default). Growing moves the values, and invalidates the
+	iterators; erasing does not.
+*************************************************************/
+
+namespace ft
+{
+	/*************************************************************
+	 * Group of control bytes
+
+	 * The match functions return a mask with bit i set when the byte i
+		of the group matches.
+	 *************************************************************/
+	namespace hashtable_detail
+	{
+		enum
+		{
+			group_width = 16
+		};
+
+		// Full slots hold the 7 bits of their hash, from 0 to 127
+		static const signed char	ctrl_empty = -128;
+		static const signed char	ctrl_deleted = -2;
+		static const signed char	ctrl_sentinel = -1; // Ends iteration
+
+		inline int lowest_bit(unsigned mask)
+		{
+#if defined(__GNUC__) || defined(__clang__)
+			return __builtin_ctz(mask);
+#else
+			int i = 0;
+
+			while (!(mask & 1))
+			{
+				mask >>= 1;
+				++i;
+			}
+			return i;
+#endif
+		}
+
+#if defined(__SSE2__)
+		struct group
+		{
+			explicit group(const signed char *ctrl)
+				: _ctrl(_mm_loadu_si128(reinterpret_cast<const __m128i *>(ctrl))) {}
+
+			unsigned match(signed char h2) const
+			{ return _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(h2), _ctrl)); }
+
+			unsigned match_empty() const { return match(ctrl_empty); }
+
+			// Empty and deleted are the only values below the sentinel
+			unsigned match_empty_or_deleted() const
+			{
+				return _mm_movemask_epi8(
+					_mm_cmpgt_epi8(_mm_set1_epi8(ctrl_sentinel), _ctrl));
+			}
+
+		private:
+			__m128i	_ctrl;
+		};
+#else
+		struct group
+		{
+			explicit group(const signed char *ctrl) : _ctrl(ctrl) {}
+
+			unsigned match(signed char h2) const
+			{
+				unsigned mask = 0;
+
+				for (int i = 0; i < group_width; ++i)
+					if (_ctrl[i] == h2)
+						mask |= 1u << i;
+				return mask;
+			}
+
+			unsigned match_empty() const { return match(ctrl_empty); }
+
+			unsigned match_empty_or_deleted() const
+			{
+				unsigned mask = 0;
+
+				for (int i = 0; i < group_width; ++i)
+					if (_ctrl[i] < ctrl_sentinel)
+						mask |= 1u << i;
+				return mask;
+			}
+
+		private:
+			const signed char	*_ctrl;
+		};
+#endif
+
+		// Spreads the bits of a hash, which may be a plain integer, over
+		// the whole word (the finalizer of MurmurHash3)
+		inline std::size_t mix(std::size_t h)
+		{
+			if (sizeof(std::size_t) >= 8)
+			{
+				h ^= h >> (sizeof(std::size_t) * 4 + 1);
+				h *= static_cast<std::size_t>(0xff51afd7ed558ccdULL);
+				h ^= h >> (sizeof(std::size_t) * 4 + 1);
+				h *= static_cast<std::size_t>(0xc4ceb9fe1a85ec53ULL);
+				h ^= h >> (sizeof(std::size_t) * 4 + 1);
+			}
+			else
+			{
+				h ^= h >> 16;
+				h *= static_cast<std::size_t>(0x85ebca6bUL);
+				h ^= h >> 13;
+				h *= static_cast<std::size_t>(0xc2b2ae35UL);
+				h ^= h >> 16;
+			}
+			return h;
+		}
+	} // namespace hashtable_detail
+
+	/*************************************************************
+	 * Hash table class
+	 *************************************************************/
+	template <typename Key, typename Val, typename KeyOfValue,
+			  typename Hash, typename Pred, typename Alloc = std::allocator<Val> >
+	class hashtable
+	{
+
+	public:
+		typedef Key					key_type;
+		typedef Val					value_type;
+		typedef Hash				hasher;
+		typedef Pred				key_equal;
+		typedef value_type			*pointer;
+		typedef const value_type	*const_pointer;
+		typedef value_type			&reference;
+		typedef const value_type	&const_reference;
+		typedef std::size_t			size_type;
+		typedef std::ptrdiff_t		difference_type;
+		typedef Alloc				allocator_type;
+
+	private:
+		/*************************************************************
+		 * Hash table iterator
+
+		 * A control byte and its slot. The sentinel byte after the last
+			slot stops the iteration at end().
+		 *************************************************************/
+		template <typename Ref, typename Ptr>
+		struct hashtable_iterator
+		{
+			/*************************************************************
+			 * Types
+			 *************************************************************/
+			typedef std::ptrdiff_t				difference_type;
+			typedef Val							value_type;
+			typedef Ptr							pointer;
+			typedef Ref							reference;
+			typedef std::forward_iterator_tag	iterator_category;
+
+			typedef hashtable_iterator<Val &, Val *>	iterator;
+			typedef hashtable_iterator<Ref, Ptr>		self;
+
+			/*************************************************************
+			 * Construct/Copy/Destroy
+			 *************************************************************/
+			hashtable_iterator() : _ctrl(0), _slot(0) {}
+
+			hashtable_iterator(signed char *ctrl, Val *slot)
+				: _ctrl(ctrl), _slot(slot) {}
+
+			hashtable_iterator(const iterator &it)
+				: _ctrl(it._ctrl), _slot(it._slot) {}
+
+			/*************************************************************
+			 * Operators
+			 *************************************************************/
+			reference operator*() const { return *_slot; }
+
+			pointer operator->() const { return _slot; }
+
+			self &operator++()
+			{
+				++_ctrl;
+				++_slot;
+				skip_free_slots();
+				return *this;
+			}
+
+			self operator++(int)
+			{
+				self tmp = *this;
+				++*this;
+				return tmp;
+			}
+
+			friend bool operator==(const self &x, const self &y)
+			{ return x._ctrl == y._ctrl; }
+
+			friend bool operator!=(const self &x, const self &y)
+			{ return x._ctrl != y._ctrl; }
+
+			void skip_free_slots()
+			{
+				while (*_ctrl < hashtable_detail::ctrl_sentinel)
+				{
+					++_ctrl;
+					++_slot;
+				}
+			}
+
+			signed char	*_ctrl;
+			Val			*_slot;
+		}; // hashtable_iterator
+
+	public:
+		typedef hashtable_iterator<Val &, Val *>				iterator;
+		typedef hashtable_iterator<const Val &, const Val *>	const_iterator;
+
+	private:
+		typedef typename Alloc::template rebind<signed char>::other	ctrl_allocator;
+
+		// Values are moved to a new table with memcpy when they can be
+		typedef ft::integral_constant<bool,
+			ft::is_trivially_relocatable<Val>::value
+			&& ft::is_same<Alloc, std::allocator<Val> >::value>	trivial_relocate;
+
+		enum
+		{
+			group_width = hashtable_detail::group_width
+		};
+
+		Hash			_hash;
+		Pred			_eq;
+		allocator_type	_alloc;
+		ctrl_allocator	_ctrl_alloc;
+		signed char		*_ctrl;		// capacity + 1 bytes, the last one a sentinel
+		Val				*_slots;
+		size_type		_capacity;	// 0, or a power of two multiple of group_width
+		size_type		_size;
+		size_type		_growth_left; // Empty slots that can still be filled
+		float			_max_load_factor;
+
+	public:
+		/*************************************************************
+		 * Construct/Copy/Destroy
+		 *************************************************************/
+		explicit hashtable(size_type n = 0, const Hash &hf = Hash(),
+						   const Pred &eq = Pred(),
+						   const allocator_type &a = allocator_type())
+			: _hash(hf), _eq(eq), _alloc(a), _ctrl_alloc(a), _ctrl(0), _slots(0),
+			  _capacity(0), _size(0), _growth_left(0), _max_load_factor(0.875f)
+		{
+			if (n > 0)
+				resize(capacity_for(n));
+		}
+
+		hashtable(const hashtable &x)
+			: _hash(x._hash), _eq(x._eq), _alloc(x._alloc), _ctrl_alloc(x._ctrl_alloc),
+			  _ctrl(0), _slots(0), _capacity(0), _size(0), _growth_left(0),
+			  _max_load_factor(x._max_load_factor)
+		{ copy(x); }
+
+		~hashtable()
+		{
+			destroy_values();
+			deallocate(_ctrl, _slots, _capacity);
+		}
+
+		hashtable &operator=(const hashtable &x)
+		{
+			if (this != &x)
+			{
+				hashtable tmp(x);
+
+				swap(tmp);
+			}
+			return *this;
+		}
+
+		// Accessors.
+		hasher hash_function() const { return _hash; }
+
+		key_equal key_eq() const { return _eq; }
+
+		allocator_type get_allocator() const { return _alloc; }
+
+		iterator begin()
+		{
+			if (_capacity == 0)
+				return end();
+
+			iterator it(_ctrl, _slots);
+
+			it.skip_free_slots();
+			return it;
+		}
+
+		const_iterator begin() const
+		{ return const_cast<hashtable *>(this)->begin(); }
+
+		iterator end() { return iterator(_ctrl + _capacity, _slots + _capacity); }
+
+		const_iterator end() const
+		{ return const_cast<hashtable *>(this)->end(); }
+
+		bool empty() const { return _size == 0; }
+
+		size_type size() const { return _size; }
+
+		size_type max_size() const { return _alloc.max_size(); }
+
+		void swap(hashtable &x)
+		{
+			ft::swap(_hash, x._hash);
+			ft::swap(_eq, x._eq);
+			ft::swap(_alloc, x._alloc);
+			ft::swap(_ctrl_alloc, x._ctrl_alloc);
+			ft::swap(_ctrl, x._ctrl);
+			ft::swap(_slots, x._slots);
+			ft::swap(_capacity, x._capacity);
+			ft::swap(_size, x._size);
+			ft::swap(_growth_left, x._growth_left);
+			ft::swap(_max_load_factor, x._max_load_factor);
+		}
+
+		// Insert.
+		pair<iterator, bool> insert_unique(const value_type &v);
+
+		template <typename _InputIterator>
+		void insert_range_unique(_InputIterator first, _InputIterator last)
+		{
+			for (; first != last; ++first)
+				insert_unique(*first);
+		}
+
+		// Erase.
+		void erase(const_iterator position)
+		{ erase_at(position._slot - _slots); }
+
+		size_type erase(const key_type &k)
+		{
+			const size_type i = find_index(k, hash_of(k));
+
+			if (i == _capacity)
+				return 0;
+			erase_at(i);
+			return 1;
+		}
+
+		void erase(const_iterator first, const_iterator last)
+		{
+			while (first != last)
+				erase(first++);
+		}
+
+		// Keeps the capacity
+		void clear()
+		{
+			if (_capacity == 0)
+				return;
+			destroy_values();
+			std::memset(_ctrl, hashtable_detail::ctrl_empty, _capacity);
+			_size = 0;
+			_growth_left = max_elements(_capacity);
+		}
+
+		// Lookup.
+		iterator find(const key_type &k)
+		{ return iterator_at(find_index(k, hash_of(k))); }
+
+		const_iterator find(const key_type &k) const
+		{ return const_cast<hashtable *>(this)->find(k); }
+
+		size_type count(const key_type &k) const
+		{ return find_index(k, hash_of(k)) == _capacity ? 0 : 1; }
+
+		pair<iterator, iterator> equal_range(const key_type &k)
+		{
+			iterator first = find(k);
+			iterator last = first;
+
+			if (first != end())
+				++last;
+			return pair<iterator, iterator>(first, last);
+		}
+
+		pair<const_iterator, const_iterator>
+		equal_range(const key_type &k) const
+		{
+			pair<iterator, iterator> p
+				= const_cast<hashtable *>(this)->equal_range(k);
+
+			return pair<const_iterator, const_iterator>(p.first, p.second);
+		}
+
+		// Hash policy.
+		size_type bucket_count() const { return _capacity; }
+
+		float load_factor() const
+		{ return _capacity ? float(_size) / float(_capacity) : 0.0f; }
+
+		float max_load_factor() const { return _max_load_factor; }
+
+		// A higher maximum load factor saves memory, a lower one makes the
+		// probe sequences shorter. There is always at least one empty slot.
+		void max_load_factor(float z)
+		{
+			const size_type used = max_elements(_capacity) - _growth_left;
+
+			_max_load_factor = z > 0.0f ? z : _max_load_factor;
+			_growth_left = max_elements(_capacity) > used
+				? max_elements(_capacity) - used : 0;
+			if (_size > max_elements(_capacity))
+				resize(capacity_for(_size));
+		}
+
+		// Sets the capacity to at least n slots, and enough for size()
+		void rehash(size_type n)
+		{
+			size_type cap = capacity_for(_size);
+
+			while (cap < n)
+				cap *= 2;
+			if (cap != _capacity)
+				resize(cap);
+		}
+
+		// Makes room for n elements without growing again
+		void reserve(size_type n)
+		{
+			if (n > max_elements(_capacity))
+				resize(capacity_for(n));
+		}
+
+		friend bool operator==(const hashtable &x, const hashtable &y)
+		{
+			if (x.size() != y.size())
+				return false;
+			for (const_iterator it = x.begin(); it != x.end(); ++it)
+			{
+				const_iterator j = y.find(KeyOfValue()(*it));
+
+				if (j == y.end() || !(*j == *it))
+					return false;
+			}
+			return true;
+		}
+
+	private:
+		/*************************************************************
+		 * Hashing and probing
+		 *************************************************************/
+		std::size_t hash_of(const key_type &k) const
+		{ return hashtable_detail::mix(_hash(k)); }
+
+		// The low 7 bits go to the control byte, the others pick the group
+		static signed char h2(std::size_t h)
+		{ return static_cast<signed char>(h & 0x7f); }
+
+		size_type first_group(std::size_t h) const
+		{ return (h >> 7) & (_capacity / group_width - 1); }
+
+		size_type next_group(size_type g, size_type step) const
+		{ return (g + step) & (_capacity / group_width - 1); }
+
+		const Key &key(size_type i) const { return KeyOfValue()(_slots[i]); }
+
+		iterator iterator_at(size_type i) { return iterator(_ctrl + i, _slots + i); }
+
+		// Index of the slot holding k, or capacity if there is none
+		size_type find_index(const key_type &k, std::size_t h) const
+		{
+			if (_capacity == 0)
+				return 0;
+
+			const size_type groups = _capacity / group_width;
+			size_type g = first_group(h);
+
+			for (size_type step = 1; step <= groups; ++step)
+			{
+				const hashtable_detail::group grp(_ctrl + g * group_width);
+
+				for (unsigned m = grp.match(h2(h)); m != 0; m &= m - 1)
+				{
+					const size_type i = g * group_width
+						+ hashtable_detail::lowest_bit(m);
+
+					if (_eq(k, key(i)))
+						return i;
+				}
+				if (grp.match_empty())
+					break;
+				g = next_group(g, step);
+			}
+			return _capacity;
+		}
+
+		// First empty or deleted slot on the probe sequence of h. There is
+		// always one, as the table is never completely full.
+		size_type find_free_slot(std::size_t h) const
+		{
+			size_type g = first_group(h);
+
+			for (size_type step = 1;; ++step)
+			{
+				const unsigned m = hashtable_detail::group(_ctrl + g * group_width)
+					.match_empty_or_deleted();
+
+				if (m != 0)
+					return g * group_width + hashtable_detail::lowest_bit(m);
+				g = next_group(g, step);
+			}
+		}
+
+		/*************************************************************
+		 * Capacity
+		 *************************************************************/
+		// Elements a table of capacity cap can hold
+		size_type max_elements(size_type cap) const
+		{
+			if (cap == 0)
+				return 0;
+
+			const size_type n = static_cast<size_type>(float(cap) * _max_load_factor);
+
+			return n < cap ? n : cap - 1;
+		}
+
+		size_type capacity_for(size_type n) const
+		{
+			size_type cap = group_width;
+
+			while (max_elements(cap) < n)
+				cap *= 2;
+			return cap;
+		}
+
+		// Moves the values to new arrays of capacity cap, which drops
+		// the tombstones. If a value cannot be copied, nothing changes.
+		void resize(size_type cap);
+
+		void copy(const hashtable &x);
+
+		void destroy_values()
+		{
+			for (size_type i = 0; i < _capacity; ++i)
+				if (_ctrl[i] >= 0)
+					_alloc.destroy(_slots + i);
+		}
+
+		void allocate(size_type cap, signed char *&ctrl, Val *&slots)
+		{
+			ctrl = _ctrl_alloc.allocate(cap + 1);
+			try
+			{ slots = _alloc.allocate(cap); }
+			catch (...)
+			{ _ctrl_alloc.deallocate(ctrl, cap + 1); throw; }
+			std::memset(ctrl, hashtable_detail::ctrl_empty, cap);
+			ctrl[cap] = hashtable_detail::ctrl_sentinel;
+		}
+
+		void deallocate(signed char *ctrl, Val *slots, size_type cap)
+		{
+			if (cap == 0)
+				return;
+			_ctrl_alloc.deallocate(ctrl, cap + 1);
+			_alloc.deallocate(slots, cap);
+		}
+
+		// A slot becomes empty again when its group has an empty slot:
+		// then no probe sequence ever went past this group.
+		void erase_at(size_type i)
+		{
+			const size_type g = i / group_width * group_width;
+
+			_alloc.destroy(_slots + i);
+			if (hashtable_detail::group(_ctrl + g).match_empty())
+			{
+				_ctrl[i] = hashtable_detail::ctrl_empty;
+				++_growth_left;
+			}
+			else
+				_ctrl[i] = hashtable_detail::ctrl_deleted;
+			--_size;
+		}
+
+	}; // hashtable class
+
+	template <typename _Key, typename _Val, typename _KeyOfValue,
+			  typename _Hash, typename _Pred, typename _Alloc>
+	inline void
+	swap(hashtable<_Key, _Val, _KeyOfValue, _Hash, _Pred, _Alloc> &x,
+		 hashtable<_Key, _Val, _KeyOfValue, _Hash, _Pred, _Alloc> &y)
+	{ x.swap(y); }
+
+	template <typename _Key, typename _Val, typename _KeyOfValue,
+			  typename _Hash, typename _Pred, typename _Alloc>
+	pair<typename hashtable<_Key, _Val, _KeyOfValue, _Hash, _Pred, _Alloc>::iterator,
+		 bool>
+	hashtable<_Key, _Val, _KeyOfValue, _Hash, _Pred, _Alloc>::
+		insert_unique(const _Val &v)
+	{
+		typedef pair<iterator, bool> _Res;
+		const _Key &k = _KeyOfValue()(v);
+		const std::size_t h = hash_of(k);
+		size_type i = find_index(k, h);
+
+		if (i != _capacity)
+			return _Res(iterator_at(i), false);
+		if (_capacity == 0)
+			resize(capacity_for(1));
+		i = find_free_slot(h);
+		if (_growth_left == 0 && _ctrl[i] == hashtable_detail::ctrl_empty)
+		{
+			// Full of values and tombstones: when there are many
+			// tombstones, dropping them is enough to make room.
+			if (_size + 1 > max_elements(_capacity) / 2)
+				resize(_capacity * 2);
+			else
+				resize(_capacity);
+			i = find_free_slot(h);
+		}
+		_alloc.construct(_slots + i, v);
+		if (_ctrl[i] == hashtable_detail::ctrl_empty)
+			--_growth_left;
+		_ctrl[i] = h2(h);
+		++_size;
+		return _Res(iterator_at(i), true);
+	}
+
+	template <typename _Key, typename _Val, typename _KeyOfValue,
+			  typename _Hash, typename _Pred, typename _Alloc>
+	void hashtable<_Key, _Val, _KeyOfValue, _Hash, _Pred, _Alloc>::
+		resize(size_type cap)
+	{
+		signed char	*ctrl;
+		_Val		*slots;
+
+		allocate(cap, ctrl, slots);
+
+		// The values are copied before the old ones are dropped
+		size_type i = 0;
+
+		try
+		{
+			for (; i < _capacity; ++i)
+			{
+				if (_ctrl[i] < 0)
+					continue;
+
+				const std::size_t h = hash_of(key(i));
+				size_type g = (h >> 7) & (cap / group_width - 1);
+				unsigned m;
+
+				for (size_type step = 1;
+					 (m = hashtable_detail::group(ctrl + g * group_width).match_empty()) == 0;
+					 ++step)
+					g = (g + step) & (cap / group_width - 1);
+
+				const size_type j = g * group_width + hashtable_detail::lowest_bit(m);
+
+				if (trivial_relocate::value)
+					std::memcpy(static_cast<void *>(slots + j),
+								static_cast<const void *>(_slots + i), sizeof(_Val));
+				else
+					_alloc.construct(slots + j, _slots[i]);
+				ctrl[j] = h2(h);
+			}
+		}
+		catch (...)
+		{
+			for (size_type j = 0; j < cap; ++j)
+				if (ctrl[j] >= 0)
+					_alloc.destroy(slots + j);
+			deallocate(ctrl, slots, cap);
+			throw;
+		}
+		if (!trivial_relocate::value)
+			destroy_values();
+		deallocate(_ctrl, _slots, _capacity);
+		_ctrl = ctrl;
+		_slots = slots;
+		_capacity = cap;
+		_growth_left = max_elements(cap) - _size;
+	}
+
+	// Same capacity, same hash: every value goes to the same slot
+	template <typename _Key, typename _Val, typename _KeyOfValue,
+			  typename _Hash, typename _Pred, typename _Alloc>
+	void hashtable<_Key, _Val, _KeyOfValue, _Hash, _Pred, _Alloc>::
+		copy(const hashtable &x)
+	{
+		if (x._capacity == 0)
+			return;
+		allocate(x._capacity, _ctrl, _slots);
+		_capacity = x._capacity;
+		try
+		{
+			for (size_type i = 0; i < _capacity; ++i)
+				if (x._ctrl[i] >= 0)
+				{
+					_alloc.construct(_slots + i, x._slots[i]);
+					_ctrl[i] = x._ctrl[i];
+				}
+		}
+		catch (...)
+		{
+			destroy_values();
+			deallocate(_ctrl, _slots, _capacity);
+			_ctrl = 0;
+			_slots = 0;
+			_capacity = 0;
+			throw;
+		}
+		std::memcpy(_ctrl, x._ctrl, _capacity);
+		_size = x._size;
+		_growth_left = x._growth_left;
+	}
+
+} // namespace ft
+
+#endif /* _FT_HASHTABLE_HPP */
@@ -10,6 +10,8 @@
 	1. iterator_traits
 	2. random_access_iterator
 	3. reverse_iterator
+
+ * And of the distance function, dispatched on the iterator category.
 *************************************************************/
 
 namespace ft {
@@ -322,6 +324,41 @@ namespace ft {
 	operator-(const reverse_iterator<Iter1>& l, const reverse_iterator<Iter2>& r)
 	{ return r.base() - l.base(); }
 
+
+	/*************************************************************
+	 * distance
+
+	 * Returns the number of increments needed to get from first
+		to last.
+	 * The iterator category tag picks the implementation: constant
+		time for random access iterators, a single walk through the
+		range for the others.
+	*************************************************************/
+	template <typename InputIterator>
+	typename iterator_traits<InputIterator>::difference_type
+	distance(InputIterator first, InputIterator last, std::input_iterator_tag)
+	{
+		typename iterator_traits<InputIterator>::difference_type	n = 0;
+
+		for (; first != last; ++first)
+			++n;
+		return n;
+	}
+
+	template <typename RandomAccessIterator>
+	typename iterator_traits<RandomAccessIterator>::difference_type
+	distance(RandomAccessIterator first, RandomAccessIterator last,
+		std::random_access_iterator_tag)
+	{ return last - first; }
+
+	template <typename InputIterator>
+	typename iterator_traits<InputIterator>::difference_type
+	distance(InputIterator first, InputIterator last)
+	{
+		return ft::distance(first, last,
+			typename iterator_traits<InputIterator>::iterator_category());
+	}
+
 } // namespace ft
 
 #endif /* _FT_ITERATOR_HPP */
@@ -2,11 +2,11 @@
 #include <sstream>
 #include <string>
 #include <cstring>
-#include <deque>
 
 
 #if 0 //CREATE A REAL STL EXAMPLE
 	#define _NAMESPACE	"STL"
+	#include <deque>
 	#include <map>
 	#include <stack>
 	#include <vector>
@@ -14,6 +14,7 @@
 	namespace ft = std;
 #else
 	#define _NAMESPACE	"FT"
+	#include "deque.hpp"
 	#include "stack.hpp"
 	#include "vector.hpp"
 	#include "map.hpp"
@@ -85,7 +86,7 @@ int main(int argc, char** argv) {
 	ft::vector<int> vector_int;
 	ft::stack<size_t> stack_size_t;
 	ft::vector<Buffer> vector_buffer;
-	ft::stack<Buffer, std::deque<Buffer> > stack_deq_buffer;
+	ft::stack<Buffer, ft::deque<Buffer> > stack_deq_buffer;
 	ft::map<int, int> map_int;
 	
 	std::cout << "count: " << COUNT << std::endl;
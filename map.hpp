@@ -3,12 +3,14 @@
 
 #include <functional>
 #include <memory>
+#include <new>
 
 #include "algorithm.hpp"
 #include "type_traits.hpp"
 #include "iterator.hpp"
 #include "utility.hpp"
 #include "tree.hpp"
+#include "node_handle.hpp"
 
 namespace ft
 {
@@ -72,6 +74,8 @@ namespace ft
 		typedef typename rep_type::difference_type difference_type;
 		typedef typename rep_type::reverse_iterator reverse_iterator;
 		typedef typename rep_type::const_reverse_iterator const_reverse_iterator;
+		typedef ft::map_node_handle<Key, T, typename rep_type::node_allocator> node_type;
+		typedef ft::node_insert_return<iterator, node_type> insert_return_type;
 
 		/*************************************************************
 		 * Construct/Copy/Destroy
@@ -81,14 +85,16 @@ namespace ft
 
 		explicit map(const key_compare &comp,
 					 const allocator_type &alloc = allocator_type())
-			: _t(comp), pair_alloc_type(alloc) {}
+			: _t(comp, pair_alloc_type(alloc)) {}
 
 		map(const map &x) : _t(x._t){};
 
 		// Builds a map from a range
 		// Create a map consisting of copies of the elements from
-		// [first,last).  This is linear in N if the range is
-		// already sorted, and NlogN otherwise (where N is distance(first,last)).
+		// [first,last).  The tree is built in a single pass, linear in N,
+		// as long as the range is sorted, and the elements that follow
+		// the first one out of order are inserted in NlogN
+		// (where N is distance(first,last)).
 		template <typename InputIterator>
 		map(InputIterator first, InputIterator last) : _t()
 		{ _t.insert_range_unique(first, last); }
@@ -99,6 +105,15 @@ namespace ft
 			: _t(comp, pair_alloc_type(alloc))
 		{ _t.insert_range_unique(first, last); }
 
+		// Builds a map from a range already sorted by key, without
+		// duplicates: the keys are not compared at all.
+		template <typename InputIterator>
+		map(ft::sorted_unique_t, InputIterator first, InputIterator last,
+			const Compare &comp = Compare(),
+			const allocator_type &alloc = allocator_type())
+			: _t(comp, pair_alloc_type(alloc))
+		{ _t.insert_range_unique(ft::sorted_unique, first, last); }
+
 		/*************************************************************
 		 *  Assignment operator
 		 *************************************************************/
@@ -153,13 +168,7 @@ namespace ft
 		// subscript.  If the key does not exist, a pair with that key
 		// is created using default values, which is then returned.
 		mapped_type &operator[](const key_type &k)
-		{
-			iterator i = lower_bound(k);
-			// i->first is greater than or equivalent to k.
-			if (i == end() || key_comp()(k, (*i).first))
-				i = insert(const_iterator(i), value_type(k, mapped_type()));
-			return (*i).second;
-		}
+		{ return (*try_emplace(k).first).second; }
 
 		// Access to %map data.
 		// k  The key for which data should be retrieved.
@@ -211,6 +220,56 @@ namespace ft
 		void insert(InputIterator first, InputIterator last)
 		{ return _t.insert_range_unique(first, last); }
 
+		// Inserts a pair made of k and of a mapped_type built from arg
+		// (or value-initialized, without arg), if k is not in the map yet.
+		// Otherwise nothing is built, and the mapped value is unchanged.
+		// The tree is descended once, and the pair is constructed in its
+		// node, so that mapped_type is never copied.
+		// Returns the same pair as insert().
+		ft::pair<iterator, bool> try_emplace(const key_type &k)
+		{ return _t.emplace_unique_key(k, pair_ctor<value_init_t>(k, value_init_t())); }
+
+		template <typename Arg>
+		ft::pair<iterator, bool> try_emplace(const key_type &k, const Arg &arg)
+		{ return _t.emplace_unique_key(k, pair_ctor<Arg>(k, arg)); }
+
+		// Same, with a hint as in insert(position, x)
+		iterator try_emplace(const_iterator position, const key_type &k)
+		{
+			return _t.emplace_hint_unique_key(position, k,
+				pair_ctor<value_init_t>(k, value_init_t())).first;
+		}
+
+		template <typename Arg>
+		iterator try_emplace(const_iterator position, const key_type &k,
+							 const Arg &arg)
+		{ return _t.emplace_hint_unique_key(position, k, pair_ctor<Arg>(k, arg)).first; }
+
+		// Inserts (k, obj), or assigns obj to the mapped value of k if k is
+		// already in the map, in a single descent of the tree.
+		// The bool is true if the pair was inserted.
+		template <typename M>
+		ft::pair<iterator, bool> insert_or_assign(const key_type &k, const M &obj)
+		{
+			ft::pair<iterator, bool> res = try_emplace(k, obj);
+
+			if (!res.second)
+				(*res.first).second = obj;
+			return res;
+		}
+
+		template <typename M>
+		iterator insert_or_assign(const_iterator position, const key_type &k,
+								  const M &obj)
+		{
+			ft::pair<iterator, bool> res
+				= _t.emplace_hint_unique_key(position, k, pair_ctor<M>(k, obj));
+
+			if (!res.second)
+				(*res.first).second = obj;
+			return res.first;
+		}
+
 		// This function erases an element, pointed to by the given
 		// iterator, from a %map.  Note that this function only erases
 		// the element, and that if the element is itself a pointer,
@@ -230,6 +289,58 @@ namespace ft
 		// Erases all elements in a map
 		void clear() { _t.clear(); }
 
+		// Unlinks the pair at position, or with key x, from the map, and
+		// returns a handle that owns its node (empty if x is not found).
+		// The node is neither copied nor deallocated, so that it can be
+		// inserted into another map. Not available with pool_allocator,
+		// whose nodes cannot outlive the map.
+		node_type extract(const_iterator position)
+		{ return node_type(_t.extract_node(position), _t.get_node_allocator()); }
+
+		node_type extract(const key_type &x)
+		{
+			iterator i = find(x);
+
+			if (i == end())
+				return node_type();
+			return extract(const_iterator(i));
+		}
+
+		// Links the node of nh into the map, if its key is not there yet.
+		// Otherwise the node is handed back in the node of the result.
+		insert_return_type insert(node_type nh)
+		{
+			insert_return_type ret;
+
+			ret.position = end();
+			ret.inserted = false;
+			if (nh.empty())
+				return ret;
+
+			ft::pair<iterator, bool> res = _t.reinsert_node_unique(nh._ptr);
+
+			ret.position = res.first;
+			ret.inserted = res.second;
+			if (res.second)
+				nh.release();
+			else
+				ret.node = nh;
+			return ret;
+		}
+
+		// Moves to this map the pairs of source whose key is not in this
+		// map yet, relinking their nodes. The others stay in source.
+		void merge(map &source) { _t.merge_unique(source._t); }
+
+		// Set algebra on the keys: makes this map the union, intersection or
+		// difference of itself and other, in O(m log(n/m + 1)) for sizes
+		// m <= n. The nodes are split and joined, not copied: this map
+		// keeps its own pairs, and other is left empty, its nodes being
+		// moved into this map or destroyed.
+		void union_with(map &other) { _t.union_unique(other._t); }
+		void intersect_with(map &other) { _t.intersect_unique(other._t); }
+		void difference_with(map &other) { _t.difference_unique(other._t); }
+
 		/*************************************************************
 		 * Observers
 		 *************************************************************/
@@ -277,6 +388,110 @@ namespace ft
 		pair<const_iterator, const_iterator> equal_range(const key_type &x) const
 		{ return _t.equal_range(x); }
 
+		// Transparent lookups, only when Compare declares is_transparent
+		// (as ft::less<> does): x may be of any type that Compare can
+		// compare to the keys, and is not converted to key_type.
+		template <typename K>
+		typename ft::enable_if<ft::has_is_transparent<Compare, K>::value,
+							   iterator>::type
+		find(const K &x) { return _t.find(x); }
+
+		template <typename K>
+		typename ft::enable_if<ft::has_is_transparent<Compare, K>::value,
+							   const_iterator>::type
+		find(const K &x) const { return _t.find(x); }
+
+		template <typename K>
+		typename ft::enable_if<ft::has_is_transparent<Compare, K>::value,
+							   size_type>::type
+		count(const K &x) const { return _t.count(x); }
+
+		template <typename K>
+		typename ft::enable_if<ft::has_is_transparent<Compare, K>::value,
+							   iterator>::type
+		lower_bound(const K &x) { return _t.lower_bound(x); }
+
+		template <typename K>
+		typename ft::enable_if<ft::has_is_transparent<Compare, K>::value,
+							   const_iterator>::type
+		lower_bound(const K &x) const { return _t.lower_bound(x); }
+
+		template <typename K>
+		typename ft::enable_if<ft::has_is_transparent<Compare, K>::value,
+							   iterator>::type
+		upper_bound(const K &x) { return _t.upper_bound(x); }
+
+		template <typename K>
+		typename ft::enable_if<ft::has_is_transparent<Compare, K>::value,
+							   const_iterator>::type
+		upper_bound(const K &x) const { return _t.upper_bound(x); }
+
+		template <typename K>
+		typename ft::enable_if<ft::has_is_transparent<Compare, K>::value,
+							   pair<iterator, iterator> >::type
+		equal_range(const K &x) { return _t.equal_range(x); }
+
+		template <typename K>
+		typename ft::enable_if<ft::has_is_transparent<Compare, K>::value,
+							   pair<const_iterator, const_iterator> >::type
+		equal_range(const K &x) const { return _t.equal_range(x); }
+
+#ifdef FT_RB_TREE_ORDER_STATISTICS
+		/*************************************************************
+		 * Order statistics
+
+		 * Only with FT_RB_TREE_ORDER_STATISTICS, in logarithmic time.
+		 *************************************************************/
+		// Return an iterator to the pair with the k-th smallest key,
+		// counting from 0, or end() if the map has no more than k pairs.
+		iterator select(size_type k) { return _t.select(k); }
+		const_iterator select(size_type k) const { return _t.select(k); }
+
+		// Return the number of pairs whose key is less than x.
+		size_type rank(const key_type &x) const { return _t.rank(x); }
+
+		// Return the number of pairs between first and last.
+		difference_type distance(const_iterator first, const_iterator last) const
+		{ return _t.distance(first, last); }
+#endif
+
+	private:
+		/*************************************************************
+		 * In place construction of the pairs of try_emplace()
+
+		 * The members of the pair are constructed one by one in the node,
+			as C++98 has no piecewise constructor for pair.
+		 *************************************************************/
+		struct value_init_t {};
+
+		static void construct_mapped(mapped_type *p, value_init_t)
+		{ ::new (static_cast<void *>(p)) mapped_type(); }
+
+		template <typename Arg>
+		static void construct_mapped(mapped_type *p, const Arg &arg)
+		{ ::new (static_cast<void *>(p)) mapped_type(arg); }
+
+		template <typename Arg>
+		struct pair_ctor
+		{
+			pair_ctor(const key_type &k, const Arg &arg) : _k(k), _arg(arg) {}
+
+			void operator()(value_type *p) const
+			{
+				key_type *first = const_cast<key_type *>(&p->first);
+
+				::new (static_cast<void *>(first)) key_type(_k);
+				try
+				{ construct_mapped(&p->second, _arg); }
+				catch (...)
+				{ first->~key_type(); throw; }
+			}
+
+			const key_type	&_k;
+			const Arg		&_arg;
+		};
+
+	public:
 		/*************************************************************
 		 *  Relational operators
 		 *************************************************************/
@@ -0,0 +1,408 @@
+#ifndef _FT_MPMC_QUEUE_HPP
+#define _FT_MPMC_QUEUE_HPP
+
+#include <climits>
+#include <cstddef>
+#include <memory>
+#include <sched.h>
+#if defined(__linux__)
+# include <linux/futex.h>
+# include <sys/syscall.h>
+# include <unistd.h>
+#endif
+
+#include "atomic.hpp"
+#include "vector.hpp"
+
+/*************************************************************
+ * mpmc_queue
+
+ * A bounded queue that any number of threads push to and pop from
+	at once, without any lock: an array of cells whose capacity is
+	rounded up to a power of two, and to at least 2, as described by
+	Dmitry Vyukov.
+ * Each cell holds a sequence number, which tells which turn of the
+	ring it is ready for. A producer claims the cell at the push
+	position once the cell is ready to be filled, by moving the
+	position on with a compare-and-swap, fills it, and publishes it by
+	moving its sequence number on with a release store. Consumers do
+	the same at the pop position, for filled cells. Threads only
+	contend on the position they move, and on the cells they claim.
+ * try_push() and try_pop() fail at once when the queue is full or
+	empty. push() and pop() wait: they retry a while, then sleep on a
+	futex, until a thread of the other kind wakes them. Threads that
+	never wait cost the others nothing but a fence and a load.
+ * try_push_n(), try_pop_n() and drain() claim a run of cells with a
+	single compare-and-swap. drain() appends to an ft::vector, which
+	it grows once beforehand.
+ * Copying or assigning a T must not throw: a claimed cell cannot be
+	given back. C++98 has no threads: the atomics come from atomic.hpp.
+	The futex is Linux's: elsewhere, waiting threads yield their
+	processor instead of sleeping.
+*************************************************************/
+
+namespace ft
+{
+	namespace mpmc_detail
+	{
+		// Sleeps while *addr holds val, until futex_wake() on addr.
+		// May return early.
+		inline void futex_wait(unsigned int *addr, unsigned int val)
+		{
+#if defined(__linux__)
+			syscall(SYS_futex, addr, FUTEX_WAIT_PRIVATE, val, 0, 0, 0);
+#else
+			(void)addr;
+			(void)val;
+			sched_yield();
+#endif
+		}
+
+		inline void futex_wake(unsigned int *addr, int n)
+		{
+#if defined(__linux__)
+			syscall(SYS_futex, addr, FUTEX_WAKE_PRIVATE, n, 0, 0, 0);
+#else
+			(void)addr;
+			(void)n;
+#endif
+		}
+
+		// Tells the processor that the thread is spinning
+		inline void cpu_relax()
+		{
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__i386__) || defined(__x86_64__))
+			__builtin_ia32_pause();
+#endif
+		}
+
+	} // namespace mpmc_detail
+
+	template <typename T, typename Alloc = std::allocator<T> >
+	class mpmc_queue
+	{
+
+	public:
+		/*************************************************************
+		 * Types
+		 *************************************************************/
+		typedef T									value_type;
+		typedef Alloc								allocator_type;
+		typedef typename Alloc::size_type			size_type;
+		typedef typename Alloc::difference_type		difference_type;
+		typedef typename Alloc::reference			reference;
+		typedef typename Alloc::const_reference		const_reference;
+
+	private:
+		// Ready to be filled on turn seq, or to be emptied on turn
+		// seq - 1. Only value is constructed, when the cell is filled.
+		struct cell
+		{
+			size_type	seq;
+			value_type	value;
+		};
+
+		typedef typename Alloc::template rebind<cell>::other	cell_allocator;
+
+		// The position one kind of threads claims cells at, and the event
+		// that threads of the other kind wait on when they cannot claim
+		// theirs. Both are written by the threads that claim, out of the
+		// cache lines of the fields before and after them.
+		// The low bit of event is set while threads may sleep on it, the
+		// other bits count the notify() that woke them.
+		struct side
+		{
+			side() : pos(0), event(0) {}
+
+			char			pad[64];
+			size_type		pos;
+			unsigned int	event;
+			char			pad_after[64];
+		};
+
+		// Failed attempts before a waiting thread sleeps
+		enum { spin_count = 128 };
+
+	public:
+		/*************************************************************
+		 * Construct/Destroy
+		 *************************************************************/
+		// Room for at least capacity elements
+		explicit mpmc_queue(size_type capacity,
+							const allocator_type &alloc = allocator_type())
+			: _alloc(alloc), _cells(0), _mask(round_up(capacity) - 1)
+		{
+			_cells = cell_allocator(_alloc).allocate(_mask + 1);
+			for (size_type i = 0; i <= _mask; ++i)
+				_cells[i].seq = i;
+		}
+
+		// Destroys the elements that were not popped
+		~mpmc_queue()
+		{
+			for (size_type i = _consumers.pos; i != _producers.pos; ++i)
+				_alloc.destroy(&_cells[i & _mask].value);
+			cell_allocator(_alloc).deallocate(_cells, _mask + 1);
+		}
+
+		allocator_type get_allocator() const { return _alloc; }
+
+		/*************************************************************
+		 * Capacity
+		 *************************************************************/
+		size_type capacity() const { return _mask + 1; }
+
+		// Only exact while no other thread uses the queue
+		size_type size() const
+		{
+			const size_type popped = ft::atomic_load(&_consumers.pos);
+			const size_type pushed = ft::atomic_load(&_producers.pos);
+
+			return pushed - popped > _mask ? _mask + 1 : pushed - popped;
+		}
+
+		bool empty() const { return size() == 0; }
+
+		/*************************************************************
+		 * Modifiers
+		 *************************************************************/
+		// False if the queue is full
+		bool try_push(const value_type &x)
+		{
+			size_type pos;
+
+			if (claim(&_producers.pos, 0, 1, pos) == 0)
+				return false;
+			fill(pos, x);
+			notify(_producers);
+			return true;
+		}
+
+		// Waits until there is room for x
+		void push(const value_type &x)
+		{
+			for (unsigned int spins = 0; !try_push(x); ++spins)
+			{
+				if (spins < spin_count)
+					mpmc_detail::cpu_relax();
+				else if (wait(_consumers, x))
+					return;
+			}
+		}
+
+		// False if the queue is empty
+		bool try_pop(value_type &x)
+		{
+			size_type pos;
+
+			if (claim(&_consumers.pos, 1, 1, pos) == 0)
+				return false;
+			empty_into(pos, x);
+			notify(_consumers);
+			return true;
+		}
+
+		// Waits until there is an element to pop into x
+		void pop(value_type &x)
+		{
+			for (unsigned int spins = 0; !try_pop(x); ++spins)
+			{
+				if (spins < spin_count)
+					mpmc_detail::cpu_relax();
+				else if (wait(_producers, x))
+					return;
+			}
+		}
+
+		// Pushes the first elements of [first, first + n), as many as
+		// there are free cells in a row, and returns their number.
+		template <typename InputIterator>
+		size_type try_push_n(InputIterator first, size_type n)
+		{
+			size_type pos;
+			const size_type claimed = claim(&_producers.pos, 0, n, pos);
+
+			for (size_type i = 0; i < claimed; ++i, ++first)
+				fill(pos + i, *first);
+			if (claimed != 0)
+				notify(_producers);
+			return claimed;
+		}
+
+		// Assigns up to n of the oldest elements to out, out + 1...
+		// as many as there are filled cells in a row, removes them, and
+		// returns their number.
+		template <typename OutputIterator>
+		size_type try_pop_n(OutputIterator out, size_type n)
+		{
+			size_type pos;
+			const size_type claimed = claim(&_consumers.pos, 1, n, pos);
+
+			for (size_type i = 0; i < claimed; ++i, ++out)
+				empty_into(pos + i, *out);
+			if (claimed != 0)
+				notify(_consumers);
+			return claimed;
+		}
+
+		// Appends up to n of the oldest elements to v, and returns their
+		// number. v grows once, before any cell is claimed.
+		template <typename VectorAlloc>
+		size_type drain(ft::vector<value_type, VectorAlloc> &v,
+						size_type n = size_type(-1))
+		{
+			size_type pos;
+
+			if (n > size())
+				n = size();
+			if (n == 0)
+				return 0;
+			v.reserve(v.size() + n);
+
+			const size_type claimed = claim(&_consumers.pos, 1, n, pos);
+
+			for (size_type i = 0; i < claimed; ++i)
+			{
+				cell &c = _cells[(pos + i) & _mask];
+
+				v.push_back(c.value);
+				release(c, pos + i);
+			}
+			if (claimed != 0)
+				notify(_consumers);
+			return claimed;
+		}
+
+	private:
+		mpmc_queue(const mpmc_queue &);
+		mpmc_queue &operator=(const mpmc_queue &);
+
+		// At least two cells: with one, a filled cell would have the
+		// sequence number the next producer waits for, as if empty
+		static size_type round_up(size_type n)
+		{
+			size_type p = 2;
+
+			while (p < n)
+				p <<= 1;
+			return p;
+		}
+
+		// Claims up to n cells in a row from *index, whose sequence number
+		// is their turn plus ready: 0 to fill them, 1 to empty them. The
+		// first one is at pos. Returns their number, 0 if the first cell
+		// is not ready yet (the queue is full, or empty).
+		size_type claim(size_type *index, size_type ready, size_type n,
+						size_type &pos)
+		{
+			if (n == 0)
+				return 0;
+			pos = ft::atomic_load(index);
+			for (;;)
+			{
+				const difference_type dif = difference_type(
+					ft::atomic_load(&_cells[pos & _mask].seq) - (pos + ready));
+				size_type k = 1;
+
+				if (dif < 0)
+					return 0;
+				if (dif > 0)
+				{
+					// Claimed by another thread since pos was loaded
+					pos = ft::atomic_load(index);
+					continue;
+				}
+				while (k < n && ft::atomic_load(&_cells[(pos + k) & _mask].seq)
+									== pos + k + ready)
+					++k;
+				if (ft::atomic_compare_exchange(index, pos, pos + k))
+					return k;
+			}
+		}
+
+		void fill(size_type pos, const value_type &x)
+		{
+			cell &c = _cells[pos & _mask];
+
+			_alloc.construct(&c.value, x);
+			ft::atomic_store(&c.seq, pos + 1);
+		}
+
+		template <typename Out>
+		void empty_into(size_type pos, Out &x)
+		{
+			cell &c = _cells[pos & _mask];
+
+			x = c.value;
+			release(c, pos);
+		}
+
+		// Makes the cell emptied on turn pos ready for the next turn
+		void release(cell &c, size_type pos)
+		{
+			_alloc.destroy(&c.value);
+			ft::atomic_store(&c.seq, pos + _mask + 1);
+		}
+
+		// After cells were claimed at s: wakes the threads waiting on s.
+		// The fence orders the stores to the cells before the load of the
+		// event, against the opposite order in wait(). Moving the event
+		// on clears its low bit, so that the threads that claim cells
+		// before the waiters sleep again make no system call.
+		static void notify(side &s)
+		{
+			unsigned int event;
+
+			ft::atomic_thread_fence();
+			event = ft::atomic_load(&s.event);
+			while ((event & 1) != 0
+				   && !ft::atomic_compare_exchange(&s.event, event, event + 1))
+				;
+			if ((event & 1) == 0)
+				return;
+			mpmc_detail::futex_wake(&s.event, INT_MAX);
+		}
+
+		// Sleeps until the next notify() on s, unless a last try, made
+		// once the low bit of the event is set, succeeds. Returns that
+		// try. Nothing is undone when it succeeds: the bit only costs
+		// the next notify() a system call. The thread sleeps on the
+		// value it saw with the bit set: any notify() since then moved
+		// the event on, and does not let it sleep.
+		bool wait(side &s, const value_type &x)
+		{ return wait_then(s, x, &mpmc_queue::try_push); }
+
+		bool wait(side &s, value_type &x)
+		{ return wait_then(s, x, &mpmc_queue::try_pop); }
+
+		template <typename Arg>
+		bool wait_then(side &s, Arg &x, bool (mpmc_queue::*attempt)(Arg &))
+		{
+			unsigned int event = ft::atomic_load(&s.event);
+
+			while ((event & 1) == 0
+				   && !ft::atomic_compare_exchange(&s.event, event, event | 1))
+				;
+			event |= 1;
+			ft::atomic_thread_fence();
+
+			const bool done = (this->*attempt)(x);
+
+			if (!done)
+				mpmc_detail::futex_wait(&s.event, event);
+			return done;
+		}
+
+		// Read by all the threads, written by none after construction
+		allocator_type	_alloc;
+		cell			*_cells;
+		size_type		_mask;
+
+		side			_producers;
+		side			_consumers;
+
+	}; // mpmc_queue
+
+} // namespace ft
+
+#endif /* _FT_MPMC_QUEUE_HPP */
@@ -0,0 +1,398 @@
+#ifndef _FT_MULTIMAP_HPP
+#define _FT_MULTIMAP_HPP
+
+#include <functional>
+#include <memory>
+
+#include "algorithm.hpp"
+#include "type_traits.hpp"
+#include "iterator.hpp"
+#include "utility.hpp"
+#include "tree.hpp"
+#include "node_handle.hpp"
+
+/*************************************************************
+ * multimap
+
+ * A map in which several pairs may have equivalent keys, on the same
+	tree as map. Pairs with equivalent keys stay in the order they
+	were inserted in.
+
+ * insert() with a hint links the pair next to it when it belongs
+	there: appending a sorted run with end() as the hint takes
+	constant amortized time per pair, as does building a multimap
+	from a sorted range.
+*************************************************************/
+
+namespace ft
+{
+
+	template <typename Key, typename T, typename Compare = std::less<Key>,
+			  typename Alloc = std::allocator<ft::pair<const Key, T> > >
+	class multimap
+	{
+
+	public:
+		/*************************************************************
+		 * Types
+		 *************************************************************/
+		typedef Key										key_type;
+		typedef T										mapped_type;
+		typedef ft::pair<const key_type, mapped_type>	value_type;
+		typedef Compare									key_compare;
+		typedef Alloc 									allocator_type;
+
+		/*************************************************************
+		 * value_compare
+		 * In C++98, it is required to inherit binary_function<value_type,value_type,bool>
+		 *************************************************************/
+		class value_compare : public std::binary_function<value_type, value_type, bool>
+		{
+			friend class multimap;
+
+		protected:
+			Compare comp;
+			// constructed with multimap's comparison object
+			value_compare(Compare c) : comp(c) {}
+
+		public:
+			typedef bool result_type;
+			typedef value_type first_argument_type;
+			typedef value_type second_argument_type;
+
+			bool operator()(const value_type &x, const value_type &y) const
+			{ return comp(x.first, y.first); }
+		};
+
+		typedef typename __gnu_cxx::__alloc_traits<Alloc>::template rebind<value_type>
+			::other							pair_alloc_type;
+
+		typedef rb_tree<key_type, value_type, std::_Select1st<value_type>,
+			key_compare, pair_alloc_type>	rep_type;
+
+		/// The actual tree structure.
+		rep_type _t;
+
+		typedef __gnu_cxx::__alloc_traits<pair_alloc_type>	alloc_traits;
+
+	public:
+		typedef typename alloc_traits::pointer pointer;
+		typedef typename alloc_traits::const_pointer const_pointer;
+		typedef typename alloc_traits::reference reference;
+		typedef typename alloc_traits::const_reference const_reference;
+		typedef typename rep_type::iterator iterator;
+		typedef typename rep_type::const_iterator const_iterator;
+		typedef typename rep_type::size_type size_type;
+		typedef typename rep_type::difference_type difference_type;
+		typedef typename rep_type::reverse_iterator reverse_iterator;
+		typedef typename rep_type::const_reverse_iterator const_reverse_iterator;
+		typedef ft::map_node_handle<Key, T, typename rep_type::node_allocator> node_type;
+
+		/*************************************************************
+		 * Construct/Copy/Destroy
+		 *************************************************************/
+		// Default constructor creates no elements
+		multimap() : _t() {}
+
+		explicit multimap(const key_compare &comp,
+						  const allocator_type &alloc = allocator_type())
+			: _t(comp, pair_alloc_type(alloc)) {}
+
+		multimap(const multimap &x) : _t(x._t) {}
+
+		// Builds a multimap from a range
+		// The tree is built in a single pass, linear in N, as long as
+		// the range is sorted, and the elements that follow the first
+		// one out of order are inserted in NlogN
+		// (where N is distance(first,last)).
+		template <typename InputIterator>
+		multimap(InputIterator first, InputIterator last) : _t()
+		{ _t.insert_range_equal(first, last); }
+
+		template <typename InputIterator>
+		multimap(InputIterator first, InputIterator last, const Compare &comp,
+				 const allocator_type &alloc = allocator_type())
+			: _t(comp, pair_alloc_type(alloc))
+		{ _t.insert_range_equal(first, last); }
+
+		/*************************************************************
+		 *  Assignment operator
+		 *************************************************************/
+		multimap &operator=(const multimap &x)
+		{ _t = x._t; return *this; }
+
+		/*************************************************************
+		 *  Get a copy of the memory allocation object
+		 *************************************************************/
+		allocator_type get_allocator() const
+		{ return allocator_type(_t.get_allocator()); }
+
+		/*************************************************************
+		 * Iterators
+		 *************************************************************/
+		// Return a iterator that points to the first pair in the multimap.
+		// Iteration is done in ascending order according to the keys.
+		iterator begin(void) { return _t.begin(); }
+		const_iterator begin(void) const { return _t.begin(); }
+
+		// Return a iterator that points to the one past the last pair
+		// in the multimap.
+		iterator end(void) { return _t.end(); }
+		const_iterator end(void) const { return _t.end(); }
+
+		// Return a reverse iterator that points to the last pair in the
+		// multimap. Iteration is done in descending order according to the keys.
+		reverse_iterator rbegin(void) { return _t.rbegin(); }
+		const_reverse_iterator rbegin(void) const { return _t.rbegin(); }
+
+		// Return a reverse iterator that points to the one before
+		// the first pair in the multimap.
+		reverse_iterator rend(void) { return _t.rend(); }
+		const_reverse_iterator rend(void) const { return _t.rend(); }
+
+		/*************************************************************
+		 * Capacity
+		 *************************************************************/
+		// Returns true if the multimap is empty.
+		bool empty() const { return _t.empty(); }
+		// Returns the size of the multimap
+		size_type size() const { return _t.size(); }
+		// Returns the maximum size of the multimap
+		size_type max_size() const { return _t.max_size(); }
+
+		/*************************************************************
+		 * Modifiers
+		 *************************************************************/
+		// Inserts a pair into the multimap, after the pairs with an
+		// equivalent key, and returns an iterator to it.
+		iterator insert(const value_type &x)
+		{ return _t.insert_equal(x); }
+
+		// position: An iterator that serves as a hint as to where the
+		// pair should be inserted. The pair is inserted as close as
+		// possible before position: in constant amortized time if it
+		// belongs there, or with a descent of the tree otherwise.
+		iterator insert(const_iterator position, const value_type &x)
+		{ return _t.insert_equal_(position, x); }
+
+		// Template function that inserts a range of elements
+		template <typename InputIterator>
+		void insert(InputIterator first, InputIterator last)
+		{ _t.insert_range_equal(first, last); }
+
+		// Erases the pair at position
+		void erase(iterator position) { _t.erase(position); }
+
+		// Erases all the pairs whose key is equivalent to x, and returns
+		// their number
+		size_type erase(const key_type &x) { return _t.erase(x); }
+
+		// Erases a [first,last) range of elements from a multimap
+		void erase(iterator first, iterator last) { _t.erase(first, last); }
+
+		// Swaps data with another multimap
+		void swap(multimap &x) { _t.swap(x._t); }
+
+		// Erases all elements in a multimap
+		void clear() { _t.clear(); }
+
+		// Unlinks the pair at position, or the first pair with key x, from
+		// the multimap, and returns a handle that owns its node (empty if
+		// x is not found). Not available with pool_allocator, whose nodes
+		// cannot outlive the multimap.
+		node_type extract(const_iterator position)
+		{ return node_type(_t.extract_node(position), _t.get_node_allocator()); }
+
+		node_type extract(const key_type &x)
+		{
+			iterator i = find(x);
+
+			if (i == end())
+				return node_type();
+			return extract(const_iterator(i));
+		}
+
+		// Links the node of nh into the multimap, which always takes it.
+		// Returns end() if nh is empty.
+		iterator insert(node_type nh)
+		{
+			if (nh.empty())
+				return end();
+
+			iterator it = _t.reinsert_node_equal(nh._ptr);
+
+			nh.release();
+			return it;
+		}
+
+		// Moves all the pairs of source to this multimap, relinking their
+		// nodes. source is left empty.
+		void merge(multimap &source) { _t.merge_equal(source._t); }
+
+		/*************************************************************
+		 * Observers
+		 *************************************************************/
+		// Returns the key comparison object out of which the multimap was
+		// constructed.
+		key_compare key_comp() const { return _t.key_comp(); }
+		// Returns a value comparison object, built from the key comparison
+		//	object out of which the multimap was constructed.
+		value_compare value_comp() const { return value_compare(_t.key_comp()); }
+
+		/*************************************************************
+		 * Multimap operations
+		 *************************************************************/
+		// These functions return an iterator to the first pair whose key
+		// is equivalent to x, or end().
+		iterator find(const key_type &x) { return _t.find(x); }
+		const_iterator find(const key_type &x) const { return _t.find(x); }
+
+		// Returns the number of pairs whose key is equivalent to x. Both
+		// ends of the run are found in a single descent of the tree.
+		size_type count(const key_type &x) const { return _t.count(x); }
+
+		// These functions return the first element whose key is not
+		// less than x, or end().
+		iterator lower_bound(const key_type &x) { return _t.lower_bound(x); }
+		const_iterator lower_bound(const key_type &x) const
+		{ return _t.lower_bound(x); }
+
+		// Theses functions return an iterator pointing to the first element
+		//   greater than key, or end().
+		iterator upper_bound(const key_type &x) { return _t.upper_bound(x); }
+		const_iterator upper_bound(const key_type &x) const
+		{ return _t.upper_bound(x); }
+
+		// Returns the run of pairs whose key is equivalent to x, as
+		// (lower_bound(x), upper_bound(x)), in a single descent.
+		pair<iterator, iterator> equal_range(const key_type &x)
+		{ return _t.equal_range(x); }
+		pair<const_iterator, const_iterator> equal_range(const key_type &x) const
+		{ return _t.equal_range(x); }
+
+		// Transparent lookups, only when Compare declares is_transparent
+		// (as ft::less<> does): x may be of any type that Compare can
+		// compare to the keys, and is not converted to key_type.
+		template <typename K>
+		typename ft::enable_if<ft::has_is_transparent<Compare, K>::value,
+							   iterator>::type
+		find(const K &x) { return _t.find(x); }
+
+		template <typename K>
+		typename ft::enable_if<ft::has_is_transparent<Compare, K>::value,
+							   const_iterator>::type
+		find(const K &x) const { return _t.find(x); }
+
+		template <typename K>
+		typename ft::enable_if<ft::has_is_transparent<Compare, K>::value,
+							   size_type>::type
+		count(const K &x) const { return _t.count(x); }
+
+		template <typename K>
+		typename ft::enable_if<ft::has_is_transparent<Compare, K>::value,
+							   iterator>::type
+		lower_bound(const K &x) { return _t.lower_bound(x); }
+
+		template <typename K>
+		typename ft::enable_if<ft::has_is_transparent<Compare, K>::value,
+							   const_iterator>::type
+		lower_bound(const K &x) const { return _t.lower_bound(x); }
+
+		template <typename K>
+		typename ft::enable_if<ft::has_is_transparent<Compare, K>::value,
+							   iterator>::type
+		upper_bound(const K &x) { return _t.upper_bound(x); }
+
+		template <typename K>
+		typename ft::enable_if<ft::has_is_transparent<Compare, K>::value,
+							   const_iterator>::type
+		upper_bound(const K &x) const { return _t.upper_bound(x); }
+
+		template <typename K>
+		typename ft::enable_if<ft::has_is_transparent<Compare, K>::value,
+							   pair<iterator, iterator> >::type
+		equal_range(const K &x) { return _t.equal_range(x); }
+
+		template <typename K>
+		typename ft::enable_if<ft::has_is_transparent<Compare, K>::value,
+							   pair<const_iterator, const_iterator> >::type
+		equal_range(const K &x) const { return _t.equal_range(x); }
+
+#ifdef FT_RB_TREE_ORDER_STATISTICS
+		/*************************************************************
+		 * Order statistics
+
+		 * Only with FT_RB_TREE_ORDER_STATISTICS, in logarithmic time.
+		 *************************************************************/
+		// Return an iterator to the k-th pair, counting from 0, or end()
+		// if the multimap has no more than k pairs.
+		iterator select(size_type k) { return _t.select(k); }
+		const_iterator select(size_type k) const { return _t.select(k); }
+
+		// Return the number of pairs whose key is less than x.
+		size_type rank(const key_type &x) const { return _t.rank(x); }
+
+		// Return the number of pairs between first and last.
+		difference_type distance(const_iterator first, const_iterator last) const
+		{ return _t.distance(first, last); }
+#endif
+
+		/*************************************************************
+		 *  Relational operators
+		 *************************************************************/
+
+		template <typename _K1, typename _T1, typename _C1, typename _A1>
+		friend bool operator==(const multimap<_K1, _T1, _C1, _A1> &,
+							   const multimap<_K1, _T1, _C1, _A1> &);
+
+		template <typename _K1, typename _T1, typename _C1, typename _A1>
+		friend bool operator<(const multimap<_K1, _T1, _C1, _A1> &,
+							  const multimap<_K1, _T1, _C1, _A1> &);
+
+	}; // multimap
+
+	/*************************************************************
+	 *  Relational operators
+	 *************************************************************/
+	// This is an equivalence relation.  It is linear in the size of the
+	// multimaps.  Multimaps are considered equivalent if their sizes are
+	// equal, and if corresponding elements compare equal.
+	template <typename Key, typename T, typename key_compare, typename allocator_type>
+	bool operator==(const multimap<Key, T, key_compare, allocator_type> &x,
+					const multimap<Key, T, key_compare, allocator_type> &y)
+	{ return x._t == y._t; }
+
+	template <typename Key, typename T, typename key_compare, typename allocator_type>
+	bool operator<(const multimap<Key, T, key_compare, allocator_type> &x,
+				   const multimap<Key, T, key_compare, allocator_type> &y)
+	{ return x._t < y._t; }
+
+	template <typename Key, typename T, typename key_compare, typename allocator_type>
+	bool operator!=(const multimap<Key, T, key_compare, allocator_type> &x,
+					const multimap<Key, T, key_compare, allocator_type> &y)
+	{ return !(x._t == y._t); }
+
+	template <typename Key, typename T, typename key_compare, typename allocator_type>
+	bool operator>(const multimap<Key, T, key_compare, allocator_type> &x,
+				   const multimap<Key, T, key_compare, allocator_type> &y)
+	{ return y < x; }
+
+	template <typename Key, typename T, typename key_compare, typename allocator_type>
+	bool operator>=(const multimap<Key, T, key_compare, allocator_type> &x,
+					const multimap<Key, T, key_compare, allocator_type> &y)
+	{ return !(x < y); }
+
+	template <typename Key, typename T, typename key_compare, typename allocator_type>
+	bool operator<=(const multimap<Key, T, key_compare, allocator_type> &x,
+					const multimap<Key, T, key_compare, allocator_type> &y)
+	{ return !(y < x); }
+
+	// specialized algorithms:
+	template <typename Key, typename T, typename key_compare, typename allocator_type>
+	void swap(multimap<Key, T, key_compare, allocator_type> &x,
+			  multimap<Key, T, key_compare, allocator_type> &y)
+	{ x.swap(y); }
+
+} // namespace ft
+
+#endif /* _FT_MULTIMAP_HPP */
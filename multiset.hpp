@@ -0,0 +1,366 @@
+#ifndef _FT_MULTISET_HPP
+# define _FT_MULTISET_HPP
+
+# include <functional>
+# include <memory>
+
+# include "algorithm.hpp"
+# include "type_traits.hpp"
+# include "iterator.hpp"
+# include "utility.hpp"
+# include "tree.hpp"
+# include "node_handle.hpp"
+
+/*************************************************************
+ * multiset
+
+ * A set in which several elements may be equivalent, on the same tree
+	as set. Equivalent elements stay in the order they were inserted in.
+
+ * insert() with a hint links the element next to it when it belongs
+	there: appending a sorted run with end() as the hint takes
+	constant amortized time per element, as does building a multiset
+	from a sorted range.
+*************************************************************/
+
+namespace ft {
+
+	template <typename Key, typename Compare = std::less<Key>,
+		typename Alloc = std::allocator<Key> >
+	class multiset {
+
+	public:
+
+		/*************************************************************
+		 * Types
+		*************************************************************/
+		typedef Key		key_type;
+		typedef Key		value_type;
+		typedef Compare	key_compare;
+		typedef Compare value_compare;
+		typedef Alloc	allocator_type;
+
+		typedef typename __gnu_cxx::__alloc_traits<Alloc>::template
+		rebind<Key>::other _Key_alloc_type;
+
+		typedef rb_tree<key_type, value_type, std::_Identity<value_type>,
+				key_compare, _Key_alloc_type> rep_type;
+
+		rep_type _t;  // Red-black tree representing multiset.
+
+		typedef __gnu_cxx::__alloc_traits<_Key_alloc_type> alloc_traits;
+
+		typedef typename alloc_traits::pointer				pointer;
+		typedef typename alloc_traits::const_pointer		const_pointer;
+		typedef typename alloc_traits::reference			reference;
+		typedef typename alloc_traits::const_reference		const_reference;
+		typedef typename rep_type::const_iterator			iterator;
+		typedef typename rep_type::const_iterator			const_iterator;
+		typedef typename rep_type::size_type				size_type;
+		typedef typename rep_type::difference_type			difference_type;
+		typedef typename rep_type::const_reverse_iterator	reverse_iterator;
+		typedef typename rep_type::const_reverse_iterator	const_reverse_iterator;
+		typedef ft::set_node_handle<Key, typename rep_type::node_allocator>	node_type;
+
+		/*************************************************************
+		 * Construct/Copy/Destroy
+		*************************************************************/
+		// Default constructor creates no elements
+		multiset() : _t() {}
+
+		explicit multiset(const Compare& comp,
+			const allocator_type& alloc = allocator_type())
+			: _t(comp, _Key_alloc_type(alloc)) {}
+
+		multiset(const multiset& x) : _t(x._t) {}
+
+		// Builds a multiset from a range
+		// The tree is built in a single pass, linear in N, as long as
+		// the range is sorted, and the elements that follow the first
+		// one out of order are inserted in NlogN
+		// (where N is distance(first,last)).
+		template <typename InputIterator>
+		multiset(InputIterator first, InputIterator last) : _t()
+		{ _t.insert_range_equal(first, last); }
+
+		template <typename InputIterator>
+		multiset(InputIterator first, InputIterator last, const Compare& comp,
+			const allocator_type& alloc = allocator_type())
+			: _t(comp, _Key_alloc_type(alloc))
+		{ _t.insert_range_equal(first, last); }
+
+		/*************************************************************
+		 *  Assignment operator
+		*************************************************************/
+		multiset&	operator=(const multiset& x)
+		{ _t = x._t; return *this; }
+
+		/*************************************************************
+		 *  Accessors
+		*************************************************************/
+		///  Returns the comparison object with which the multiset was constructed.
+		key_compare		key_comp() const { return _t.key_comp(); }
+		///  Returns the comparison object with which the multiset was constructed.
+		value_compare	value_comp() const { return _t.key_comp(); }
+		///  Returns the allocator object with which the multiset was constructed.
+		allocator_type	get_allocator() const
+		{ return allocator_type(_t.get_allocator()); }
+
+		/*************************************************************
+		 * Iterators
+		*************************************************************/
+		// Return a iterator that points to the first element in the multiset.
+		// Iteration is done in ascending order according to the keys.
+		iterator				begin(void) const { return _t.begin(); }
+
+		// Return a iterator that points to the one past the last element
+		// in the multiset.
+		iterator				end(void) const { return _t.end(); }
+
+		// Return a reverse iterator that points to the last element in the
+		// multiset. Iteration is done in descending order according to the keys.
+		reverse_iterator		rbegin(void) const { return _t.rbegin(); }
+
+		// Return a reverse iterator that points to the one before
+		// the first element in the multiset.
+		reverse_iterator		rend(void) const { return _t.rend(); }
+
+		/*************************************************************
+		 * Capacity
+		*************************************************************/
+		// Returns true if the multiset is empty
+		bool 		empty() const { return _t.empty(); }
+		// Returns the size of the multiset
+		size_type 	size() const { return _t.size(); }
+		// Returns the maximum size of the multiset
+		size_type	max_size() const { return _t.max_size(); }
+
+		/*************************************************************
+		 * Modifiers
+		*************************************************************/
+
+		// Swaps data with another multiset
+		void		swap(multiset& x) { _t.swap(x._t); }
+
+		// Inserts an element into the multiset, after the equivalent
+		// elements, and returns an iterator to it.
+		iterator	insert(const value_type& x)
+		{ return _t.insert_equal(x); }
+
+		// The element is inserted as close as possible before position:
+		// in constant amortized time if it belongs there, or with a
+		// descent of the tree otherwise.
+		iterator	insert(const_iterator position, const value_type& x)
+		{ return _t.insert_equal_(position, x); }
+
+		// A template function that inserts a range of elements.
+		template<typename _InputIterator>
+		void	insert(_InputIterator first, _InputIterator last)
+		{ _t.insert_range_equal(first, last); }
+
+		// Erases an element from a multiset
+		void	erase(iterator position)
+		{ _t.erase(position); }
+
+		// Erases all the elements equivalent to x, and returns their number
+		size_type	erase(const key_type& x)
+		{ return _t.erase(x); }
+
+		// Erases a [first,last) range of elements from a multiset
+		void	erase(iterator first, iterator last)
+		{ _t.erase(first, last); }
+
+		// Erases all elements in a multiset
+		void		clear() { _t.clear(); }
+
+		// Unlinks the element at position, or the first one equivalent to
+		// x, from the multiset, and returns a handle that owns its node
+		// (empty if x is not found). Not available with pool_allocator,
+		// whose nodes cannot outlive the multiset.
+		node_type	extract(const_iterator position)
+		{ return node_type(_t.extract_node(position), _t.get_node_allocator()); }
+
+		node_type	extract(const key_type& x)
+		{
+			const_iterator i = find(x);
+
+			if (i == end())
+				return node_type();
+			return extract(i);
+		}
+
+		// Links the node of nh into the multiset, which always takes it.
+		// Returns end() if nh is empty.
+		iterator	insert(node_type nh)
+		{
+			if (nh.empty())
+				return end();
+
+			iterator it = _t.reinsert_node_equal(nh._ptr);
+
+			nh.release();
+			return it;
+		}
+
+		// Moves all the elements of source to this multiset, relinking
+		// their nodes. source is left empty.
+		void		merge(multiset& source) { _t.merge_equal(source._t); }
+
+		/*************************************************************
+		 * Multiset operations
+		*************************************************************/
+		// These functions return an iterator to the first element
+		// equivalent to x, or end().
+		iterator		find(const key_type& x) { return _t.find(x); }
+		const_iterator	find(const key_type& x) const { return _t.find(x); }
+
+		// Returns the number of elements equivalent to x. Both ends of
+		// the run are found in a single descent of the tree.
+		size_type		count(const key_type& x) const { return _t.count(x); }
+
+		// These functions return the first element that is not less
+		// than x, or end().
+		iterator 		lower_bound(const key_type& x) { return _t.lower_bound(x); }
+		const_iterator	lower_bound(const key_type& x) const
+		{ return _t.lower_bound(x); }
+
+		// Theses functions return an iterator pointing to the first element
+		//   greater than key, or end().
+		iterator		upper_bound(const key_type& x) { return _t.upper_bound(x); }
+		const_iterator	upper_bound(const key_type& x) const
+		{ return _t.upper_bound(x); }
+
+		// Returns the run of elements equivalent to x, as
+		// (lower_bound(x), upper_bound(x)), in a single descent.
+		pair<iterator,iterator>				equal_range(const key_type& x)
+		{ return _t.equal_range(x); }
+		pair<const_iterator,const_iterator>	equal_range(const key_type& x) const
+		{ return _t.equal_range(x); }
+
+		// Transparent lookups, only when Compare declares is_transparent
+		// (as ft::less<> does): x may be of any type that Compare can
+		// compare to the elements, and is not converted to key_type.
+		template <typename K>
+		typename ft::enable_if<ft::has_is_transparent<Compare, K>::value,
+			iterator>::type
+						find(const K& x) { return _t.find(x); }
+
+		template <typename K>
+		typename ft::enable_if<ft::has_is_transparent<Compare, K>::value,
+			iterator>::type
+						find(const K& x) const { return _t.find(x); }
+
+		template <typename K>
+		typename ft::enable_if<ft::has_is_transparent<Compare, K>::value,
+			size_type>::type
+						count(const K& x) const { return _t.count(x); }
+
+		template <typename K>
+		typename ft::enable_if<ft::has_is_transparent<Compare, K>::value,
+			iterator>::type
+						lower_bound(const K& x) { return _t.lower_bound(x); }
+
+		template <typename K>
+		typename ft::enable_if<ft::has_is_transparent<Compare, K>::value,
+			iterator>::type
+						lower_bound(const K& x) const { return _t.lower_bound(x); }
+
+		template <typename K>
+		typename ft::enable_if<ft::has_is_transparent<Compare, K>::value,
+			iterator>::type
+						upper_bound(const K& x) { return _t.upper_bound(x); }
+
+		template <typename K>
+		typename ft::enable_if<ft::has_is_transparent<Compare, K>::value,
+			iterator>::type
+						upper_bound(const K& x) const { return _t.upper_bound(x); }
+
+		template <typename K>
+		typename ft::enable_if<ft::has_is_transparent<Compare, K>::value,
+			pair<iterator, iterator> >::type
+						equal_range(const K& x) { return _t.equal_range(x); }
+
+		template <typename K>
+		typename ft::enable_if<ft::has_is_transparent<Compare, K>::value,
+			pair<iterator, iterator> >::type
+						equal_range(const K& x) const { return _t.equal_range(x); }
+
+#ifdef FT_RB_TREE_ORDER_STATISTICS
+		/*************************************************************
+		 * Order statistics
+
+		 * Only with FT_RB_TREE_ORDER_STATISTICS, in logarithmic time.
+		*************************************************************/
+		// Return an iterator to the k-th smallest element, counting
+		// from 0, or end() if the multiset has no more than k elements.
+		iterator		select(size_type k) const { return _t.select(k); }
+
+		// Return the number of elements less than x.
+		size_type		rank(const key_type& x) const { return _t.rank(x); }
+
+		// Return the number of elements between first and last.
+		difference_type	distance(const_iterator first, const_iterator last) const
+		{ return _t.distance(first, last); }
+#endif
+
+		/*************************************************************
+		 *  Relational operators
+		*************************************************************/
+
+		template<typename _K1, typename _C1, typename _A1>
+		friend bool	operator==(const multiset<_K1, _C1, _A1>&,
+			const multiset<_K1, _C1, _A1>&);
+
+		template<typename _K1, typename _C1, typename _A1>
+		friend bool	operator<(const multiset<_K1, _C1, _A1>&,
+			const multiset<_K1, _C1, _A1>&);
+
+	}; // multiset
+
+
+	/*************************************************************
+	 *  Relational operators
+	*************************************************************/
+	// This is an equivalence relation.  It is linear in the size of the
+	// multisets.  Multisets are considered equivalent if their sizes are
+	// equal, and if corresponding elements compare equal.
+	template <typename Key, typename key_compare, typename allocator_type>
+	bool operator==(const multiset<Key,key_compare,allocator_type>& x,
+		const multiset<Key,key_compare,allocator_type>& y)
+	{ return x._t == y._t; }
+
+	template <typename Key, typename key_compare, typename allocator_type>
+	bool operator< (const multiset<Key,key_compare,allocator_type>& x,
+		const multiset<Key,key_compare,allocator_type>& y)
+	{ return x._t < y._t; }
+
+	template <typename Key, typename key_compare, typename allocator_type>
+	bool operator!=(const multiset<Key,key_compare,allocator_type>& x,
+		const multiset<Key,key_compare,allocator_type>& y)
+	{ return !(x._t == y._t); }
+
+	template <typename Key, typename key_compare, typename allocator_type>
+	bool operator> (const multiset<Key,key_compare,allocator_type>& x,
+		const multiset<Key,key_compare,allocator_type>& y)
+	{ return y < x; }
+
+	template <typename Key, typename key_compare, typename allocator_type>
+	bool operator>=(const multiset<Key,key_compare,allocator_type>& x,
+		const multiset<Key,key_compare,allocator_type>& y)
+	{ return !(x < y); }
+
+	template <typename Key, typename key_compare, typename allocator_type>
+	bool operator<=(const multiset<Key,key_compare,allocator_type>& x,
+		const multiset<Key,key_compare,allocator_type>& y)
+	{ return !(y < x); }
+
+	// specialized algorithms:
+	template <typename Key, typename key_compare, typename allocator_type>
+	void swap(multiset<Key,key_compare,allocator_type>& x,
+		multiset<Key,key_compare,allocator_type>& y)
+	{ x.swap(y); }
+
+} // namespace ft
+
+
+#endif /* _FT_MULTISET_HPP */
@@ -0,0 +1,194 @@
+#ifndef _FT_NODE_HANDLE_HPP
+#define _FT_NODE_HANDLE_HPP
+
+#include <memory>
+
+#include "algorithm.hpp"
+#include "utility.hpp"
+
+/*************************************************************
+ * Node handles
+
+ * A node handle owns a node extracted from a map or a set, with the
+	value it holds, so that it can be inserted into another container
+	of the same type without being deallocated, reallocated or copied.
+
+ * C++98 has no move semantics: like std::auto_ptr, copying a node
+	handle transfers the node to the copy, and leaves the source empty.
+	This lets the handles returned by extract() be passed by value.
+
+ * A node can only be inserted into a container whose allocator compares
+	equal to the handle's, as this allocator gives the memory back.
+*************************************************************/
+
+namespace ft
+{
+	template <typename Key, typename T, typename Compare, typename Alloc>
+	class map;
+
+	template <typename Key, typename Compare, typename Alloc>
+	class set;
+
+	template <typename Key, typename T, typename Compare, typename Alloc>
+	class multimap;
+
+	template <typename Key, typename Compare, typename Alloc>
+	class multiset;
+
+	/*************************************************************
+	 * Ownership of the node, common to both handles
+	 *************************************************************/
+	template <typename Val, typename NodeAlloc>
+	class node_handle_base
+	{
+
+	public:
+		typedef typename NodeAlloc::template rebind<Val>::other	allocator_type;
+
+		allocator_type get_allocator() const { return allocator_type(_alloc); }
+
+		// Returns true if the handle holds no node
+		bool empty() const { return _ptr == 0; }
+
+		void swap(node_handle_base &nh)
+		{
+			ft::swap(_ptr, nh._ptr);
+			ft::swap(_alloc, nh._alloc);
+		}
+
+	protected:
+		typedef typename NodeAlloc::pointer	node_pointer;
+
+		node_handle_base() : _ptr(0), _alloc() {}
+
+		node_handle_base(node_pointer p, const NodeAlloc &a) : _ptr(p), _alloc(a) {}
+
+		// Takes the node of nh
+		node_handle_base(const node_handle_base &nh)
+			: _ptr(nh.release()), _alloc(nh._alloc) {}
+
+		node_handle_base &operator=(const node_handle_base &nh)
+		{
+			if (this != &nh)
+			{
+				reset();
+				_alloc = nh._alloc;
+				_ptr = nh.release();
+			}
+			return *this;
+		}
+
+		~node_handle_base() { reset(); }
+
+		Val &value_ref() const { return *_ptr->valptr(); }
+
+		// Gives the node back to the container it is inserted into
+		node_pointer release() const
+		{
+			node_pointer p = _ptr;
+
+			_ptr = 0;
+			return p;
+		}
+
+		void reset()
+		{
+			if (_ptr == 0)
+				return;
+			get_allocator().destroy(_ptr->valptr());
+			_alloc.deallocate(_ptr, 1);
+			_ptr = 0;
+		}
+
+		mutable node_pointer	_ptr;
+		NodeAlloc				_alloc;
+
+	}; // node_handle_base
+
+	/*************************************************************
+	 * Handle to a node of a map
+
+	 * key() gives a non const reference to the key, so that it can be
+		changed before the node is inserted again.
+	 *************************************************************/
+	template <typename Key, typename T, typename NodeAlloc>
+	class map_node_handle : public node_handle_base<ft::pair<const Key, T>, NodeAlloc>
+	{
+		typedef node_handle_base<ft::pair<const Key, T>, NodeAlloc>	base;
+
+		template <typename _K, typename _T, typename _C, typename _A>
+		friend class map;
+		template <typename _K, typename _T, typename _C, typename _A>
+		friend class multimap;
+
+	public:
+		typedef Key	key_type;
+		typedef T	mapped_type;
+
+		map_node_handle() : base() {}
+
+		key_type &key() const
+		{ return const_cast<key_type &>(this->value_ref().first); }
+
+		mapped_type &mapped() const { return this->value_ref().second; }
+
+	private:
+		map_node_handle(typename base::node_pointer p, const NodeAlloc &a)
+			: base(p, a) {}
+
+	}; // map_node_handle
+
+	/*************************************************************
+	 * Handle to a node of a set
+	 *************************************************************/
+	template <typename Val, typename NodeAlloc>
+	class set_node_handle : public node_handle_base<Val, NodeAlloc>
+	{
+		typedef node_handle_base<Val, NodeAlloc>	base;
+
+		template <typename _K, typename _C, typename _A>
+		friend class set;
+		template <typename _K, typename _C, typename _A>
+		friend class multiset;
+
+	public:
+		typedef Val	value_type;
+
+		set_node_handle() : base() {}
+
+		value_type &value() const { return this->value_ref(); }
+
+	private:
+		set_node_handle(typename base::node_pointer p, const NodeAlloc &a)
+			: base(p, a) {}
+
+	}; // set_node_handle
+
+	/*************************************************************
+	 * Result of insert(node_type)
+
+	 * If the key was already in the container, inserted is false,
+		position points to the element with this key, and node holds
+		the node again.
+	 *************************************************************/
+	template <typename Iterator, typename NodeType>
+	struct node_insert_return
+	{
+		Iterator	position;
+		bool		inserted;
+		NodeType	node;
+	};
+
+	template <typename Key, typename T, typename NodeAlloc>
+	void swap(map_node_handle<Key, T, NodeAlloc> &x,
+			  map_node_handle<Key, T, NodeAlloc> &y)
+	{ x.swap(y); }
+
+	template <typename Val, typename NodeAlloc>
+	void swap(set_node_handle<Val, NodeAlloc> &x,
+			  set_node_handle<Val, NodeAlloc> &y)
+	{ x.swap(y); }
+
+} // namespace ft
+
+#endif /* _FT_NODE_HANDLE_HPP */
@@ -0,0 +1,185 @@
+#ifndef _FT_PARALLEL_HPP
+#define _FT_PARALLEL_HPP
+
+#include <pthread.h>
+#include <unistd.h>
+
+#include "type_traits.hpp"
+#include "map.hpp"
+#include "set.hpp"
+
+/*************************************************************
+ * Parallel set algebra on map and set
+
+ * parallel_union, parallel_intersection and parallel_difference do
+	what union_with, intersect_with and difference_with do, on several
+	threads: at each step the root of one tree splits the other, and the
+	two halves are independent, so one of them goes to a new thread
+	while the current thread works on the other one. The halves are
+	joined back once both are done.
+ * Threads are only forked on the first levels of the recursion, so
+	that at most twice as many threads as asked for run at once, and
+	only while the subtrees have a black height of at least cutoff:
+	below, the work is too small to pay for a thread.
+ * C++98 has no threads: this header uses POSIX threads, so programs
+	that include it must be built with -pthread.
+ * Trees whose nodes come from a pool_allocator are merged on a single
+	thread, as a pool cannot be used from several threads at once.
+	Compare must not throw.
+*************************************************************/
+
+namespace ft
+{
+	class parallel_fork
+	{
+
+	public:
+		// A subtree of black height 12 holds at least 4095 nodes
+		enum { default_cutoff = 12 };
+
+		// threads == 0 means one per online processor
+		explicit parallel_fork(unsigned threads = 0, int cutoff = default_cutoff)
+			: _depth(fork_depth(threads != 0 ? threads : online_processors())),
+			  _cutoff(cutoff) {}
+
+		template <typename _Task>
+		void operator()(_Task &a, _Task &b, int height) const
+		{
+			if (_depth == 0 || height < _cutoff)
+			{
+				a();
+				b();
+				return;
+			}
+
+			parallel_fork	fa(*this);
+			parallel_fork	fb(*this);
+			pthread_t		thread;
+
+			--fa._depth;
+			--fb._depth;
+			a.fork = &fa;
+			b.fork = &fb;
+			// Without a new thread, a simply runs first
+			if (pthread_create(&thread, 0, &run<_Task>, &a) != 0)
+			{
+				a();
+				b();
+				return;
+			}
+			b();
+			pthread_join(thread, 0);
+		}
+
+	private:
+		template <typename _Task>
+		static void *run(void *task)
+		{
+			(*static_cast<_Task *>(task))();
+			return 0;
+		}
+
+		static unsigned online_processors()
+		{
+			const long n = sysconf(_SC_NPROCESSORS_ONLN);
+
+			return n > 0 ? static_cast<unsigned>(n) : 1;
+		}
+
+		// Enough levels for one thread per processor, and one more, as
+		// the two halves seldom hold the same number of nodes
+		static int fork_depth(unsigned threads)
+		{
+			int depth = 0;
+
+			if (threads <= 1)
+				return 0;
+			while ((1UL << depth) < threads)
+				++depth;
+			return depth + 1;
+		}
+
+		int	_depth;
+		int	_cutoff;
+
+	}; // parallel_fork
+
+	// Pooled nodes are only forked with a single thread
+	template <typename Tree>
+	parallel_fork make_parallel_fork(unsigned threads)
+	{
+		typedef ft::is_pool_allocator<typename Tree::node_allocator>	pooled;
+
+		return parallel_fork(pooled::value ? 1 : threads);
+	}
+
+	/*************************************************************
+	 * Set
+	*************************************************************/
+	template <typename Key, typename Compare, typename Alloc>
+	void parallel_union(set<Key, Compare, Alloc> &x, set<Key, Compare, Alloc> &y,
+						unsigned threads = 0)
+	{
+		typedef typename set<Key, Compare, Alloc>::rep_type	rep_type;
+
+		parallel_fork fork = make_parallel_fork<rep_type>(threads);
+		x._t.union_unique(y._t, fork);
+	}
+
+	template <typename Key, typename Compare, typename Alloc>
+	void parallel_intersection(set<Key, Compare, Alloc> &x,
+							   set<Key, Compare, Alloc> &y, unsigned threads = 0)
+	{
+		typedef typename set<Key, Compare, Alloc>::rep_type	rep_type;
+
+		parallel_fork fork = make_parallel_fork<rep_type>(threads);
+		x._t.intersect_unique(y._t, fork);
+	}
+
+	template <typename Key, typename Compare, typename Alloc>
+	void parallel_difference(set<Key, Compare, Alloc> &x,
+							 set<Key, Compare, Alloc> &y, unsigned threads = 0)
+	{
+		typedef typename set<Key, Compare, Alloc>::rep_type	rep_type;
+
+		parallel_fork fork = make_parallel_fork<rep_type>(threads);
+		x._t.difference_unique(y._t, fork);
+	}
+
+	/*************************************************************
+	 * Map
+	 * On keys only: the union keeps the mapped values of x.
+	*************************************************************/
+	template <typename Key, typename T, typename Compare, typename Alloc>
+	void parallel_union(map<Key, T, Compare, Alloc> &x,
+						map<Key, T, Compare, Alloc> &y, unsigned threads = 0)
+	{
+		typedef typename map<Key, T, Compare, Alloc>::rep_type	rep_type;
+
+		parallel_fork fork = make_parallel_fork<rep_type>(threads);
+		x._t.union_unique(y._t, fork);
+	}
+
+	template <typename Key, typename T, typename Compare, typename Alloc>
+	void parallel_intersection(map<Key, T, Compare, Alloc> &x,
+							   map<Key, T, Compare, Alloc> &y, unsigned threads = 0)
+	{
+		typedef typename map<Key, T, Compare, Alloc>::rep_type	rep_type;
+
+		parallel_fork fork = make_parallel_fork<rep_type>(threads);
+		x._t.intersect_unique(y._t, fork);
+	}
+
+	template <typename Key, typename T, typename Compare, typename Alloc>
+	void parallel_difference(map<Key, T, Compare, Alloc> &x,
+							 map<Key, T, Compare, Alloc> &y, unsigned threads = 0)
+	{
+		typedef typename map<Key, T, Compare, Alloc>::rep_type	rep_type;
+
+		parallel_fork fork = make_parallel_fork<rep_type>(threads);
+		x._t.difference_unique(y._t, fork);
+	}
+
+} // namespace ft
+
+#endif /* _FT_PARALLEL_HPP */
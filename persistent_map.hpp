@@ -0,0 +1,284 @@
+#ifndef _FT_PERSISTENT_MAP_HPP
+#define _FT_PERSISTENT_MAP_HPP
+
+#include <functional>
+#include <memory>
+
+#include "algorithm.hpp"
+#include "type_traits.hpp"
+#include "iterator.hpp"
+#include "utility.hpp"
+#include "persistent_tree.hpp"
+
+/*************************************************************
+ * persistent_map
+
+ * A map stored in a persistent tree (see persistent_tree.hpp):
+	copies and snapshots share their nodes, in O(1), and an insertion
+	or an erasure only copies the O(log n) nodes it changes.
+ * snapshot() gives a map_snapshot, an immutable view of the map with
+	the const interface of ft::map. It can be read, copied and
+	destroyed on any thread, while the map keeps changing on its own.
+	The map itself, like ft::map, is only safe to use from one thread
+	at a time.
+ * Values are never changed in place, as they may be shared:
+	insert_or_assign() puts a new value in a copy of the node, and
+	there is no operator[]. Iterators of the map are invalidated by
+	any change; iterators of a snapshot live as long as the snapshot.
+*************************************************************/
+
+namespace ft
+{
+	template <typename Key, typename T, typename Compare, typename Alloc>
+	class persistent_map;
+
+	/*************************************************************
+	 * The const interface, common to the map and its snapshots
+	 *************************************************************/
+	template <typename Key, typename T, typename Compare, typename Alloc>
+	class persistent_map_base
+	{
+
+	public:
+		/*************************************************************
+		 * Types
+		 *************************************************************/
+		typedef Key										key_type;
+		typedef T										mapped_type;
+		typedef ft::pair<const key_type, mapped_type>	value_type;
+		typedef Compare									key_compare;
+		typedef Alloc 									allocator_type;
+
+		/*************************************************************
+		 * value_compare
+		 * In C++98, it is required to inherit binary_function<value_type,value_type,bool>
+		 *************************************************************/
+		class value_compare : public std::binary_function<value_type, value_type, bool>
+		{
+			friend class persistent_map_base;
+
+		protected:
+			Compare comp;
+			// constructed with map's comparison object
+			value_compare(Compare c) : comp(c) {}
+
+		public:
+			typedef bool result_type;
+			typedef value_type first_argument_type;
+			typedef value_type second_argument_type;
+
+			bool operator()(const value_type &x, const value_type &y) const
+			{ return comp(x.first, y.first); }
+		};
+
+		typedef typename __gnu_cxx::__alloc_traits<Alloc>::template rebind<value_type>
+			::other							pair_alloc_type;
+
+		typedef persistent_rb_tree<key_type, value_type, std::_Select1st<value_type>,
+			key_compare, pair_alloc_type>	rep_type;
+
+		typedef __gnu_cxx::__alloc_traits<pair_alloc_type>	alloc_traits;
+
+		typedef typename alloc_traits::const_pointer			pointer;
+		typedef typename alloc_traits::const_pointer			const_pointer;
+		typedef typename alloc_traits::const_reference			reference;
+		typedef typename alloc_traits::const_reference			const_reference;
+		typedef typename rep_type::const_iterator				iterator;
+		typedef typename rep_type::const_iterator				const_iterator;
+		typedef typename rep_type::size_type					size_type;
+		typedef typename rep_type::difference_type				difference_type;
+		typedef typename rep_type::const_reverse_iterator		reverse_iterator;
+		typedef typename rep_type::const_reverse_iterator		const_reverse_iterator;
+
+		/*************************************************************
+		 *  Get a copy of the memory allocation object
+		 *************************************************************/
+		allocator_type get_allocator() const
+		{ return allocator_type(_t.get_allocator()); }
+
+		/*************************************************************
+		 * Iterators
+		 *************************************************************/
+		// Iteration is done in ascending order according to the keys.
+		const_iterator begin() const { return _t.begin(); }
+
+		const_iterator end() const { return _t.end(); }
+
+		const_reverse_iterator rbegin() const { return _t.rbegin(); }
+
+		const_reverse_iterator rend() const { return _t.rend(); }
+
+		/*************************************************************
+		 * Capacity
+		 *************************************************************/
+		bool empty() const { return _t.empty(); }
+
+		size_type size() const { return _t.size(); }
+
+		size_type max_size() const { return _t.max_size(); }
+
+		/*************************************************************
+		 * Element access
+		 *************************************************************/
+		// std::out_of_range  If no such data is present.
+		const mapped_type &at(const key_type &k) const
+		{
+			const_iterator i = find(k);
+
+			if (i == end())
+				std::__throw_out_of_range(__N("persistent_map::at"));
+			return (*i).second;
+		}
+
+		/*************************************************************
+		 * Observers
+		 *************************************************************/
+		key_compare key_comp() const { return _t.key_comp(); }
+
+		value_compare value_comp() const { return value_compare(_t.key_comp()); }
+
+		/*************************************************************
+		 * Map operations
+		 *************************************************************/
+		const_iterator find(const key_type &k) const { return _t.find(k); }
+
+		size_type count(const key_type &k) const { return _t.count(k); }
+
+		const_iterator lower_bound(const key_type &k) const { return _t.lower_bound(k); }
+
+		const_iterator upper_bound(const key_type &k) const { return _t.upper_bound(k); }
+
+		ft::pair<const_iterator, const_iterator> equal_range(const key_type &k) const
+		{ return _t.equal_range(k); }
+
+	protected:
+		persistent_map_base() : _t() {}
+
+		persistent_map_base(const Compare &comp, const allocator_type &alloc)
+			: _t(comp, pair_alloc_type(alloc)) {}
+
+		explicit persistent_map_base(const rep_type &t) : _t(t) {}
+
+		rep_type _t;
+
+	}; // persistent_map_base
+
+	/*************************************************************
+	 * map_snapshot
+	 *************************************************************/
+	template <typename Key, typename T, typename Compare = std::less<Key>,
+			  typename Alloc = std::allocator<ft::pair<const Key, T> > >
+	class map_snapshot : public persistent_map_base<Key, T, Compare, Alloc>
+	{
+		typedef persistent_map_base<Key, T, Compare, Alloc>	base;
+
+		friend class persistent_map<Key, T, Compare, Alloc>;
+
+	public:
+		// An empty map
+		map_snapshot() : base() {}
+
+		void swap(map_snapshot &x) { this->_t.swap(x._t); }
+
+	private:
+		explicit map_snapshot(const typename base::rep_type &t) : base(t) {}
+
+	}; // map_snapshot
+
+	/*************************************************************
+	 * persistent_map
+	 *************************************************************/
+	template <typename Key, typename T, typename Compare = std::less<Key>,
+			  typename Alloc = std::allocator<ft::pair<const Key, T> > >
+	class persistent_map : public persistent_map_base<Key, T, Compare, Alloc>
+	{
+		typedef persistent_map_base<Key, T, Compare, Alloc>	base;
+
+	public:
+		typedef typename base::key_type			key_type;
+		typedef typename base::mapped_type		mapped_type;
+		typedef typename base::value_type		value_type;
+		typedef typename base::key_compare		key_compare;
+		typedef typename base::allocator_type	allocator_type;
+		typedef typename base::const_iterator	iterator;
+		typedef typename base::const_iterator	const_iterator;
+		typedef typename base::size_type		size_type;
+
+		typedef map_snapshot<Key, T, Compare, Alloc>	snapshot_type;
+
+		/*************************************************************
+		 * Construct/Copy/Destroy
+		 *************************************************************/
+		// Default constructor creates no elements
+		persistent_map() : base() {}
+
+		explicit persistent_map(const key_compare &comp,
+								const allocator_type &alloc = allocator_type())
+			: base(comp, alloc) {}
+
+		// Copying shares all the nodes, in O(1)
+		persistent_map(const persistent_map &x) : base(x._t) {}
+
+		// The first of several equivalent keys is kept
+		template <typename InputIterator>
+		persistent_map(InputIterator first, InputIterator last,
+					   const Compare &comp = Compare(),
+					   const allocator_type &alloc = allocator_type())
+			: base(comp, alloc)
+		{ this->_t.insert_range_unique(first, last); }
+
+		// A map with the content of s, sharing its nodes
+		explicit persistent_map(const snapshot_type &s) : base(s._t) {}
+
+		/*************************************************************
+		 *  Assignment operator
+		 *************************************************************/
+		persistent_map &operator=(const persistent_map &x)
+		{ this->_t = x._t; return *this; }
+
+		/*************************************************************
+		 * Snapshot
+		 *************************************************************/
+		// The content of the map as it is now, in O(1)
+		snapshot_type snapshot() const { return snapshot_type(this->_t); }
+
+		/*************************************************************
+		 * Modifiers
+		 *************************************************************/
+		// Attempts to insert a ft::pair into the map: the bool is false,
+		// and the iterator points to the pair with the same key, if the
+		// key was already there.
+		ft::pair<iterator, bool> insert(const value_type &x)
+		{ return this->_t.insert_unique(x); }
+
+		// All or none of the range is inserted
+		template <typename InputIterator>
+		void insert(InputIterator first, InputIterator last)
+		{ this->_t.insert_range_unique(first, last); }
+
+		ft::pair<iterator, bool> insert_or_assign(const key_type &k, const mapped_type &obj)
+		{ return this->_t.assign_unique(value_type(k, obj)); }
+
+		size_type erase(const key_type &k) { return this->_t.erase_unique(k); }
+
+		void erase(const_iterator position) { this->_t.erase_unique((*position).first); }
+
+		void swap(persistent_map &x) { this->_t.swap(x._t); }
+
+		void clear() { this->_t.clear(); }
+
+	}; // persistent_map
+
+	template <typename Key, typename T, typename Compare, typename Alloc>
+	void swap(persistent_map<Key, T, Compare, Alloc> &x,
+			  persistent_map<Key, T, Compare, Alloc> &y)
+	{ x.swap(y); }
+
+	template <typename Key, typename T, typename Compare, typename Alloc>
+	void swap(map_snapshot<Key, T, Compare, Alloc> &x,
+			  map_snapshot<Key, T, Compare, Alloc> &y)
+	{ x.swap(y); }
+
+} // namespace ft
+
+#endif /* _FT_PERSISTENT_MAP_HPP */
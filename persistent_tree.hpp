@@ -0,0 +1,701 @@
+#ifndef _FT_PERSISTENT_TREE_HPP
+#define _FT_PERSISTENT_TREE_HPP
+
+#include <memory>
+
+#include "algorithm.hpp"
+#include "atomic.hpp"
+#include "iterator.hpp"
+#include "pool_allocator.hpp"
+#include "utility.hpp"
+
+/*************************************************************
+ * A persistent red-black tree
+
+ * Designed for use in implementing persistent_map and rcu_map.
+
+ * Nodes are shared between the trees copied from one another, and
+	never change once they are shared: copying a tree, or taking a
+	snapshot of it, only adds a reference to its root, in O(1).
+ * An insertion or an erasure copies the nodes it changes, on the
+	path from the root to the key and next to it, and leaves the old
+	nodes to the other trees that hold them. Each node counts the
+	trees and nodes that point to it, atomically, so that trees
+	sharing nodes may live on different threads; the last one to let
+	go of a node destroys it.
+ * The nodes have no parent pointer, which a shared node could not
+	have: the tree is a left-leaning red-black tree (Sedgewick), whose
+	insertion and erasure work from the root down, recursively. An
+	iterator keeps the path from the root to its node.
+ * Each change is built on new nodes, and the tree only moves to its
+	new root at the end: if anything throws, the tree is left as it
+	was. All the nodes made by the same change are marked with the
+	same epoch, unique across all trees, so that a change does not
+	copy its own nodes again. Iterators are invalidated by any change.
+ * A node is freed by whichever tree lets it go last, with that tree's
+	allocator: Alloc must not keep state, so pool_allocator is rejected
+	at compile time.
+*************************************************************/
+
+namespace ft
+{
+	template <typename Key, typename Val, typename KeyOfValue,
+			  typename Compare, typename Alloc = std::allocator<Val> >
+	class persistent_rb_tree
+	{
+
+		struct node
+		{
+			Val			value;
+			node		*left;
+			node		*right;
+			std::size_t	refs;	// Trees and nodes pointing here
+			std::size_t	epoch;	// Change that made the node
+			bool		red;	// Color of the link from the parent
+		};
+
+		typedef node		*link_type;
+		typedef const node	*const_link_type;
+
+		typedef typename Alloc::template rebind<node>::other	node_allocator;
+		typedef ft::is_pool_allocator<node_allocator>			pooled_nodes;
+
+	public:
+		typedef Key					key_type;
+		typedef Val					value_type;
+		typedef value_type 			*pointer;
+		typedef const value_type	*const_pointer;
+		typedef value_type			&reference;
+		typedef const value_type	&const_reference;
+		typedef std::size_t			size_type;
+		typedef std::ptrdiff_t		difference_type;
+		typedef Alloc				allocator_type;
+
+		/*************************************************************
+		 * Iterator
+
+		 * The path from the root down to the node, empty for end().
+			The height of a left-leaning red-black tree is at most
+			2 log2(n + 1). Values are shared, so there is only a const
+			iterator.
+		 *************************************************************/
+		class const_iterator
+		{
+
+		public:
+			typedef std::ptrdiff_t					difference_type;
+			typedef Val								value_type;
+			typedef const Val						*pointer;
+			typedef const Val						&reference;
+			typedef std::bidirectional_iterator_tag	iterator_category;
+
+			const_iterator() : _root(0), _depth(0) {}
+
+			reference operator*() const { return _path[_depth - 1]->value; }
+
+			pointer operator->() const { return &_path[_depth - 1]->value; }
+
+			const_iterator &operator++()
+			{
+				const_link_type x = _path[_depth - 1]->right;
+
+				if (x != 0)
+					push_leftmost(x);
+				else
+				{
+					// Up to the first ancestor whose left subtree we leave
+					do
+						x = _path[--_depth];
+					while (_depth > 0 && _path[_depth - 1]->right == x);
+				}
+				return *this;
+			}
+
+			const_iterator operator++(int)
+			{
+				const_iterator tmp = *this;
+				++*this;
+				return tmp;
+			}
+
+			const_iterator &operator--()
+			{
+				if (_depth == 0)
+					push_rightmost(_root);
+				else if (_path[_depth - 1]->left != 0)
+					push_rightmost(_path[_depth - 1]->left);
+				else
+				{
+					const_link_type x;
+
+					do
+						x = _path[--_depth];
+					while (_depth > 0 && _path[_depth - 1]->left == x);
+				}
+				return *this;
+			}
+
+			const_iterator operator--(int)
+			{
+				const_iterator tmp = *this;
+				--*this;
+				return tmp;
+			}
+
+			friend bool operator==(const const_iterator &x, const const_iterator &y)
+			{ return x.current() == y.current(); }
+
+			friend bool operator!=(const const_iterator &x, const const_iterator &y)
+			{ return x.current() != y.current(); }
+
+		private:
+			friend class persistent_rb_tree;
+
+			explicit const_iterator(const_link_type root) : _root(root), _depth(0) {}
+
+			const_link_type current() const
+			{ return _depth == 0 ? 0 : _path[_depth - 1]; }
+
+			void push_leftmost(const_link_type x)
+			{
+				for (; x != 0; x = x->left)
+					_path[_depth++] = x;
+			}
+
+			void push_rightmost(const_link_type x)
+			{
+				for (; x != 0; x = x->right)
+					_path[_depth++] = x;
+			}
+
+			const_link_type	_root;
+			const_link_type	_path[sizeof(std::size_t) * 16];
+			int				_depth;
+		}; // const_iterator
+
+		typedef const_iterator							iterator;
+		typedef ft::reverse_iterator<const_iterator>	const_reverse_iterator;
+		typedef const_reverse_iterator					reverse_iterator;
+
+		/*************************************************************
+		 * Construct/Copy/Destroy
+		 *************************************************************/
+		persistent_rb_tree() : _comp(), _alloc(), _root(0), _size(0), _epoch(0) {}
+
+		persistent_rb_tree(const Compare &comp, const allocator_type &a = allocator_type())
+			: _comp(comp), _alloc(a), _root(0), _size(0), _epoch(0) {}
+
+		// Shares the nodes of x
+		persistent_rb_tree(const persistent_rb_tree &x)
+			: _comp(x._comp), _alloc(x._alloc), _root(x._root), _size(x._size),
+			  _epoch(0)
+		{ retain(_root); }
+
+		~persistent_rb_tree() { release(_root); }
+
+		persistent_rb_tree &operator=(const persistent_rb_tree &x)
+		{
+			retain(x._root);
+			release(_root);
+			_comp = x._comp;
+			_alloc = x._alloc;
+			_root = x._root;
+			_size = x._size;
+			return *this;
+		}
+
+		// Accessors.
+		Compare key_comp() const { return _comp; }
+
+		allocator_type get_allocator() const { return allocator_type(_alloc); }
+
+		const_iterator begin() const
+		{
+			const_iterator it(_root);
+
+			it.push_leftmost(_root);
+			return it;
+		}
+
+		const_iterator end() const { return const_iterator(_root); }
+
+		const_reverse_iterator rbegin() const { return const_reverse_iterator(end()); }
+
+		const_reverse_iterator rend() const { return const_reverse_iterator(begin()); }
+
+		bool empty() const { return _size == 0; }
+
+		size_type size() const { return _size; }
+
+		size_type max_size() const { return _alloc.max_size(); }
+
+		void swap(persistent_rb_tree &t)
+		{
+			ft::swap(_comp, t._comp);
+			ft::swap(_alloc, t._alloc);
+			ft::swap(_root, t._root);
+			ft::swap(_size, t._size);
+		}
+
+		void clear()
+		{
+			release(_root);
+			_root = 0;
+			_size = 0;
+		}
+
+		/*************************************************************
+		 * Lookup
+		 *************************************************************/
+		const_iterator lower_bound(const key_type &k) const { return bound(k, false); }
+
+		const_iterator upper_bound(const key_type &k) const { return bound(k, true); }
+
+		const_iterator find(const key_type &k) const
+		{
+			const_iterator it = lower_bound(k);
+
+			if (it == end() || _comp(k, key(it.current())))
+				return end();
+			return it;
+		}
+
+		size_type count(const key_type &k) const { return find_node(k) != 0; }
+
+		pair<const_iterator, const_iterator> equal_range(const key_type &k) const
+		{ return pair<const_iterator, const_iterator>(lower_bound(k), upper_bound(k)); }
+
+		// Lookups that build no iterator: the value, or 0 if there is none
+		const value_type *find_value(const key_type &k) const
+		{
+			const_link_type x = find_node(k);
+
+			return x != 0 ? &x->value : 0;
+		}
+
+		const value_type *lower_bound_value(const key_type &k) const
+		{
+			const_link_type y = 0;
+
+			for (const_link_type x = _root; x != 0;)
+				if (!_comp(key(x), k))
+				{
+					y = x;
+					x = x->left;
+				}
+				else
+					x = x->right;
+			return y != 0 ? &y->value : 0;
+		}
+
+		/*************************************************************
+		 * Changes
+		 *************************************************************/
+		pair<const_iterator, bool> insert_unique(const value_type &v)
+		{
+			const key_type &k = KeyOfValue()(v);
+
+			if (find_node(k) != 0)
+				return pair<const_iterator, bool>(lower_bound(k), false);
+
+			link_type root = begin_change();
+
+			try
+			{ insert_root(root, v); }
+			catch (...)
+			{ release(root); throw; }
+			commit(root, _size + 1);
+			return pair<const_iterator, bool>(lower_bound(k), true);
+		}
+
+		// All the values are inserted by a single change: the nodes it
+		// makes are only copied once, and nothing is inserted if one of
+		// the insertions throws.
+		template <typename _InputIterator>
+		void insert_range_unique(_InputIterator first, _InputIterator last)
+		{
+			if (first == last)
+				return;
+
+			link_type root = begin_change();
+			size_type n = _size;
+
+			try
+			{
+				for (; first != last; ++first)
+					if (find_node(root, KeyOfValue()(*first)) == 0)
+					{
+						insert_root(root, *first);
+						++n;
+					}
+			}
+			catch (...)
+			{ release(root); throw; }
+			commit(root, n);
+		}
+
+		// Inserts v, or replaces the value with the same key by v
+		pair<const_iterator, bool> assign_unique(const value_type &v)
+		{
+			const key_type &k = KeyOfValue()(v);
+
+			if (find_node(k) == 0)
+				return insert_unique(v);
+
+			link_type root = begin_change();
+
+			try
+			{
+				link_type *x = &root;
+
+				while (_comp(k, key(*x)) || _comp(key(*x), k))
+				{
+					x = _comp(k, key(*x)) ? &(*x)->left : &(*x)->right;
+					*x = own(*x);
+				}
+				replace(*x, v);
+			}
+			catch (...)
+			{ release(root); throw; }
+			commit(root, _size);
+			return pair<const_iterator, bool>(lower_bound(k), false);
+		}
+
+		size_type erase_unique(const key_type &k)
+		{
+			if (find_node(k) == 0)
+				return 0;
+
+			link_type root = begin_change();
+
+			try
+			{
+				if (!is_red(root->left) && !is_red(root->right))
+					root->red = true;
+				erase(root, k);
+				if (root != 0)
+					root->red = false;
+			}
+			catch (...)
+			{ release(root); throw; }
+			commit(root, _size - 1);
+			return 1;
+		}
+
+	private:
+		static const key_type &key(const_link_type x)
+		{ return KeyOfValue()(x->value); }
+
+		static bool is_red(const_link_type x) { return x != 0 && x->red; }
+
+		const_iterator bound(const key_type &k, bool upper) const
+		{
+			const_iterator it(_root);
+			int keep = 0;
+
+			for (const_link_type x = _root; x != 0;)
+			{
+				it._path[it._depth++] = x;
+				if (upper ? _comp(k, key(x)) : !_comp(key(x), k))
+				{
+					keep = it._depth;
+					x = x->left;
+				}
+				else
+					x = x->right;
+			}
+			it._depth = keep;
+			return it;
+		}
+
+		const_link_type find_node(const key_type &k) const { return find_node(_root, k); }
+
+		const_link_type find_node(const_link_type x, const key_type &k) const
+		{
+			while (x != 0)
+			{
+				if (_comp(k, key(x)))
+					x = x->left;
+				else if (_comp(key(x), k))
+					x = x->right;
+				else
+					return x;
+			}
+			return 0;
+		}
+
+		/*************************************************************
+		 * Nodes
+		 *************************************************************/
+		// A node may be freed by another tree than the one that made it,
+		// which a pool_allocator cannot do: its slabs belong to one tree
+		link_type create_node(const value_type &v)
+		{
+			typedef char pooled_nodes_cannot_be_shared[pooled_nodes::value ? -1 : 1];
+
+			(void)sizeof(pooled_nodes_cannot_be_shared);
+
+			link_type n = _alloc.allocate(1);
+
+			try
+			{ get_allocator().construct(&n->value, v); }
+			catch (...)
+			{ _alloc.deallocate(n, 1); throw; }
+			n->left = 0;
+			n->right = 0;
+			n->refs = 1;
+			n->epoch = _epoch;
+			n->red = true;
+			return n;
+		}
+
+		// A node of this change, with the color and the children of x
+		// and the value v
+		link_type copy_node(const_link_type x, const value_type &v)
+		{
+			link_type n = create_node(v);
+
+			n->left = x->left;
+			n->right = x->right;
+			n->red = x->red;
+			retain(n->left);
+			retain(n->right);
+			return n;
+		}
+
+		static void retain(link_type x)
+		{
+			if (x != 0)
+				ft::atomic_fetch_add(&x->refs, std::size_t(1));
+		}
+
+		void release(link_type x)
+		{
+			while (x != 0 && ft::atomic_fetch_sub(&x->refs, std::size_t(1)) == 1)
+			{
+				link_type r = x->right;
+
+				release(x->left);
+				get_allocator().destroy(&x->value);
+				_alloc.deallocate(x, 1);
+				x = r;
+			}
+		}
+
+		/*************************************************************
+		 * Changes
+
+		 * A change starts from a reference to the root, which it owns,
+			and works on nodes it owns: own(x) gives back x if it was made
+			by this change, and a copy of x otherwise, which takes the
+			place of the reference that pointed to x. The old nodes stay
+			in the old tree, which holds them until commit().
+		 *************************************************************/
+		static std::size_t next_epoch()
+		{
+			static std::size_t last = 0;
+
+			return ft::atomic_fetch_add(&last, std::size_t(1)) + 1;
+		}
+
+		link_type begin_change()
+		{
+			_epoch = next_epoch();
+			return _root == 0 ? 0 : copy_node(_root, _root->value);
+		}
+
+		void commit(link_type root, size_type n)
+		{
+			link_type old = _root;
+
+			_root = root;
+			_size = n;
+			release(old);
+		}
+
+		link_type own(link_type x)
+		{
+			if (x->epoch == _epoch)
+				return x;
+
+			link_type n = copy_node(x, x->value);
+
+			release(x);
+			return n;
+		}
+
+		void replace(link_type &x, const value_type &v)
+		{
+			link_type n = copy_node(x, v);
+
+			release(x);
+			x = n;
+		}
+
+		// Each of these works on a subtree whose root h belongs to the
+		// change, and links its new root to the same reference.
+		void rotate_left(link_type &h)
+		{
+			h->right = own(h->right);
+
+			link_type x = h->right;
+
+			h->right = x->left;
+			x->left = h;
+			x->red = h->red;
+			h->red = true;
+			h = x;
+		}
+
+		void rotate_right(link_type &h)
+		{
+			h->left = own(h->left);
+
+			link_type x = h->left;
+
+			h->left = x->right;
+			x->right = h;
+			x->red = h->red;
+			h->red = true;
+			h = x;
+		}
+
+		void flip_colors(link_type h)
+		{
+			h->left = own(h->left);
+			h->right = own(h->right);
+			h->red = !h->red;
+			h->left->red = !h->left->red;
+			h->right->red = !h->right->red;
+		}
+
+		// Restores the invariants on the way up: red links lean left,
+		// and no node has two red links
+		void balance(link_type &h)
+		{
+			if (is_red(h->right) && !is_red(h->left))
+				rotate_left(h);
+			if (is_red(h->left) && is_red(h->left->left))
+				rotate_right(h);
+			if (is_red(h->left) && is_red(h->right))
+				flip_colors(h);
+		}
+
+		// Makes h->left or one of its children red, on the way down
+		void move_red_left(link_type &h)
+		{
+			flip_colors(h);
+			if (is_red(h->right->left))
+			{
+				rotate_right(h->right);
+				rotate_left(h);
+				flip_colors(h);
+			}
+		}
+
+		void move_red_right(link_type &h)
+		{
+			flip_colors(h);
+			if (is_red(h->left->left))
+			{
+				rotate_right(h);
+				flip_colors(h);
+			}
+		}
+
+		void insert_root(link_type &root, const value_type &v)
+		{
+			if (root == 0)
+				root = create_node(v);
+			else
+				insert(root, v);
+			root->red = false;
+		}
+
+		// The key of v is not in the tree
+		void insert(link_type &h, const value_type &v)
+		{
+			link_type &child = _comp(KeyOfValue()(v), key(h)) ? h->left : h->right;
+
+			if (child == 0)
+				child = create_node(v);
+			else
+			{
+				child = own(child);
+				insert(child, v);
+			}
+			balance(h);
+		}
+
+		// k is in the subtree
+		void erase(link_type &h, const key_type &k)
+		{
+			if (_comp(k, key(h)))
+			{
+				if (!is_red(h->left) && !is_red(h->left->left))
+					move_red_left(h);
+				h->left = own(h->left);
+				erase(h->left, k);
+			}
+			else
+			{
+				if (is_red(h->left))
+					rotate_right(h);
+				if (!_comp(key(h), k) && h->right == 0)
+				{
+					release(h);
+					h = 0;
+					return;
+				}
+				if (!is_red(h->right) && !is_red(h->right->left))
+					move_red_right(h);
+				h->right = own(h->right);
+				if (!_comp(key(h), k))
+				{
+					// The next value takes the place of h
+					const_link_type next = h->right;
+
+					while (next->left != 0)
+						next = next->left;
+					replace(h, next->value);
+					erase_min(h->right);
+				}
+				else
+					erase(h->right, k);
+			}
+			balance(h);
+		}
+
+		void erase_min(link_type &h)
+		{
+			if (h->left == 0)
+			{
+				release(h);
+				h = 0;
+				return;
+			}
+			if (!is_red(h->left) && !is_red(h->left->left))
+				move_red_left(h);
+			h->left = own(h->left);
+			erase_min(h->left);
+			balance(h);
+		}
+
+		Compare			_comp;
+		node_allocator	_alloc;
+		link_type		_root;
+		size_type		_size;
+		std::size_t		_epoch;	// Of the change being made
+
+	}; // persistent_rb_tree class
+
+	template <typename _Key, typename _Val, typename _KeyOfValue,
+			  typename _Compare, typename _Alloc>
+	inline void
+	swap(persistent_rb_tree<_Key, _Val, _KeyOfValue, _Compare, _Alloc> &x,
+		 persistent_rb_tree<_Key, _Val, _KeyOfValue, _Compare, _Alloc> &y)
+	{ x.swap(y); }
+
+} // namespace ft
+
+#endif /* _FT_PERSISTENT_TREE_HPP */
@@ -0,0 +1,228 @@
+#ifndef _FT_POOL_ALLOCATOR_HPP
+#define _FT_POOL_ALLOCATOR_HPP
+
+#include <cstddef>
+#include <new>
+
+#include "type_traits.hpp"
+
+namespace ft
+{
+
+	/*************************************************************
+	 * pool_allocator
+
+	 * An allocator meant for node based containers (map, set), which
+		allocate their elements one at a time.
+
+	 * Single objects are carved out of slabs obtained from operator new.
+		Freed objects are kept in an intrusive free list and handed out
+		again before the slab is grown, so a container churning through
+		entries stops calling malloc/free once its pool is warm.
+		Slabs start small and double in size up to max_slab objects.
+		Requests for more than one object go straight to operator new.
+
+	 * Each allocator owns its pool: copies start with an empty pool, and
+		swapping two allocators swaps their pools. The memory is given back
+		when the allocator is destroyed, or in bulk through release().
+	*************************************************************/
+	template <typename T>
+	class pool_allocator
+	{
+
+	public:
+		/*************************************************************
+		 * Types
+		 *************************************************************/
+		typedef T				value_type;
+		typedef T				*pointer;
+		typedef const T			*const_pointer;
+		typedef T				&reference;
+		typedef const T			&const_reference;
+		typedef std::size_t		size_type;
+		typedef std::ptrdiff_t	difference_type;
+
+		template <typename U>
+		struct rebind { typedef pool_allocator<U> other; };
+
+		static const size_type	min_slab = 8;
+		static const size_type	max_slab = 1024;
+
+		/*************************************************************
+		 * Construct/Copy/Destroy
+		 *************************************************************/
+		pool_allocator() throw()
+			: _slabs(0), _free(0), _next(0), _end(0), _slab_size(min_slab) {}
+
+		// Pools are never shared: a copy starts empty
+		pool_allocator(const pool_allocator &) throw()
+			: _slabs(0), _free(0), _next(0), _end(0), _slab_size(min_slab) {}
+
+		template <typename U>
+		pool_allocator(const pool_allocator<U> &) throw()
+			: _slabs(0), _free(0), _next(0), _end(0), _slab_size(min_slab) {}
+
+		~pool_allocator() throw() { release(); }
+
+		// Keeps its own pool, which still holds the objects it handed out
+		pool_allocator &operator=(const pool_allocator &) { return *this; }
+
+		/*************************************************************
+		 * Member functions
+		 *************************************************************/
+		pointer address(reference x) const { return &x; }
+		const_pointer address(const_reference x) const { return &x; }
+
+		pointer allocate(size_type n, const void * = 0)
+		{
+			if (n != 1)
+				return static_cast<pointer>(::operator new(n * sizeof(T)));
+			if (_free)
+			{
+				chunk *c = _free;
+
+				_free = c->next;
+				return reinterpret_cast<pointer>(c);
+			}
+			if (_next == _end)
+				grow();
+			return reinterpret_cast<pointer>(_next++);
+		}
+
+		void deallocate(pointer p, size_type n)
+		{
+			if (n != 1)
+			{
+				::operator delete(p);
+				return;
+			}
+			chunk *c = reinterpret_cast<chunk *>(p);
+
+			c->next = _free;
+			_free = c;
+		}
+
+		size_type max_size() const throw()
+		{ return size_type(-1) / sizeof(T); }
+
+		void construct(pointer p, const T &val) { new (static_cast<void *>(p)) T(val); }
+
+		void destroy(pointer p) { p->~T(); }
+
+		// Gives every slab back to operator new at once.
+		// The objects allocated from the pool must have been destroyed,
+		// and must not be deallocated afterwards.
+		void release() throw()
+		{
+			while (_slabs)
+			{
+				slab *next = _slabs->next;
+
+				::operator delete(_slabs);
+				_slabs = next;
+			}
+			_free = 0;
+			_next = 0;
+			_end = 0;
+			_slab_size = min_slab;
+		}
+
+		void swap(pool_allocator &x) throw()
+		{
+			slab		*slabs = _slabs;
+			chunk		*free = _free;
+			chunk		*next = _next;
+			chunk		*end = _end;
+			size_type	slab_size = _slab_size;
+
+			_slabs = x._slabs; x._slabs = slabs;
+			_free = x._free; x._free = free;
+			_next = x._next; x._next = next;
+			_end = x._end; x._end = end;
+			_slab_size = x._slab_size; x._slab_size = slab_size;
+		}
+
+	private:
+		// Storage for one object, or a link in the free list once freed
+		union chunk
+		{
+			chunk		*next;
+			char		value[sizeof(T)];
+			long double	_align_ld;
+			long long	_align_ll;
+			void		*_align_ptr;
+		};
+
+		// Slabs are chained together; the header takes the first chunks
+		// of the slab so that the objects that follow stay aligned.
+		struct slab
+		{
+			slab		*next;
+		};
+
+		static const size_type	header_chunks
+			= (sizeof(slab) + sizeof(chunk) - 1) / sizeof(chunk);
+
+		slab		*_slabs;
+		chunk		*_free;		// Freed objects, ready to be reused
+		chunk		*_next;		// Never used objects of the newest slab
+		chunk		*_end;
+		size_type	_slab_size;	// Number of objects in the next slab
+
+		void grow()
+		{
+			chunk *raw = static_cast<chunk *>(
+				::operator new((header_chunks + _slab_size) * sizeof(chunk)));
+			slab *s = reinterpret_cast<slab *>(raw);
+
+			s->next = _slabs;
+			_slabs = s;
+			_next = raw + header_chunks;
+			_end = _next + _slab_size;
+			if (_slab_size < max_slab)
+				_slab_size *= 2;
+		}
+
+	}; // pool_allocator
+
+	template <typename T>
+	const typename pool_allocator<T>::size_type pool_allocator<T>::min_slab;
+
+	template <typename T>
+	const typename pool_allocator<T>::size_type pool_allocator<T>::max_slab;
+
+	template <typename T>
+	const typename pool_allocator<T>::size_type pool_allocator<T>::header_chunks;
+
+	/*************************************************************
+	 * Boolean operators
+
+	 * Memory can only be given back to the pool it comes from.
+	*************************************************************/
+	template <typename T, typename U>
+	bool operator==(const pool_allocator<T> &x, const pool_allocator<U> &y)
+	{ return static_cast<const void *>(&x) == static_cast<const void *>(&y); }
+
+	template <typename T, typename U>
+	bool operator!=(const pool_allocator<T> &x, const pool_allocator<U> &y)
+	{ return !(x == y); }
+
+	// See ft::pool_allocator::swap().
+	template <typename T>
+	void swap(pool_allocator<T> &x, pool_allocator<T> &y) { x.swap(y); }
+
+	/*************************************************************
+	 * is_pool_allocator
+
+	 * Tells containers that their nodes can be released in bulk
+		instead of being deallocated one by one.
+	*************************************************************/
+	template <typename Alloc>
+	struct is_pool_allocator : public ft::false_type {};
+
+	template <typename T>
+	struct is_pool_allocator<ft::pool_allocator<T> > : public ft::true_type {};
+
+} // namespace ft
+
+#endif /* _FT_POOL_ALLOCATOR_HPP */
@@ -0,0 +1,453 @@
+#ifndef _FT_PRIORITY_QUEUE_HPP
+# define _FT_PRIORITY_QUEUE_HPP
+
+# include <functional>
+# include <memory>
+
+# include "vector.hpp"
+
+/*************************************************************
+ * priority_queue and indexed_priority_queue
+
+ * Both are 4-ary heaps stored in an array: the children of the
+	element at i are at 4i + 1 to 4i + 4. A heap of n elements is
+	half as deep as a binary heap, and the four children of an
+	element are next to each other, usually on one cache line: a
+	pop compares more elements than in a binary heap, but touches
+	half as many lines.
+
+ * As with std::priority_queue, top() is the element that no other
+	element comes after: the largest one with std::less.
+*************************************************************/
+
+namespace ft {
+
+	namespace heap_detail {
+
+		enum { arity = 4 };
+
+		template <typename Size>
+		inline Size	parent(Size i) { return (i - 1) / arity; }
+
+		template <typename Size>
+		inline Size	first_child(Size i) { return i * arity + 1; }
+
+	} // namespace heap_detail
+
+	/*************************************************************
+	 * priority_queue
+
+	 * A container adaptor, as std::priority_queue, whose container
+		must give random access to its elements, and provide front(),
+		push_back() and pop_back(), as ft::vector and ft::deque do.
+	*************************************************************/
+	template < class T, class Container = ft::vector<T>,
+		class Compare = std::less<typename Container::value_type> >
+	class priority_queue
+	{
+		public:
+			/*************************************************************
+			 * Types
+			*************************************************************/
+			typedef typename Container::value_type		value_type;
+			typedef typename Container::size_type		size_type;
+			typedef typename Container::reference		reference;
+			typedef typename Container::const_reference	const_reference;
+			typedef Container							container_type;
+			typedef Compare								value_compare;
+
+
+		protected:
+
+			Container	c;
+			Compare		comp;
+
+
+		public:
+
+			/*************************************************************
+		 	* Construct/Copy/Destroy
+			*************************************************************/
+			// The elements of cntr are made into a heap, in linear time
+			explicit priority_queue(const Compare& x = Compare(),
+				const container_type& cntr = container_type())
+				: c(cntr), comp(x) { make_heap(); }
+
+			// Adds the elements of [first, last) to those of cntr
+			template <class InputIterator>
+			priority_queue(InputIterator first, InputIterator last,
+				const Compare& x = Compare(),
+				const container_type& cntr = container_type())
+				: c(cntr), comp(x)
+			{
+				for (; first != last; ++first)
+					c.push_back(*first);
+				make_heap();
+			}
+
+			~priority_queue() {}
+
+			/*************************************************************
+			 * Member functions
+			*************************************************************/
+			bool		empty() const { return c.empty(); }
+
+			size_type	size() const { return c.size(); }
+
+			const_reference	top() const { return c.front(); }
+
+			void	push(const value_type& x)
+			{
+				c.push_back(x);
+				sift_up(c.size() - 1, x);
+			}
+
+			// The hole left by the top goes down to a leaf, then the last
+			// element goes up from there: it comes from the bottom, and
+			// seldom goes far, which saves comparing it on the way down.
+			void	pop()
+			{
+				const value_type x = c.back();
+
+				c.pop_back();
+				if (!c.empty())
+					sift_up(hole_to_leaf(0), x);
+			}
+
+		private:
+
+			// Moves the parents of the hole at i down while x comes after
+			// them, then puts x in the hole
+			void	sift_up(size_type i, const value_type& x)
+			{
+				while (i > 0)
+				{
+					const size_type p = heap_detail::parent(i);
+
+					if (!comp(c[p], x))
+						break;
+					c[i] = c[p];
+					i = p;
+				}
+				c[i] = x;
+			}
+
+			// Moves the largest child of the hole at i up while it comes
+			// after x, then puts x in the hole
+			void	sift_down(size_type i, const value_type& x)
+			{
+				const size_type n = c.size();
+
+				for (;;)
+				{
+					size_type child = heap_detail::first_child(i);
+
+					if (child >= n)
+						break;
+
+					const size_type last = n - child > size_type(heap_detail::arity)
+						? child + heap_detail::arity : n;
+
+					for (size_type j = child + 1; j < last; ++j)
+						if (comp(c[child], c[j]))
+							child = j;
+					if (!comp(x, c[child]))
+						break;
+					c[i] = c[child];
+					i = child;
+				}
+				c[i] = x;
+			}
+
+			// Moves the largest child of the hole at i up, down to a leaf,
+			// and returns the position of the hole
+			size_type	hole_to_leaf(size_type i)
+			{
+				const size_type n = c.size();
+
+				for (;;)
+				{
+					size_type child = heap_detail::first_child(i);
+
+					if (child >= n)
+						return i;
+
+					const size_type last = n - child > size_type(heap_detail::arity)
+						? child + heap_detail::arity : n;
+
+					for (size_type j = child + 1; j < last; ++j)
+						if (comp(c[child], c[j]))
+							child = j;
+					c[i] = c[child];
+					i = child;
+				}
+			}
+
+			// From the last parent up to the root
+			void	make_heap()
+			{
+				const size_type n = c.size();
+
+				if (n < 2)
+					return;
+				for (size_type i = heap_detail::parent(n - 1) + 1; i-- > 0;)
+				{
+					const value_type x = c[i];
+
+					sift_down(i, x);
+				}
+			}
+
+	}; // priority_queue
+
+
+	/*************************************************************
+	 * indexed_priority_queue
+
+	 * A 4-ary heap whose elements keep a handle from push() until they
+		are popped or erased, whatever their moves in the heap: the
+		value of an element can be changed through its handle, and the
+		element erased.
+	 * The heap holds the values themselves, each with its handle, so
+		that the comparisons read contiguous memory. A table indexed by
+		handle gives the position of each element in the heap. The
+		handles of the elements that leave the heap are reused.
+	 * decrease_key() is named after min-heaps (Compare = std::greater),
+		as in Dijkstra's algorithm: it moves an element towards the top.
+		update() moves it either way.
+	*************************************************************/
+	template < class T, class Compare = std::less<T>,
+		class Alloc = std::allocator<T> >
+	class indexed_priority_queue
+	{
+		public:
+			/*************************************************************
+			 * Types
+			*************************************************************/
+			typedef T							value_type;
+			typedef Compare						value_compare;
+			typedef Alloc						allocator_type;
+			typedef typename Alloc::size_type	size_type;
+			typedef typename Alloc::size_type	handle_type;
+
+
+		private:
+
+			struct entry
+			{
+				entry(const value_type& v, handle_type h) : value(v), handle(h) {}
+
+				value_type	value;
+				handle_type	handle;
+			};
+
+			typedef typename Alloc::template rebind<entry>::other		entry_allocator;
+			typedef typename Alloc::template rebind<size_type>::other	size_allocator;
+
+			// The position of a handle that is not in the heap
+			static size_type	npos() { return size_type(-1); }
+
+			ft::vector<entry, entry_allocator>		_heap;
+			// Position in _heap of each handle
+			ft::vector<size_type, size_allocator>	_pos;
+			// Handles that are not in use
+			ft::vector<handle_type, size_allocator>	_free;
+			Compare									_comp;
+
+
+		public:
+
+			/*************************************************************
+		 	* Construct/Copy/Destroy
+			*************************************************************/
+			explicit indexed_priority_queue(const Compare& x = Compare(),
+				const allocator_type& alloc = allocator_type())
+				: _heap(entry_allocator(alloc)), _pos(size_allocator(alloc)),
+				_free(size_allocator(alloc)), _comp(x) {}
+
+			~indexed_priority_queue() {}
+
+			/*************************************************************
+			 * Capacity
+			*************************************************************/
+			bool		empty() const { return _heap.empty(); }
+
+			size_type	size() const { return _heap.size(); }
+
+			// Room for n elements, and as many handles
+			void		reserve(size_type n)
+			{
+				_heap.reserve(n);
+				_pos.reserve(n);
+			}
+
+			/*************************************************************
+			 * Element access
+			*************************************************************/
+			const value_type&	top() const { return _heap.front().value; }
+
+			handle_type			top_handle() const { return _heap.front().handle; }
+
+			// True while the element of h is in the queue
+			bool				contains(handle_type h) const
+			{ return h < _pos.size() && _pos[h] != npos(); }
+
+			// The value of the element of h, which must be in the queue
+			const value_type&	get(handle_type h) const
+			{ return _heap[_pos[h]].value; }
+
+			/*************************************************************
+			 * Modifiers
+			*************************************************************/
+			// Returns the handle of the new element
+			handle_type	push(const value_type& x)
+			{
+				handle_type h;
+
+				_heap.push_back(entry(x, 0));
+				if (_free.empty())
+				{
+					try
+					{ _pos.push_back(npos()); }
+					catch (...)
+					{ _heap.pop_back(); throw; }
+					h = _pos.size() - 1;
+				}
+				else
+				{
+					h = _free.back();
+					_free.pop_back();
+				}
+				sift_up(_heap.size() - 1, entry(x, h));
+				return h;
+			}
+
+			// As priority_queue::pop()
+			void		pop()
+			{
+				const entry last = _heap.back();
+
+				release(top_handle());
+				_heap.pop_back();
+				if (!_heap.empty())
+					sift_up(hole_to_leaf(0), last);
+			}
+
+			// Removes the element of h, whose handle may then be reused
+			void		erase(handle_type h)
+			{
+				const size_type i = _pos[h];
+				const entry last = _heap.back();
+
+				release(h);
+				_heap.pop_back();
+				if (i < _heap.size())
+					restore(i, last);
+			}
+
+			// Gives the element of h the value x, which must not come
+			// after its current value: the element can only go up.
+			void		decrease_key(handle_type h, const value_type& x)
+			{ sift_up(_pos[h], entry(x, h)); }
+
+			// Gives the element of h the value x, anywhere in the order
+			void		update(handle_type h, const value_type& x)
+			{ restore(_pos[h], entry(x, h)); }
+
+			// Removes all the elements, and frees all the handles
+			void		clear()
+			{
+				_heap.clear();
+				_pos.clear();
+				_free.clear();
+			}
+
+		private:
+
+			void	release(handle_type h)
+			{
+				_free.push_back(h);
+				_pos[h] = npos();
+			}
+
+			void	place(size_type i, const entry& e)
+			{
+				_heap[i] = e;
+				_pos[e.handle] = i;
+			}
+
+			// Puts e in the hole at i, going up or down as needed
+			void	restore(size_type i, const entry& e)
+			{
+				if (i > 0 && _comp(_heap[heap_detail::parent(i)].value, e.value))
+					sift_up(i, e);
+				else
+					sift_down(i, e);
+			}
+
+			void	sift_up(size_type i, const entry& e)
+			{
+				while (i > 0)
+				{
+					const size_type p = heap_detail::parent(i);
+
+					if (!_comp(_heap[p].value, e.value))
+						break;
+					place(i, _heap[p]);
+					i = p;
+				}
+				place(i, e);
+			}
+
+			void	sift_down(size_type i, const entry& e)
+			{
+				const size_type n = _heap.size();
+
+				for (;;)
+				{
+					size_type child = heap_detail::first_child(i);
+
+					if (child >= n)
+						break;
+
+					const size_type last = n - child > size_type(heap_detail::arity)
+						? child + heap_detail::arity : n;
+
+					for (size_type j = child + 1; j < last; ++j)
+						if (_comp(_heap[child].value, _heap[j].value))
+							child = j;
+					if (!_comp(e.value, _heap[child].value))
+						break;
+					place(i, _heap[child]);
+					i = child;
+				}
+				place(i, e);
+			}
+
+			size_type	hole_to_leaf(size_type i)
+			{
+				const size_type n = _heap.size();
+
+				for (;;)
+				{
+					size_type child = heap_detail::first_child(i);
+
+					if (child >= n)
+						return i;
+
+					const size_type last = n - child > size_type(heap_detail::arity)
+						? child + heap_detail::arity : n;
+
+					for (size_type j = child + 1; j < last; ++j)
+						if (_comp(_heap[child].value, _heap[j].value))
+							child = j;
+					place(i, _heap[child]);
+					i = child;
+				}
+			}
+
+	}; // indexed_priority_queue
+
+} // namespace ft
+
+#endif /* _FT_PRIORITY_QUEUE_HPP */
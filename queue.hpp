@@ -0,0 +1,110 @@
+#ifndef _FT_QUEUE_HPP
+# define _FT_QUEUE_HPP
+
+# include "deque.hpp"
+# include "priority_queue.hpp"
+
+namespace ft {
+
+	/*************************************************************
+	 * queue
+
+	 * queues are container adaptors, like stack, that give access
+		to their elements in first-in first-out order.
+
+	 * Elements are pushed into the "back" of the specific container,
+		and popped from its "front". The container must provide
+		front(), back(), push_back() and pop_front(), as ft::deque
+		and std::list do.
+
+	 * A queue is for a single thread: see spsc_queue.hpp to hand
+		elements from one thread to another.
+
+	 * As <queue>, this header also gives priority_queue, see
+		priority_queue.hpp.
+	*************************************************************/
+	template < class T, class Container = ft::deque<T> >
+	class queue
+	{
+		public:
+			/*************************************************************
+			 * Types
+			*************************************************************/
+			typedef typename Container::value_type		value_type;
+			typedef typename Container::size_type		size_type;
+			typedef typename Container::reference		reference;
+			typedef typename Container::const_reference	const_reference;
+			typedef Container							container_type;
+
+
+		protected:
+
+			Container c;
+
+
+		public:
+
+			/*************************************************************
+		 	* Construct/Copy/Destroy
+			*************************************************************/
+			explicit queue(const container_type& cntr = container_type())
+				: c(cntr) {}
+
+			~queue() {}
+
+			/*************************************************************
+			 * Member functions
+			*************************************************************/
+			bool		empty() const { return c.empty(); }
+
+			size_type	size() const { return c.size(); }
+
+			// The oldest element, which pop() removes
+			reference			front() { return c.front(); }
+
+			const_reference		front() const { return c.front(); }
+
+			// The newest element
+			reference			back() { return c.back(); }
+
+			const_reference		back() const { return c.back(); }
+
+			void	push(const value_type& x) { c.push_back(x); }
+
+			void	pop() { c.pop_front(); }
+
+			/*************************************************************
+			 * Boolean operators
+			*************************************************************/
+			friend bool operator==(const queue& x, const queue& y)
+			{ return x.c == y.c; }
+
+			friend bool operator< (const queue& x, const queue& y)
+			{ return x.c < y.c; }
+
+
+	}; // queue
+
+
+	/*************************************************************
+	 * Boolean operators for queue
+	*************************************************************/
+	template <class T, class Container>
+	bool operator!=(const queue<T, Container>& x, const queue<T, Container>& y)
+	{ return !(x == y); }
+
+	template <class T, class Container>
+	bool operator> (const queue<T, Container>& x, const queue<T, Container>& y)
+	{ return (y < x); }
+
+	template <class T, class Container>
+	bool operator>=(const queue<T, Container>& x, const queue<T, Container>& y)
+	{ return !(x < y); }
+
+	template <class T, class Container>
+	bool operator<=(const queue<T, Container>& x, const queue<T, Container>& y)
+	{ return !(y < x); }
+
+} // namespace ft
+
+#endif /* _FT_QUEUE_HPP */
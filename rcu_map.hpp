@@ -0,0 +1,409 @@
+#ifndef _FT_RCU_MAP_HPP
+#define _FT_RCU_MAP_HPP
+
+#include <functional>
+#include <memory>
+#include <new>
+#include <pthread.h>
+
+#include "atomic.hpp"
+#include "pool_allocator.hpp"
+#include "utility.hpp"
+#include "vector.hpp"
+#include "persistent_tree.hpp"
+
+/*************************************************************
+ * rcu_map
+
+ * A map for tables that are read all the time and seldom changed, by
+	many threads at once: lookups take no lock and never wait, in the
+	manner of read-copy-update.
+ * The map is a version of a persistent tree (see persistent_tree.hpp),
+	which never changes once it is published. A change copies the
+	current version, which shares all its nodes, changes the copy,
+	copying the O(log n) nodes on the way, and publishes it with a
+	release store. Changes are serialized by a mutex, and may be made
+	from any thread.
+ * Lookups go through a reader, one per thread: it tells the map which
+	epoch it read the current version in, looks up the key and copies
+	the value out. Its only stores are to its own cache line; it never
+	takes a lock nor touches a reference count.
+ * An old version is not destroyed when it is replaced, but retired
+	with the epoch of its replacement, and destroyed by a later change
+	once no reader can still be in it: once every reader is out, or
+	has read the current version in a later epoch.
+ * All readers must be destroyed before the map. C++98 has no
+	threads: this header uses POSIX threads, so programs that include
+	it must be built with -pthread. Alloc must not keep state:
+	pool_allocator is rejected at compile time.
+*************************************************************/
+
+namespace ft
+{
+	template <typename Key, typename T, typename Compare = std::less<Key>,
+			  typename Alloc = std::allocator<ft::pair<const Key, T> > >
+	class rcu_map
+	{
+
+	public:
+		/*************************************************************
+		 * Types
+		 *************************************************************/
+		typedef Key										key_type;
+		typedef T										mapped_type;
+		typedef ft::pair<const key_type, mapped_type>	value_type;
+		typedef Compare									key_compare;
+		typedef Alloc 									allocator_type;
+
+		typedef typename __gnu_cxx::__alloc_traits<Alloc>::template rebind<value_type>
+			::other							pair_alloc_type;
+
+		typedef persistent_rb_tree<key_type, value_type, std::_Select1st<value_type>,
+			key_compare, pair_alloc_type>	rep_type;
+
+		typedef typename rep_type::size_type	size_type;
+
+		class reader;
+
+	private:
+		// The epoch a reader is in, 0 when it is out
+		struct reader_slot
+		{
+			std::size_t	epoch;
+			bool		used;
+			reader_slot	*next;
+			// Keeps the slots of two readers out of the same cache line
+			char		pad[64];
+		};
+
+		// A version that readers may still be in
+		struct retired
+		{
+			retired(rep_type *v, std::size_t e) : version(v), epoch(e) {}
+
+			rep_type	*version;
+			std::size_t	epoch;
+		};
+
+		typedef typename Alloc::template rebind<rep_type>::other	version_allocator;
+		typedef typename Alloc::template rebind<reader_slot>::other	slot_allocator;
+		typedef ft::is_pool_allocator<version_allocator>			pooled;
+
+		class lock_guard
+		{
+		public:
+			explicit lock_guard(pthread_mutex_t &m) : _m(&m) { pthread_mutex_lock(_m); }
+
+			~lock_guard() { pthread_mutex_unlock(_m); }
+
+		private:
+			lock_guard(const lock_guard &);
+			lock_guard &operator=(const lock_guard &);
+
+			pthread_mutex_t	*_m;
+		};
+
+	public:
+		/*************************************************************
+		 * reader
+
+		 * Lookups in the map, from a single thread at a time. Each one
+			reads the version that is current when it starts, and is
+			wait-free.
+		 *************************************************************/
+		class reader
+		{
+
+		public:
+			explicit reader(rcu_map &m) : _map(&m), _slot(m.acquire_slot()) {}
+
+			~reader() { _map->release_slot(_slot); }
+
+			// Copies the mapped value of k into value, if k is there
+			bool find(const key_type &k, mapped_type &value) const
+			{
+				section s(*this);
+				const value_type *v = s.version->find_value(k);
+
+				if (v == 0)
+					return false;
+				value = v->second;
+				return true;
+			}
+
+			bool contains(const key_type &k) const
+			{
+				section s(*this);
+
+				return s.version->find_value(k) != 0;
+			}
+
+			// Copies the first element whose key is not less than k, if any
+			bool lower_bound(const key_type &k, key_type &key, mapped_type &value) const
+			{
+				section s(*this);
+				const value_type *v = s.version->lower_bound_value(k);
+
+				if (v == 0)
+					return false;
+				key = v->first;
+				value = v->second;
+				return true;
+			}
+
+			size_type size() const
+			{
+				section s(*this);
+
+				return s.version->size();
+			}
+
+		private:
+			reader(const reader &);
+			reader &operator=(const reader &);
+
+			// The time the reader is in the current version. The full fence
+			// orders the store of the epoch before the load of the version,
+			// against the opposite order in publish().
+			struct section
+			{
+				explicit section(const reader &r) : slot(r._slot)
+				{
+					ft::atomic_store(&slot->epoch, ft::atomic_load(&r._map->_epoch));
+					ft::atomic_thread_fence();
+					version = ft::atomic_load(&r._map->_current);
+				}
+
+				~section() { ft::atomic_store(&slot->epoch, std::size_t(0)); }
+
+				reader_slot		*slot;
+				const rep_type	*version;
+			};
+
+			rcu_map		*_map;
+			reader_slot	*_slot;
+
+		}; // reader
+
+		/*************************************************************
+		 * Construct/Destroy
+		 *************************************************************/
+		explicit rcu_map(const Compare &comp = Compare(),
+						 const allocator_type &alloc = allocator_type())
+			: _comp(comp), _alloc(alloc), _current(0), _epoch(1), _readers(0)
+		{
+			_current = create_version(rep_type(_comp, pair_alloc_type(_alloc)));
+			pthread_mutex_init(&_lock, 0);
+		}
+
+		~rcu_map()
+		{
+			slot_allocator a;
+
+			for (std::size_t i = 0; i < _retired.size(); ++i)
+				destroy_version(_retired[i].version);
+			destroy_version(_current);
+			while (_readers != 0)
+			{
+				reader_slot *next = _readers->next;
+
+				a.deallocate(_readers, 1);
+				_readers = next;
+			}
+			pthread_mutex_destroy(&_lock);
+		}
+
+		allocator_type get_allocator() const { return _alloc; }
+
+		key_compare key_comp() const { return _comp; }
+
+		/*************************************************************
+		 * Modifiers
+		 * Each one publishes a new version, if it changes the map.
+		 *************************************************************/
+		// False if the key was already there, which is left as it was
+		bool insert(const value_type &x)
+		{
+			lock_guard guard(_lock);
+			rep_type *v = create_version(*_current);
+
+			try
+			{
+				if (!v->insert_unique(x).second)
+				{
+					destroy_version(v);
+					return false;
+				}
+			}
+			catch (...)
+			{ destroy_version(v); throw; }
+			publish(v);
+			return true;
+		}
+
+		// A single version for the whole range
+		template <typename InputIterator>
+		void insert(InputIterator first, InputIterator last)
+		{
+			lock_guard guard(_lock);
+			rep_type *v = create_version(*_current);
+
+			try
+			{ v->insert_range_unique(first, last); }
+			catch (...)
+			{ destroy_version(v); throw; }
+			publish(v);
+		}
+
+		// True if the key was inserted, false if its value was assigned
+		bool insert_or_assign(const key_type &k, const mapped_type &obj)
+		{
+			lock_guard guard(_lock);
+			rep_type *v = create_version(*_current);
+			bool inserted;
+
+			try
+			{ inserted = v->assign_unique(value_type(k, obj)).second; }
+			catch (...)
+			{ destroy_version(v); throw; }
+			publish(v);
+			return inserted;
+		}
+
+		size_type erase(const key_type &k)
+		{
+			lock_guard guard(_lock);
+
+			if (_current->find_value(k) == 0)
+				return 0;
+
+			rep_type *v = create_version(*_current);
+
+			try
+			{ v->erase_unique(k); }
+			catch (...)
+			{ destroy_version(v); throw; }
+			publish(v);
+			return 1;
+		}
+
+		void clear()
+		{
+			lock_guard guard(_lock);
+
+			publish(create_version(rep_type(_comp, pair_alloc_type(_alloc))));
+		}
+
+		// Destroys the retired versions that no reader is in anymore
+		void reclaim()
+		{
+			lock_guard guard(_lock);
+
+			reclaim_retired();
+		}
+
+	private:
+		rcu_map(const rcu_map &);
+		rcu_map &operator=(const rcu_map &);
+
+		// Versions and reader slots are allocated and freed by allocators
+		// built on the spot, which a pool_allocator cannot do
+		rep_type *create_version(const rep_type &t)
+		{
+			typedef char pooled_versions_cannot_be_shared[pooled::value ? -1 : 1];
+
+			(void)sizeof(pooled_versions_cannot_be_shared);
+
+			version_allocator a;
+			rep_type *v = a.allocate(1);
+
+			try
+			{ new (v) rep_type(t); }
+			catch (...)
+			{ a.deallocate(v, 1); throw; }
+			return v;
+		}
+
+		static void destroy_version(rep_type *v)
+		{
+			version_allocator a;
+
+			v->~rep_type();
+			a.deallocate(v, 1);
+		}
+
+		// Readers that load the epoch after it moves on also see v; the
+		// others may still be in the old version, which is retired.
+		void publish(rep_type *v)
+		{
+			rep_type *old = _current;
+
+			try
+			{ _retired.reserve(_retired.size() + 1); }
+			catch (...)
+			{ destroy_version(v); throw; }
+			ft::atomic_store(&_current, v);
+			ft::atomic_thread_fence();
+			_retired.push_back(retired(old, ft::atomic_fetch_add(&_epoch, std::size_t(1))));
+			reclaim_retired();
+		}
+
+		// A version retired in epoch e is left by every reader that is out,
+		// or that entered after e
+		void reclaim_retired()
+		{
+			std::size_t oldest = std::size_t(-1);
+			std::size_t n = 0;
+
+			for (reader_slot *s = _readers; s != 0; s = s->next)
+			{
+				const std::size_t e = ft::atomic_load(&s->epoch);
+
+				if (e != 0 && e < oldest)
+					oldest = e;
+			}
+			while (n < _retired.size() && _retired[n].epoch < oldest)
+				destroy_version(_retired[n++].version);
+			_retired.erase(_retired.begin(), _retired.begin() + n);
+		}
+
+		reader_slot *acquire_slot()
+		{
+			lock_guard guard(_lock);
+			reader_slot *s = _readers;
+
+			while (s != 0 && s->used)
+				s = s->next;
+			if (s == 0)
+			{
+				slot_allocator a;
+
+				s = a.allocate(1);
+				s->epoch = 0;
+				s->next = _readers;
+				_readers = s;
+			}
+			s->used = true;
+			return s;
+		}
+
+		void release_slot(reader_slot *s)
+		{
+			lock_guard guard(_lock);
+
+			s->used = false;
+		}
+
+		key_compare				_comp;
+		allocator_type			_alloc;
+		rep_type				*_current;
+		std::size_t				_epoch;
+		pthread_mutex_t			_lock;
+		reader_slot				*_readers;
+		ft::vector<retired>		_retired;
+
+	}; // rcu_map
+
+} // namespace ft
+
+#endif /* _FT_RCU_MAP_HPP */
@@ -9,6 +9,7 @@
 # include "iterator.hpp"
 # include "utility.hpp"
 # include "tree.hpp"
+# include "node_handle.hpp"
 
 namespace ft {
 				
@@ -47,6 +48,8 @@ namespace ft {
 		typedef typename rep_type::difference_type			difference_type;
 		typedef typename rep_type::const_reverse_iterator	reverse_iterator;
 		typedef typename rep_type::const_reverse_iterator	const_reverse_iterator;
+		typedef ft::set_node_handle<Key, typename rep_type::node_allocator>	node_type;
+		typedef ft::node_insert_return<iterator, node_type>	insert_return_type;
 
 		/*************************************************************
 		 * Construct/Copy/Destroy
@@ -56,14 +59,16 @@ namespace ft {
 
 		explicit set(const Compare& comp,
 			const allocator_type& alloc = allocator_type())
-			: _t(comp), _Key_alloc_type(alloc) {}
+			: _t(comp, _Key_alloc_type(alloc)) {}
 
 		set(const set& x) : _t(x._t) {};
 		
 		// Builds a set from a range
 		// Create a set consisting of copies of the elements from
-    	// [first,last).  This is linear in N if the range is
-    	// already sorted, and NlogN otherwise (where N is distance(first,last)).
+    	// [first,last).  The tree is built in a single pass, linear in N,
+    	// as long as the range is sorted, and the elements that follow
+    	// the first one out of order are inserted in NlogN
+    	// (where N is distance(first,last)).
 		template <typename InputIterator>
 		set(InputIterator first, InputIterator last) : _t()
 		{ _t.insert_range_unique(first, last); }
@@ -74,6 +79,15 @@ namespace ft {
 			: _t(comp, allocator_type(alloc))
 		{ _t.insert_range_unique(first, last); }
 
+		// Builds a set from a range already sorted, without duplicates:
+		// the keys are not compared at all.
+		template <typename InputIterator>
+		set(ft::sorted_unique_t, InputIterator first, InputIterator last,
+			const Compare& comp = Compare(),
+			const allocator_type& alloc = allocator_type())
+			: _t(comp, _Key_alloc_type(alloc))
+		{ _t.insert_range_unique(ft::sorted_unique, first, last); }
+
 		/*************************************************************
 		 *  Assignment operator
 		*************************************************************/
@@ -161,6 +175,59 @@ namespace ft {
 		// Erases all elements in a set
 		void		clear() { _t.clear(); }
 
+		// Unlinks the element at position, or equal to x, from the set, and
+		// returns a handle that owns its node (empty if x is not found).
+		// The node is neither copied nor deallocated, so that it can be
+		// inserted into another set. Not available with pool_allocator,
+		// whose nodes cannot outlive the set.
+		node_type	extract(const_iterator position)
+		{ return node_type(_t.extract_node(position), _t.get_node_allocator()); }
+
+		node_type	extract(const key_type& x)
+		{
+			const_iterator i = find(x);
+
+			if (i == end())
+				return node_type();
+			return extract(i);
+		}
+
+		// Links the node of nh into the set, if its value is not there yet.
+		// Otherwise the node is handed back in the node of the result.
+		insert_return_type	insert(node_type nh)
+		{
+			insert_return_type ret;
+
+			ret.position = end();
+			ret.inserted = false;
+			if (nh.empty())
+				return ret;
+
+			ft::pair<typename rep_type::iterator, bool> res =
+			_t.reinsert_node_unique(nh._ptr);
+
+			ret.position = res.first;
+			ret.inserted = res.second;
+			if (res.second)
+				nh.release();
+			else
+				ret.node = nh;
+			return ret;
+		}
+
+		// Moves to this set the elements of source that are not in this
+		// set yet, relinking their nodes. The others stay in source.
+		void		merge(set& source) { _t.merge_unique(source._t); }
+
+		// Set algebra: makes this set the union, intersection or difference
+		// of itself and other, in O(m log(n/m + 1)) for sizes m <= n,
+		// instead of one insertion or lookup per element. The nodes are
+		// split and joined, not copied: this set keeps its own, and other
+		// is left empty, its nodes being moved into this set or destroyed.
+		void		union_with(set& other) { _t.union_unique(other._t); }
+		void		intersect_with(set& other) { _t.intersect_unique(other._t); }
+		void		difference_with(set& other) { _t.difference_unique(other._t); }
+
 		/*************************************************************
 		 * Map operations
 		*************************************************************/
@@ -199,6 +266,72 @@ namespace ft {
 		pair<const_iterator,const_iterator>	equal_range(const key_type& x) const
 		{ return _t.equal_range(x); }
 
+		// Transparent lookups, only when Compare declares is_transparent
+		// (as ft::less<> does): x may be of any type that Compare can
+		// compare to the elements, and is not converted to key_type.
+		template <typename K>
+		typename ft::enable_if<ft::has_is_transparent<Compare, K>::value,
+			iterator>::type
+						find(const K& x) { return _t.find(x); }
+
+		template <typename K>
+		typename ft::enable_if<ft::has_is_transparent<Compare, K>::value,
+			iterator>::type
+						find(const K& x) const { return _t.find(x); }
+
+		template <typename K>
+		typename ft::enable_if<ft::has_is_transparent<Compare, K>::value,
+			size_type>::type
+						count(const K& x) const { return _t.count(x); }
+
+		template <typename K>
+		typename ft::enable_if<ft::has_is_transparent<Compare, K>::value,
+			iterator>::type
+						lower_bound(const K& x) { return _t.lower_bound(x); }
+
+		template <typename K>
+		typename ft::enable_if<ft::has_is_transparent<Compare, K>::value,
+			iterator>::type
+						lower_bound(const K& x) const { return _t.lower_bound(x); }
+
+		template <typename K>
+		typename ft::enable_if<ft::has_is_transparent<Compare, K>::value,
+			iterator>::type
+						upper_bound(const K& x) { return _t.upper_bound(x); }
+
+		template <typename K>
+		typename ft::enable_if<ft::has_is_transparent<Compare, K>::value,
+			iterator>::type
+						upper_bound(const K& x) const { return _t.upper_bound(x); }
+
+		template <typename K>
+		typename ft::enable_if<ft::has_is_transparent<Compare, K>::value,
+			pair<iterator, iterator> >::type
+						equal_range(const K& x) { return _t.equal_range(x); }
+
+		template <typename K>
+		typename ft::enable_if<ft::has_is_transparent<Compare, K>::value,
+			pair<iterator, iterator> >::type
+						equal_range(const K& x) const { return _t.equal_range(x); }
+
+#ifdef FT_RB_TREE_ORDER_STATISTICS
+		/*************************************************************
+		 * Order statistics
+
+		 * Only with FT_RB_TREE_ORDER_STATISTICS, in logarithmic time.
+		*************************************************************/
+		// Return an iterator to the k-th smallest element, counting
+		// from 0, or end() if the set has no more than k elements.
+		iterator		select(size_type k) const { return _t.select(k); }
+
+		// Return the number of elements less than x.
+		size_type		rank(const key_type& x) const { return _t.rank(x); }
+
+		// Return the number of elements between first and last.
+		difference_type	distance(const_iterator first, const_iterator last) const
+		{ return _t.distance(first, last); }
+#endif
+
 		/*************************************************************
 		 *  Relational operators
 		*************************************************************/
@@ -0,0 +1,496 @@
+#ifndef _FT_SMALL_VECTOR_HPP
+#define _FT_SMALL_VECTOR_HPP
+
+#include <memory>
+#include <iterator>
+#include <stdexcept>
+#include <cstring>
+
+#include "algorithm.hpp"
+#include "type_traits.hpp"
+#include "iterator.hpp"
+#include "utility.hpp"
+
+namespace ft
+{
+
+	/*************************************************************
+	 * small_vector
+
+	 * A vector that keeps up to N elements inside the object itself,
+		and only asks its allocator for memory once it grows beyond
+		that. Short sequences thus cost no allocation and sit next to
+		their owner in memory.
+
+	 * It offers the same interface and iterators as ft::vector, and
+		can be used as the underlying container of ft::stack.
+
+	 * The price is a bigger object, and a swap() that has to copy the
+		elements when one of the two vectors uses its inline storage.
+	*************************************************************/
+	template <class T, std::size_t N, class Alloc = std::allocator<T> >
+	class small_vector
+	{
+
+	public:
+		/*************************************************************
+		 * Types
+		 *************************************************************/
+		typedef Alloc											allocator_type;
+		typedef typename allocator_type::reference 				reference;
+		typedef typename allocator_type::const_reference		const_reference;
+		typedef T 												value_type;
+		typedef ft::random_access_iterator<false, value_type>	iterator;
+		typedef ft::random_access_iterator<true, value_type>	const_iterator;
+		typedef std::size_t										size_type;
+		typedef std::ptrdiff_t									difference_type;
+		typedef typename allocator_type::pointer 				pointer;
+		typedef typename allocator_type::const_pointer 			const_pointer;
+		typedef ft::reverse_iterator<iterator> 					reverse_iterator;
+		typedef ft::reverse_iterator<const_iterator>			const_reverse_iterator;
+
+		// Number of elements held without allocating
+		static const size_type	inline_capacity = N;
+
+		/*************************************************************
+		 * Construct/Copy/Destroy
+		 *************************************************************/
+		// Creates a small_vector with no elements
+		explicit small_vector(const allocator_type &alloc = allocator_type())
+			: _alloc(alloc), _capacity(N), _array(inline_data()), _size(0) {}
+
+		// Fill constructor
+		// This constructor fills the small_vector with n copies of value.
+		explicit small_vector(size_type n, const value_type &val = value_type(),
+							  const allocator_type &alloc = allocator_type())
+			: _alloc(alloc), _capacity(N), _array(inline_data()), _size(0)
+		{ assign(n, val); }
+
+		// Range constructor
+		// Create a small_vector consisting of copies of the elements
+		//	from [first,last).
+		template <class InputIterator>
+		small_vector(InputIterator first, InputIterator last,
+					 const allocator_type &alloc = allocator_type(),
+					 typename ft::enable_if<!ft::is_integral<InputIterator>::value>::type * = 0)
+			: _alloc(alloc), _capacity(N), _array(inline_data()), _size(0)
+		{ assign(first, last); }
+
+		// Copy constructor
+		// The copy lives inline whenever x's elements fit in N.
+		small_vector(const small_vector &x)
+			: _alloc(x._alloc), _capacity(N), _array(inline_data()), _size(0)
+		{ assign(x.begin(), x.end()); }
+
+		// Destructor
+		// This only erases the elements. If the elements themselves are
+		// pointers, the pointed-to memory is not touched in any way.
+		// Managing the pointer is the user's responsibility.
+		~small_vector()
+		{
+			clear();
+			release();
+		}
+
+		/*************************************************************
+		 * Assigning operator
+		 *************************************************************/
+		small_vector &operator=(const small_vector &x)
+		{
+			if (this != &x)
+				assign(x.begin(), x.end());
+			return *this;
+		}
+
+		// This function fills a small_vector with copies of the elements in
+		// the range [first,last).
+		template <class InputIterator>
+		void assign(InputIterator first, InputIterator last,
+					typename ft::enable_if<!ft::is_integral<InputIterator>::value>::type * = 0)
+		{
+			range_assign(first, last,
+				typename ft::iterator_traits<InputIterator>::iterator_category());
+		}
+
+		// This function fills a small_vector with n copies of the given value.
+		void assign(size_type n, const value_type &u)
+		{
+			const value_type copy(u);
+
+			clear();
+			reserve(n);
+			for (; _size < n; ++_size)
+				_alloc.construct(_array + _size, copy);
+		}
+
+		/*************************************************************
+		 * Get a copy of the memory allocation object
+		 *************************************************************/
+		allocator_type get_allocator() const { return _alloc; }
+
+		/*************************************************************
+		 * Iterators
+		 *************************************************************/
+		iterator begin(void) { return iterator(_array); }
+		const_iterator begin(void) const { return const_iterator(_array); }
+		iterator end(void) { return iterator(_array + _size); }
+		const_iterator end() const { return const_iterator(_array + _size); }
+		reverse_iterator rbegin(void) { return reverse_iterator(end()); }
+		const_reverse_iterator rbegin(void) const { return const_reverse_iterator(end()); }
+		reverse_iterator rend(void) { return reverse_iterator(begin()); }
+		const_reverse_iterator rend(void) const { return const_reverse_iterator(begin()); }
+
+		/*************************************************************
+		 * Capacity
+		 *************************************************************/
+		size_type size(void) const { return _size; }
+		size_type max_size(void) const { return _alloc.max_size(); }
+
+		// This function will resize the small_vector to the specified
+		// number of elements, truncating it or appending copies of c.
+		void resize(size_type sz, value_type c = value_type())
+		{
+			if (sz > _size)
+				insert(end(), sz - _size, c);
+			else
+				erase(begin() + sz, end());
+		}
+
+		// Never less than N: the inline storage is always available.
+		size_type capacity(void) const { return _capacity; }
+
+		bool empty(void) const { return _size == 0; }
+
+		// Moves the elements to the heap if more than capacity() elements
+		// are requested. If the number requested is more than max_size(),
+		// length_error is thrown.
+		void reserve(size_type n)
+		{
+			if (n > max_size())
+				throw std::length_error("small_vector::reserve");
+			if (n > _capacity)
+			{
+				pointer new_array = _alloc.allocate(n);
+
+				relocate(new_array, _array, _size, trivial_copy());
+				release();
+				_array = new_array;
+				_capacity = n;
+			}
+		}
+
+		// Returns true while the elements live inside the object itself
+		bool is_inline(void) const { return _array == inline_data(); }
+
+		/*************************************************************
+		 * Operator overloads
+		 *************************************************************/
+		reference operator[](size_type n) { return *(_array + n); }
+		const_reference operator[](size_type n) const { return *(_array + n); }
+
+		const_reference at(size_type n) const
+		{
+			if (n < _size)
+				return (*this)[n];
+			throw std::out_of_range("Unvalid index is out of range");
+		}
+		reference at(size_type n)
+		{
+			if (n < _size)
+				return (*this)[n];
+			throw std::out_of_range("Unvalid index is out of range");
+		}
+
+		reference front(void) { return *begin(); }
+		const_reference front() const { return *begin(); }
+		reference back(void) { return *(end() - 1); }
+		const_reference back(void) const { return *(end() - 1); }
+
+		/*************************************************************
+		 * Modifiers
+		 *************************************************************/
+		void push_back(const value_type &x)
+		{
+			if (_size == _capacity)
+			{
+				// x may live inside the vector, so copy it before moving memory
+				const value_type copy(x);
+
+				reserve(_capacity ? _capacity * 2 : 1);
+				_alloc.construct(_array + _size, copy);
+			}
+			else
+				_alloc.construct(_array + _size, x);
+			++_size;
+		}
+
+		void pop_back(void) { _alloc.destroy(&_array[--_size]); }
+
+		iterator insert(iterator position, const value_type &x)
+		{
+			difference_type pos = position - begin();
+			insert(position, 1, x);
+			return begin() + pos;
+		}
+
+		void insert(iterator position, size_type n, const value_type &x)
+		{
+			size_type pos = position - begin();
+			const value_type copy(x);
+			size_type i(0);
+
+			open_gap(pos, n);
+			try
+			{
+				for (; i < n; ++i)
+					_alloc.construct(_array + pos + i, copy);
+			}
+			catch (...)
+			{
+				close_gap(pos, n, i);
+				throw;
+			}
+		}
+
+		template <class InputIterator>
+		void insert(iterator position, InputIterator first, InputIterator last,
+					typename ft::enable_if<!ft::is_integral<InputIterator>::value>::type * = 0)
+		{
+			range_insert(position, first, last,
+				typename ft::iterator_traits<InputIterator>::iterator_category());
+		}
+
+		iterator erase(iterator position)
+		{ return erase(position, position + 1); }
+
+		iterator erase(iterator first, iterator last)
+		{
+			size_type pos = first - begin();
+			size_type n = last - first;
+
+			for (size_type i(pos); i + n < _size; ++i)
+				_array[i] = _array[i + n];
+			for (size_type i(_size - n); i < _size; ++i)
+				_alloc.destroy(_array + i);
+			_size -= n;
+			return begin() + pos;
+		}
+
+		// Swaps data with another small_vector.
+		// Heap buffers are exchanged, inline elements have to be copied.
+		void swap(small_vector &x)
+		{
+			if (this == &x)
+				return;
+			if (!is_inline() && !x.is_inline())
+			{
+				ft::swap(_alloc, x._alloc);
+				ft::swap(_capacity, x._capacity);
+				ft::swap(_array, x._array);
+				ft::swap(_size, x._size);
+			}
+			else
+			{
+				small_vector tmp(*this);
+
+				*this = x;
+				x = tmp;
+			}
+		}
+
+		void clear(void)
+		{
+			for (size_type i(0); i < _size; ++i)
+				_alloc.destroy(_array + i);
+			_size = 0;
+		}
+
+	private:
+		// Raw memory for the inline elements, aligned for any fundamental type
+		union inline_storage
+		{
+			char		_bytes[(N ? N : 1) * sizeof(value_type)];
+			long double	_align_ld;
+			long long	_align_ll;
+			void		*_align_ptr;
+		};
+
+		allocator_type _alloc;
+
+		size_type _capacity;
+		value_type *_array;
+		size_type _size;
+		inline_storage _inline;
+
+		typedef ft::integral_constant<bool,
+			ft::is_trivially_copyable<value_type>::value
+			&& ft::is_same<allocator_type, std::allocator<value_type> >::value>
+														trivial_copy;
+
+		pointer inline_data(void)
+		{ return reinterpret_cast<pointer>(_inline._bytes); }
+
+		const_pointer inline_data(void) const
+		{ return reinterpret_cast<const_pointer>(_inline._bytes); }
+
+		// Gives the heap buffer back to the allocator, if any
+		void release(void)
+		{
+			if (!is_inline())
+				_alloc.deallocate(_array, _capacity);
+			_array = inline_data();
+			_capacity = N;
+		}
+
+		// Moves n elements from src to the uninitialized storage at dst,
+		// leaving src uninitialized. The two ranges may overlap.
+		void relocate(pointer dst, pointer src, size_type n, ft::true_type)
+		{
+			if (n)
+				std::memmove(dst, src, n * sizeof(value_type));
+		}
+
+		void relocate(pointer dst, pointer src, size_type n, ft::false_type)
+		{
+			if (dst < src)
+				for (size_type i(0); i < n; ++i)
+				{
+					_alloc.construct(dst + i, src[i]);
+					_alloc.destroy(src + i);
+				}
+			else
+				for (size_type i(n); i > 0; --i)
+				{
+					_alloc.construct(dst + i - 1, src[i - 1]);
+					_alloc.destroy(src + i - 1);
+				}
+		}
+
+		// Leaves n uninitialized slots at pos, growing the storage if needed.
+		// The size already accounts for them.
+		void open_gap(size_type pos, size_type n)
+		{
+			if (n == 0)
+				return;
+			if (_size + n > _capacity)
+			{
+				size_type cap = _capacity * 2 < _size + n ? _size + n : _capacity * 2;
+				pointer new_array = _alloc.allocate(cap);
+
+				relocate(new_array, _array, pos, trivial_copy());
+				relocate(new_array + pos + n, _array + pos, _size - pos, trivial_copy());
+				release();
+				_array = new_array;
+				_capacity = cap;
+			}
+			else
+				relocate(_array + pos + n, _array + pos, _size - pos, trivial_copy());
+			_size += n;
+		}
+
+		// Undoes open_gap() after a failed construction, destroying the
+		// `built` elements constructed so far.
+		void close_gap(size_type pos, size_type n, size_type built)
+		{
+			for (size_type i(0); i < built; ++i)
+				_alloc.destroy(_array + pos + i);
+			relocate(_array + pos, _array + pos + n, _size - pos - n, trivial_copy());
+			_size -= n;
+		}
+
+		template <class InputIterator>
+		void range_assign(InputIterator first, InputIterator last,
+						  std::input_iterator_tag)
+		{
+			clear();
+			for (; first != last; ++first)
+				push_back(*first);
+		}
+
+		template <class ForwardIterator>
+		void range_assign(ForwardIterator first, ForwardIterator last,
+						  std::forward_iterator_tag)
+		{
+			clear();
+			reserve(ft::distance(first, last));
+			for (; first != last; ++first, ++_size)
+				_alloc.construct(_array + _size, *first);
+		}
+
+		// Input iterators can only be walked once: they are copied aside
+		// and then inserted as a random access range.
+		template <class InputIterator>
+		void range_insert(iterator position, InputIterator first,
+						  InputIterator last, std::input_iterator_tag)
+		{
+			small_vector tmp(first, last, _alloc);
+
+			insert(position, tmp.begin(), tmp.end());
+		}
+
+		template <class ForwardIterator>
+		void range_insert(iterator position, ForwardIterator first,
+						  ForwardIterator last, std::forward_iterator_tag)
+		{
+			size_type pos = position - begin();
+			size_type n = ft::distance(first, last);
+			size_type i(0);
+
+			open_gap(pos, n);
+			try
+			{
+				for (; i < n; ++i, ++first)
+					_alloc.construct(_array + pos + i, *first);
+			}
+			catch (...)
+			{
+				close_gap(pos, n, i);
+				throw;
+			}
+		}
+	}; // End of small_vector
+
+	template <class T, std::size_t N, class Alloc>
+	const typename small_vector<T, N, Alloc>::size_type
+		small_vector<T, N, Alloc>::inline_capacity;
+
+	/*************************************************************
+	 *  Relational operators
+	 *************************************************************/
+	template <class T, std::size_t N, class Alloc>
+	bool operator==(const small_vector<T, N, Alloc> &l, const small_vector<T, N, Alloc> &r)
+	{
+		if (l.size() != r.size())
+			return false;
+		return ft::equal(l.begin(), l.end(), r.begin());
+	}
+
+	template <class T, std::size_t N, class Alloc>
+	bool operator!=(const small_vector<T, N, Alloc> &l, const small_vector<T, N, Alloc> &r)
+	{ return !(l == r); }
+
+	template <class T, std::size_t N, class Alloc>
+	bool operator<(const small_vector<T, N, Alloc> &l, const small_vector<T, N, Alloc> &r)
+	{
+		return ft::lexicographical_compare(l.begin(), l.end(), r.begin(), r.end());
+	}
+
+	template <class T, std::size_t N, class Alloc>
+	bool operator<=(const small_vector<T, N, Alloc> &l, const small_vector<T, N, Alloc> &r)
+	{ return !(r < l); }
+
+	template <class T, std::size_t N, class Alloc>
+	bool operator>(const small_vector<T, N, Alloc> &l, const small_vector<T, N, Alloc> &r)
+	{ return r < l; }
+
+	template <class T, std::size_t N, class Alloc>
+	bool operator>=(const small_vector<T, N, Alloc> &l, const small_vector<T, N, Alloc> &r)
+	{ return !(l < r); }
+
+	// See ft::small_vector::swap().
+	template <class T, std::size_t N, class Alloc>
+	void swap(small_vector<T, N, Alloc> &x, small_vector<T, N, Alloc> &y) { x.swap(y); }
+
+} // namespace ft
+
+#endif /* _FT_SMALL_VECTOR_HPP */
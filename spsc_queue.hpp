@@ -0,0 +1,229 @@
+#ifndef _FT_SPSC_QUEUE_HPP
+#define _FT_SPSC_QUEUE_HPP
+
+#include <cstddef>
+#include <memory>
+
+#include "atomic.hpp"
+
+/*************************************************************
+ * spsc_queue
+
+ * A bounded queue that hands elements from one thread, the producer,
+	to one other thread, the consumer, without any lock: a ring buffer
+	whose capacity is rounded up to a power of two.
+ * The producer only writes the tail index, and the consumer the head
+	index. Each publishes its progress with a release store, which the
+	other reads with an acquire load. Both indices keep growing, and
+	are masked to find their slot.
+ * Each side also keeps a copy of the other side's index, which it
+	only reloads when the copy says the queue is full (or empty): while
+	the queue is neither, the producer and the consumer each stay on
+	their own cache line.
+ * push_n() and pop_n() move up to n elements at once, and publish them
+	with a single store.
+ * Each side must be used from a single thread at a time: push() and
+	push_n() from the producer, front(), pop() and pop_n() from the
+	consumer. size() and empty() may be called from either, and are
+	only exact when the other side is idle. C++98 has no threads: the
+	atomics come from atomic.hpp.
+*************************************************************/
+
+namespace ft
+{
+	template <typename T, typename Alloc = std::allocator<T> >
+	class spsc_queue
+	{
+
+	public:
+		/*************************************************************
+		 * Types
+		 *************************************************************/
+		typedef T									value_type;
+		typedef Alloc								allocator_type;
+		typedef typename Alloc::size_type			size_type;
+		typedef typename Alloc::reference			reference;
+		typedef typename Alloc::const_reference		const_reference;
+
+		/*************************************************************
+		 * Construct/Destroy
+		 *************************************************************/
+		// Room for at least capacity elements
+		explicit spsc_queue(size_type capacity,
+							const allocator_type &alloc = allocator_type())
+			: _alloc(alloc), _buf(0), _mask(round_up(capacity) - 1)
+		{ _buf = _alloc.allocate(_mask + 1); }
+
+		// Destroys the elements that were not popped
+		~spsc_queue()
+		{
+			for (size_type i = _consumer.index; i != _producer.index; ++i)
+				_alloc.destroy(_buf + (i & _mask));
+			_alloc.deallocate(_buf, _mask + 1);
+		}
+
+		allocator_type get_allocator() const { return _alloc; }
+
+		/*************************************************************
+		 * Capacity
+		 *************************************************************/
+		size_type capacity() const { return _mask + 1; }
+
+		size_type size() const
+		{
+			const size_type head = ft::atomic_load(&_consumer.index);
+
+			return ft::atomic_load(&_producer.index) - head;
+		}
+
+		bool empty() const { return size() == 0; }
+
+		/*************************************************************
+		 * Producer
+		 *************************************************************/
+		// False if the queue is full
+		bool push(const value_type &x)
+		{
+			const size_type tail = _producer.index;
+
+			if (tail - _producer.cache > _mask)
+			{
+				_producer.cache = ft::atomic_load(&_consumer.index);
+				if (tail - _producer.cache > _mask)
+					return false;
+			}
+			_alloc.construct(_buf + (tail & _mask), x);
+			ft::atomic_store(&_producer.index, tail + 1);
+			return true;
+		}
+
+		// Pushes the first elements of [first, first + n), as many as
+		// there is room for, and returns their number. If an element
+		// throws while it is copied, the ones before it are pushed.
+		template <typename InputIterator>
+		size_type push_n(InputIterator first, size_type n)
+		{
+			const size_type tail = _producer.index;
+			size_type i = 0;
+
+			if (_mask + 1 - (tail - _producer.cache) < n)
+				_producer.cache = ft::atomic_load(&_consumer.index);
+			if (_mask + 1 - (tail - _producer.cache) < n)
+				n = _mask + 1 - (tail - _producer.cache);
+			try
+			{
+				for (; i < n; ++i, ++first)
+					_alloc.construct(_buf + ((tail + i) & _mask), *first);
+			}
+			catch (...)
+			{ ft::atomic_store(&_producer.index, tail + i); throw; }
+			ft::atomic_store(&_producer.index, tail + n);
+			return n;
+		}
+
+		/*************************************************************
+		 * Consumer
+		 *************************************************************/
+		// The oldest element, which stays in the queue until pop(), or
+		// 0 if the queue is empty
+		value_type *front()
+		{
+			const size_type head = _consumer.index;
+
+			if (head == _consumer.cache)
+			{
+				_consumer.cache = ft::atomic_load(&_producer.index);
+				if (head == _consumer.cache)
+					return 0;
+			}
+			return _buf + (head & _mask);
+		}
+
+		// Removes the element returned by front(), which must not be 0
+		void pop()
+		{
+			const size_type head = _consumer.index;
+
+			_alloc.destroy(_buf + (head & _mask));
+			ft::atomic_store(&_consumer.index, head + 1);
+		}
+
+		// Moves the oldest element into x. False if the queue is empty.
+		bool pop(value_type &x)
+		{
+			value_type *p = front();
+
+			if (p == 0)
+				return false;
+			x = *p;
+			pop();
+			return true;
+		}
+
+		// Assigns up to n of the oldest elements to out, out + 1...
+		// removes them, and returns their number. If an assignment
+		// throws, the elements before it are removed.
+		template <typename OutputIterator>
+		size_type pop_n(OutputIterator out, size_type n)
+		{
+			const size_type head = _consumer.index;
+			size_type i = 0;
+
+			if (_consumer.cache - head < n)
+				_consumer.cache = ft::atomic_load(&_producer.index);
+			if (_consumer.cache - head < n)
+				n = _consumer.cache - head;
+			try
+			{
+				for (; i < n; ++i, ++out)
+				{
+					value_type *p = _buf + ((head + i) & _mask);
+
+					*out = *p;
+					_alloc.destroy(p);
+				}
+			}
+			catch (...)
+			{ ft::atomic_store(&_consumer.index, head + i); throw; }
+			ft::atomic_store(&_consumer.index, head + n);
+			return n;
+		}
+
+	private:
+		spsc_queue(const spsc_queue &);
+		spsc_queue &operator=(const spsc_queue &);
+
+		static size_type round_up(size_type n)
+		{
+			size_type p = 1;
+
+			while (p < n)
+				p <<= 1;
+			return p;
+		}
+
+		// The index a side writes, and its copy of the other side's,
+		// out of the cache lines of the fields before and after them
+		struct side
+		{
+			side() : index(0), cache(0) {}
+
+			char		pad[64];
+			size_type	index;
+			size_type	cache;
+			char		pad_after[64];
+		};
+
+		// Read by both sides, written by none after construction
+		allocator_type	_alloc;
+		value_type		*_buf;
+		size_type		_mask;
+
+		side			_consumer;
+		side			_producer;
+
+	}; // spsc_queue
+
+} // namespace ft
+
+#endif /* _FT_SPSC_QUEUE_HPP */
@@ -3,7 +3,10 @@
 
 #include <memory>
 
+#include "type_traits.hpp"
 #include "utility.hpp"
+#include "iterator.hpp"
+#include "pool_allocator.hpp"
 
 /*************************************************************
  * A Red-Black Tree implementation.
@@ -19,6 +22,15 @@
  * When a node being deleted has two children its successor node
 	is relinked into its place, rather than copied, so that the only
 	iterators invalidated are those referring to the deleted node.
+
+ * Defining FT_RB_TREE_COMPACT stores the color of a node in the low
+	bit of its parent pointer, shrinking the node base from 32 to 24
+	bytes on 64-bit platforms.
+
+ * Defining FT_RB_TREE_ORDER_STATISTICS keeps the size of its subtree
+	in every node, which gives select(), rank() and distance() in
+	logarithmic time, at the cost of one more word per node and of
+	updating the sizes along the path of every insertion and erasure.
 *************************************************************/
 
 namespace ft
@@ -45,11 +57,51 @@ namespace ft
 			typedef rb_tree_node_base *base_ptr;
 			typedef const rb_tree_node_base *const_base_ptr;
 
+#ifdef FT_RB_TREE_COMPACT
+			// The color is kept in the lowest bit of the parent pointer,
+			// which is always 0 since nodes are at least pointer aligned.
+			// The header is red (0), so its _parent is the plain root pointer.
+			base_ptr _parent;
+			base_ptr _left;
+			base_ptr _right;
+
+			base_ptr parent() const
+			{
+				return reinterpret_cast<base_ptr>(
+					reinterpret_cast<std::size_t>(_parent) & ~std::size_t(1));
+			}
+
+			void set_parent(base_ptr p)
+			{
+				_parent = reinterpret_cast<base_ptr>(reinterpret_cast<std::size_t>(p)
+					| (reinterpret_cast<std::size_t>(_parent) & 1));
+			}
+
+			rb_tree_color color() const
+			{ return rb_tree_color(reinterpret_cast<std::size_t>(_parent) & 1); }
+
+			void set_color(rb_tree_color c)
+			{
+				_parent = reinterpret_cast<base_ptr>(
+					(reinterpret_cast<std::size_t>(_parent) & ~std::size_t(1))
+					| std::size_t(c));
+			}
+#else
 			rb_tree_color _color;
 			base_ptr _parent;
 			base_ptr _left;
 			base_ptr _right;
 
+			base_ptr parent() const { return _parent; }
+			void set_parent(base_ptr p) { _parent = p; }
+			rb_tree_color color() const { return _color; }
+			void set_color(rb_tree_color c) { _color = c; }
+#endif
+
+#ifdef FT_RB_TREE_ORDER_STATISTICS
+			std::size_t _size; // Number of nodes in the subtree rooted here
+#endif
+
 			static base_ptr minimum(base_ptr x)
 			{
 				while (x->_left != 0)
@@ -103,19 +155,21 @@ namespace ft
 			rb_tree_node_base _header;
 			std::size_t _node_count; // Keeps track of size of tree.
 
+			// reset() first: with FT_RB_TREE_COMPACT, set_color() keeps
+			// the bits of _parent
 			rb_tree_header()
 			{
-				_header._color = _red;
 				reset();
+				_header.set_color(_red);
 			}
 
 			void move_data(rb_tree_header &from)
 			{
-				_header._color = from._header._color;
+				_header.set_color(from._header.color());
 				_header._parent = from._header._parent;
 				_header._left = from._header._left;
 				_header._right = from._header._right;
-				_header._parent->_parent = &_header;
+				_header._parent->set_parent(&_header);
 				_node_count = from._node_count;
 				from.reset();
 			}
@@ -319,6 +373,7 @@ namespace ft
 
 		}; // rb_tree_const_iterator
 
+	public:
 		typedef typename __gnu_cxx::__alloc_traits<Alloc>::template rebind<rb_tree_node<Val> >::other node_allocator;
 		typedef __gnu_cxx::__alloc_traits<node_allocator> alloc_traits;
 
@@ -328,6 +383,13 @@ namespace ft
 		typedef rb_tree_node<Val> *link_type;
 		typedef const rb_tree_node<Val> *const_link_type;
 
+		// A detached subtree, see join() and split()
+		struct rb_subtree
+		{
+			rb_tree_node_base	*root;
+			int					height;
+		};
+
 	private:
 		// Functor recycling a pool of nodes and using allocation once the pool
 		// is empty.
@@ -338,7 +400,7 @@ namespace ft
 			{
 				if (_root)
 				{
-					_root->_parent = 0;
+					_root->set_parent(0);
 
 					if (_nodes->_left)
 						_nodes = _nodes->_left;
@@ -373,7 +435,7 @@ namespace ft
 					return _nodes;
 
 				base_ptr node = _nodes;
-				_nodes = _nodes->_parent;
+				_nodes = _nodes->parent();
 				if (_nodes)
 				{
 					if (_nodes->_right == node)
@@ -456,6 +518,19 @@ namespace ft
 			return tmp;
 		}
 
+		// Let construct build the value in place, without a copy
+		template <typename _ValueCtor>
+		link_type create_node_with(const _ValueCtor &construct)
+		{
+			link_type tmp = get_node();
+
+			try
+			{ construct(tmp->valptr()); }
+			catch (...)
+			{ put_node(tmp); throw; }
+			return tmp;
+		}
+
 		void destroy_node(link_type p)
 		{ get_allocator().destroy(p->valptr()); }
 
@@ -470,9 +545,12 @@ namespace ft
 		{
 			link_type tmp = node_gen(*x->valptr());
 
-			tmp->_color = x->_color;
+			tmp->set_color(x->color());
 			tmp->_left = 0;
 			tmp->_right = 0;
+#ifdef FT_RB_TREE_ORDER_STATISTICS
+			tmp->_size = x->_size;
+#endif
 			return tmp;
 		}
 
@@ -486,8 +564,11 @@ namespace ft
 
 			rb_tree_impl() : node_allocator() {}
 
-			// rb_tree_impl(const rb_tree_impl& x)
-			// : node_allocator(), base_key_compare(x._key_compare), rb_tree_header() {}
+			// A copy starts with an empty header: the nodes are copied by
+			// the tree itself.
+			rb_tree_impl(const rb_tree_impl &x)
+				: node_allocator(x), base_key_compare(x._key_compare),
+				  rb_tree_header() {}
 
 			rb_tree_impl(const Key_compare &comp, const node_allocator &a)
 				: node_allocator(a), base_key_compare(comp) {}
@@ -571,6 +652,128 @@ namespace ft
 		iterator
 		insert_(base_ptr x, base_ptr y, const value_type &v, _NodeGen &);
 
+		// Links z at the position found by get_insert_*_pos()
+		iterator insert_node(base_ptr x, base_ptr p, link_type z);
+
+		link_type unlink_node(const_iterator position)
+		{
+			link_type y = static_cast<link_type>(rb_tree_rebalance_for_erase(
+				const_cast<base_ptr>(position._node), _impl._header));
+
+			--_impl._node_count;
+			return y;
+		}
+
+		// The whole tree as a detached subtree, leaving the tree empty
+		rb_subtree take_tree()
+		{
+			rb_subtree t = detach(root(), black_height(root()));
+
+			_impl.reset();
+			return t;
+		}
+
+		// Makes t, of n nodes, the whole tree
+		void give_tree(rb_subtree t, size_type n)
+		{
+			_impl.reset();
+			if (t.root == 0)
+				return;
+			root() = t.root;
+			t.root->set_parent(_end());
+			leftmost() = minimum(t.root);
+			rightmost() = maximum(t.root);
+			_impl._node_count = n;
+		}
+
+		// Destroys the subtree x, and returns its number of nodes
+		size_type drop_subtree(base_ptr x)
+		{
+			size_type n = 0;
+
+			while (x != 0)
+			{
+				n += drop_subtree(x->_right) + 1;
+
+				base_ptr y = x->_left;
+
+				drop_node(static_cast<link_type>(x));
+				x = y;
+			}
+			return n;
+		}
+
+		void erase_range(base_ptr first, base_ptr last);
+
+		template <typename _Fork>
+		rb_subtree union_of(rb_subtree t1, rb_subtree t2, rb_tree &other,
+							size_type &dropped, _Fork &fork);
+		template <typename _Fork>
+		rb_subtree intersection_of(rb_subtree t1, rb_subtree t2, rb_tree &other,
+								   size_type &kept, _Fork &fork);
+		template <typename _Fork>
+		rb_subtree difference_of(rb_subtree t1, rb_subtree t2, rb_tree &other,
+								 size_type &removed, _Fork &fork);
+
+		// One of the two recursive calls of a set operation. Both calls
+		// work on disjoint subtrees, and count into their own task, so
+		// that a fork may run them at the same time.
+		template <typename _Fork>
+		struct set_op_task
+		{
+			typedef rb_subtree (rb_tree::*operation)(rb_subtree, rb_subtree,
+													 rb_tree &, size_type &,
+													 _Fork &);
+
+			set_op_task(rb_tree *t, operation o, rb_subtree s1, rb_subtree s2,
+						rb_tree *x, _Fork *f)
+				: tree(t), op(o), t1(s1), t2(s2), other(x), count(0), fork(f) {}
+
+			void operator()() { result = (tree->*op)(t1, t2, *other, count, *fork); }
+
+			rb_tree		*tree;
+			operation	op;
+			rb_subtree	t1;
+			rb_subtree	t2;
+			rb_tree		*other;
+			size_type	count;
+			rb_subtree	result;
+			_Fork		*fork;
+		};
+
+		// Runs op on (l1, l2) and on (r1, r2) through fork, and adds up
+		// their counts
+		template <typename _Fork>
+		void fork_halves(typename set_op_task<_Fork>::operation op,
+						 rb_subtree l1, rb_subtree l2, rb_subtree r1, rb_subtree r2,
+						 rb_tree &other, size_type &count, _Fork &fork,
+						 rb_subtree &l, rb_subtree &r)
+		{
+			set_op_task<_Fork> left(this, op, l1, l2, &other, &fork);
+			set_op_task<_Fork> right(this, op, r1, r2, &other, &fork);
+			int height = l1.height;
+
+			height = l2.height > height ? l2.height : height;
+			height = r1.height > height ? r1.height : height;
+			height = r2.height > height ? r2.height : height;
+
+			fork(left, right, height);
+			count += left.count + right.count;
+			l = left.result;
+			r = right.result;
+		}
+
+		// Runs both halves one after the other
+		struct sequential_fork
+		{
+			template <typename _Task>
+			void operator()(_Task &a, _Task &b, int) const
+			{
+				a();
+				b();
+			}
+		};
+
 		// Insertion hints in associative containers.
 		iterator insert_lower(base_ptr y, const value_type &v);
 		iterator insert_equal_lower(const value_type &x);
@@ -602,13 +805,47 @@ namespace ft
 
 		void erase(link_type x);
 
-		iterator lower_bound(link_type x, base_ptr y, const Key &k);
+		// Erases the whole subtree at x. Nodes coming from a pool are not
+		// deallocated one by one: the pool gives back all its slabs at once.
+		void erase_all(link_type x, ft::false_type) { erase(x); }
+
+		void erase_all(link_type x, ft::true_type)
+		{
+			destroy_all(x);
+			get_node_allocator().release();
+		}
+
+		void destroy_all(link_type x)
+		{
+			while (x != 0)
+			{
+				destroy_all(right(x));
+				destroy_node(x);
+				x = left(x);
+			}
+		}
+
+		typedef ft::is_pool_allocator<node_allocator>	pooled_nodes;
+
+		// _Kt is key_type, or any type a transparent Compare accepts
+		template <typename _Kt>
+		iterator lower_bound(link_type x, base_ptr y, const _Kt &k);
+		template <typename _Kt>
 		const_iterator lower_bound(const_link_type x, const_base_ptr y,
-								   const Key &k) const;
+								   const _Kt &k) const;
 
-		iterator upper_bound(link_type x, base_ptr y, const Key &k);
+		template <typename _Kt>
+		iterator upper_bound(link_type x, base_ptr y, const _Kt &k);
+		template <typename _Kt>
 		const_iterator upper_bound(const_link_type x, const_base_ptr y,
-								   const Key &k) const;
+								   const _Kt &k) const;
+
+		// Both bounds in a single descent: it splits at the first node
+		// equivalent to k, whose left and right subtrees hold the bounds.
+		template <typename _Kt>
+		pair<iterator, iterator> equal_range_(const _Kt &k);
+		template <typename _Kt>
+		pair<const_iterator, const_iterator> equal_range_(const _Kt &k) const;
 
 
 	public:
@@ -621,7 +858,7 @@ namespace ft
 		rb_tree(const rb_tree &x) : _impl(x._impl)
 		{ if (x.root() != 0) root() = copy(x); }
 
-		~rb_tree() { erase(_begin()); }
+		~rb_tree() { erase_all(_begin(), pooled_nodes()); }
 
 		rb_tree &operator=(const rb_tree &x);
 
@@ -685,25 +922,256 @@ namespace ft
 			return insert_equal_(pos, x, an);
 		}
 
+		// An empty tree is built in linear time from a sorted range,
+		// see build_range_unique().
 		template <typename _InputIterator>
 		void insert_range_unique(_InputIterator first, _InputIterator last)
 		{
+			if (empty())
+				first = build_range_unique(first, last);
+
 			alloc_node an(*this);
 			for (; first != last; ++first)
 				insert_unique(end(), *first, an);
 		}
 
+		// The range is known to be sorted and free of duplicates
+		template <typename _InputIterator>
+		void insert_range_unique(ft::sorted_unique_t,
+								 _InputIterator first, _InputIterator last)
+		{
+			if (empty())
+				build_range_unique(ft::sorted_unique, first, last);
+			else
+				insert_range_unique(first, last);
+		}
+
+		// As above, see build_range_equal(). Each other element is
+		// inserted with end() as a hint, in constant amortized time when
+		// it is not less than the last one.
 		template <typename _InputIterator>
 		void insert_range_equal(_InputIterator first, _InputIterator last)
 		{
+			if (empty())
+				first = build_range_equal(first, last);
+
 			alloc_node an(*this);
 			for (; first != last; ++first)
 				insert_equal_(end(), *first, an);
 		}
 
+		// Unlinks the node at position without destroying it: the caller
+		// owns it. Nodes from a pool cannot outlive the tree.
+		link_type extract_node(const_iterator position)
+		{
+			typedef char pooled_nodes_cannot_be_extracted[pooled_nodes::value ? -1 : 1];
+
+			(void)sizeof(pooled_nodes_cannot_be_extracted);
+			return unlink_node(position);
+		}
+
+		// Links z, unless its key is already in the tree: then the caller
+		// keeps z, and the iterator points to the node with that key.
+		pair<iterator, bool> reinsert_node_unique(link_type z)
+		{
+			pair<base_ptr, base_ptr> res = get_insert_unique_pos(key(z));
+
+			if (res.second)
+				return pair<iterator, bool>(insert_node(res.first, res.second, z), true);
+			return pair<iterator, bool>(iterator(res.first), false);
+		}
+
+		// Links z after the nodes with an equivalent key, if any
+		iterator reinsert_node_equal(link_type z)
+		{
+			pair<base_ptr, base_ptr> res = get_insert_equal_pos(key(z));
+
+			return insert_node(res.first, res.second, z);
+		}
+
+		// Moves the nodes of src whose key is not in the tree yet
+		void merge_unique(rb_tree &src);
+
+		// Moves all the nodes of src
+		void merge_equal(rb_tree &src);
+
+		// Set algebra on two trees with unique keys, built on split() and
+		// join(): with sizes m <= n, each takes O(m log(n/m + 1)).
+		// The tree keeps its own nodes, and other is left empty: its
+		// nodes are moved into the tree or destroyed. Compare must not
+		// throw.
+		void union_unique(rb_tree &other)
+		{
+			sequential_fork seq;
+			union_unique(other, seq);
+		}
+
+		void intersect_unique(rb_tree &other)
+		{
+			sequential_fork seq;
+			intersect_unique(other, seq);
+		}
+
+		void difference_unique(rb_tree &other)
+		{
+			sequential_fork seq;
+			difference_unique(other, seq);
+		}
+
+		// The same, where fork(a, b, height) runs the two independent
+		// halves of each step, a() and b(), possibly at the same time.
+		// height is the largest black height among the subtrees of both
+		// halves. Before running them, fork may point a.fork and b.fork
+		// to the forks their own steps go through.
+		template <typename _Fork>
+		void union_unique(rb_tree &other, _Fork &fork);
+		template <typename _Fork>
+		void intersect_unique(rb_tree &other, _Fork &fork);
+		template <typename _Fork>
+		void difference_unique(rb_tree &other, _Fork &fork);
+
+		// Insert a value for k, if k is not in the tree yet, in a single
+		// descent. The value is only built on a miss, in the node itself:
+		// construct(p) must construct a value whose key is k at p.
+		template <typename _ValueCtor>
+		pair<iterator, bool>
+		emplace_unique_key(const key_type &k, const _ValueCtor &construct)
+		{
+			pair<base_ptr, base_ptr> res = get_insert_unique_pos(k);
+
+			if (res.second)
+				return pair<iterator, bool>(
+					insert_node(res.first, res.second, create_node_with(construct)),
+					true);
+			return pair<iterator, bool>(iterator(res.first), false);
+		}
+
+		template <typename _ValueCtor>
+		pair<iterator, bool>
+		emplace_hint_unique_key(const_iterator pos, const key_type &k,
+								const _ValueCtor &construct)
+		{
+			pair<base_ptr, base_ptr> res = get_insert_hint_unique_pos(pos, k);
+
+			if (res.second)
+				return pair<iterator, bool>(
+					insert_node(res.first, res.second, create_node_with(construct)),
+					true);
+			return pair<iterator, bool>(iterator(res.first), false);
+		}
+
 
 	private:
 
+		// Bulk construction of an empty tree.
+		// The nodes are linked into a perfectly balanced tree, in order,
+		// without comparing or rebalancing anything.
+		template <typename _InputIterator>
+		_InputIterator build_range_unique(_InputIterator first,
+										  _InputIterator last)
+		{
+			return build_range_unique(first, last,
+				typename ft::iterator_traits<_InputIterator>::iterator_category());
+		}
+
+		// The same, keeping the equivalent keys
+		template <typename _InputIterator>
+		_InputIterator build_range_equal(_InputIterator first,
+										 _InputIterator last)
+		{
+			return build_range_equal(first, last,
+				typename ft::iterator_traits<_InputIterator>::iterator_category());
+		}
+
+		template <typename _InputIterator>
+		void build_range_unique(ft::sorted_unique_t,
+								_InputIterator first, _InputIterator last)
+		{
+			build_sorted(first, last,
+				typename ft::iterator_traits<_InputIterator>::iterator_category());
+		}
+
+		template <typename _InputIterator>
+		_InputIterator build_range_unique(_InputIterator first,
+										  _InputIterator last,
+										  std::input_iterator_tag);
+
+		template <typename _ForwardIterator>
+		_ForwardIterator build_range_unique(_ForwardIterator first,
+											_ForwardIterator last,
+											std::forward_iterator_tag);
+
+		template <typename _InputIterator>
+		_InputIterator build_range_equal(_InputIterator first,
+										 _InputIterator last,
+										 std::input_iterator_tag);
+
+		template <typename _ForwardIterator>
+		_ForwardIterator build_range_equal(_ForwardIterator first,
+										   _ForwardIterator last,
+										   std::forward_iterator_tag);
+
+		template <typename _InputIterator>
+		void build_sorted(_InputIterator first, _InputIterator last,
+						  std::input_iterator_tag);
+
+		template <typename _ForwardIterator>
+		void build_sorted(_ForwardIterator first, _ForwardIterator last,
+						  std::forward_iterator_tag)
+		{
+			range_nodes<_ForwardIterator> nodes(*this, first);
+
+			link_tree(nodes, ft::distance(first, last));
+		}
+
+		// Node sources for build_balanced(): the nodes come either straight
+		// from a range whose length is known, or from a chain of nodes
+		// linked through their right pointer.
+		template <typename _ForwardIterator>
+		struct range_nodes
+		{
+			range_nodes(rb_tree &t, _ForwardIterator first)
+				: _t(t), _first(first) {}
+
+			link_type operator()()
+			{
+				link_type x = _t.create_node(*_first);
+
+				++_first;
+				return x;
+			}
+
+		private:
+			rb_tree &_t;
+			_ForwardIterator _first;
+		};
+
+		struct chained_nodes
+		{
+			chained_nodes(link_type chain) : _chain(chain) {}
+
+			link_type operator()()
+			{
+				link_type x = _chain;
+
+				_chain = right(x);
+				return x;
+			}
+
+		private:
+			link_type _chain;
+		};
+
+		template <typename _NodeSource>
+		void link_tree(_NodeSource &nodes, size_type n);
+
+		template <typename _NodeSource>
+		link_type build_balanced(_NodeSource &nodes, size_type n,
+								 size_type depth, size_type red_depth);
+
+		void append_node(link_type x, link_type &head, link_type &tail);
+		void drop_chain(link_type chain);
+
 		void erase_aux(iterator position);
 		void erase_aux(iterator first, iterator last);
 		void erase_aux(const_iterator position);
@@ -724,7 +1192,7 @@ namespace ft
 		{ erase_aux(first, last); }
 
 		void clear()
-		{ erase(_begin()); _impl.reset(); }
+		{ erase_all(_begin(), pooled_nodes()); _impl.reset(); }
 
 		// Set operations.
 		iterator find(const key_type &k);
@@ -744,10 +1212,106 @@ namespace ft
 		const_iterator upper_bound(const key_type &k) const
 		{ return upper_bound(_begin(), _end(), k); }
 
-		pair<iterator, iterator> equal_range(const key_type &k);
+		pair<iterator, iterator> equal_range(const key_type &k)
+		{ return equal_range_(k); }
 
 		pair<const_iterator, const_iterator>
-		equal_range(const key_type &k) const;
+		equal_range(const key_type &k) const
+		{ return equal_range_(k); }
+
+		// Transparent lookups: when Compare declares is_transparent, the
+		// keys are compared to k as is, without converting it to key_type.
+		template <typename _Kt>
+		typename ft::enable_if<ft::has_is_transparent<Compare, _Kt>::value,
+							   iterator>::type
+		find(const _Kt &k)
+		{
+			iterator j = lower_bound(_begin(), _end(), k);
+			return (j == end() || _impl._key_compare(k, key(j._node))) ? end() : j;
+		}
+
+		template <typename _Kt>
+		typename ft::enable_if<ft::has_is_transparent<Compare, _Kt>::value,
+							   const_iterator>::type
+		find(const _Kt &k) const
+		{
+			const_iterator j = lower_bound(_begin(), _end(), k);
+			return (j == end() || _impl._key_compare(k, key(j._node))) ? end() : j;
+		}
+
+		// Several keys may be equivalent to k
+		template <typename _Kt>
+		typename ft::enable_if<ft::has_is_transparent<Compare, _Kt>::value,
+							   size_type>::type
+		count(const _Kt &k) const
+		{
+			pair<const_iterator, const_iterator> p = equal_range(k);
+#ifdef FT_RB_TREE_ORDER_STATISTICS
+			return distance(p.first, p.second);
+#else
+			return std::distance(p.first, p.second);
+#endif
+		}
+
+		template <typename _Kt>
+		typename ft::enable_if<ft::has_is_transparent<Compare, _Kt>::value,
+							   iterator>::type
+		lower_bound(const _Kt &k)
+		{ return lower_bound(_begin(), _end(), k); }
+
+		template <typename _Kt>
+		typename ft::enable_if<ft::has_is_transparent<Compare, _Kt>::value,
+							   const_iterator>::type
+		lower_bound(const _Kt &k) const
+		{ return lower_bound(_begin(), _end(), k); }
+
+		template <typename _Kt>
+		typename ft::enable_if<ft::has_is_transparent<Compare, _Kt>::value,
+							   iterator>::type
+		upper_bound(const _Kt &k)
+		{ return upper_bound(_begin(), _end(), k); }
+
+		template <typename _Kt>
+		typename ft::enable_if<ft::has_is_transparent<Compare, _Kt>::value,
+							   const_iterator>::type
+		upper_bound(const _Kt &k) const
+		{ return upper_bound(_begin(), _end(), k); }
+
+		template <typename _Kt>
+		typename ft::enable_if<ft::has_is_transparent<Compare, _Kt>::value,
+							   pair<iterator, iterator> >::type
+		equal_range(const _Kt &k)
+		{ return equal_range_(k); }
+
+		template <typename _Kt>
+		typename ft::enable_if<ft::has_is_transparent<Compare, _Kt>::value,
+							   pair<const_iterator, const_iterator> >::type
+		equal_range(const _Kt &k) const
+		{ return equal_range_(k); }
+
+#ifdef FT_RB_TREE_ORDER_STATISTICS
+		// Order statistics.
+		// select(k) is the k-th smallest element, counting from 0,
+		// or end() if there are no more than k elements.
+		iterator select(size_type k)
+		{ return iterator(const_cast<base_ptr>(select_node(k))); }
+
+		const_iterator select(size_type k) const
+		{ return const_iterator(select_node(k)); }
+
+		// Number of elements less than k, or before pos
+		size_type rank(const key_type &k) const;
+		size_type rank(const_iterator pos) const;
+
+		difference_type distance(const_iterator first,
+								 const_iterator last) const
+		{ return difference_type(rank(last)) - difference_type(rank(first)); }
+
+	private:
+		const_base_ptr select_node(size_type k) const;
+
+	public:
+#endif
 
 		friend bool operator==(const rb_tree &x, const rb_tree &y)
 		{
@@ -782,11 +1346,11 @@ namespace ft
 			{
 				// Otherwise go up the tree, looking for a node
 				//  that is its parent's left child
-				rb_tree_node_base *y = x->_parent;
+				rb_tree_node_base *y = x->parent();
 				while (x == y->_right)
 				{
 					x = y;
-					y = y->_parent;
+					y = y->parent();
 				}
 				// Handle end() case
 				if (x->_right != y)
@@ -801,7 +1365,7 @@ namespace ft
 		static rb_tree_node_base *rb_tree_decrement(rb_tree_node_base *x)
 		{
 			// Handle end() case
-			if (x->_color == _red && x->_parent->_parent == x)
+			if (x->color() == _red && x->parent()->parent() == x)
 				x = x->_right;
 			else if (x->_left != 0)
 			{
@@ -815,11 +1379,11 @@ namespace ft
 			{
 				// Otherwise go up the tree, looking for a node
 				//  that is its parent's right child.
-				rb_tree_node_base *y = x->_parent;
+				rb_tree_node_base *y = x->parent();
 				while (x == y->_left)
 				{
 					x = y;
-					y = y->_parent;
+					y = y->parent();
 				}
 				x = y;
 			}
@@ -830,6 +1394,46 @@ namespace ft
 		{ return rb_tree_decrement(const_cast<rb_tree_node_base *>(x)); }
 
 
+		/*************************************************************
+		 * Subtree sizes
+
+		 * Without FT_RB_TREE_ORDER_STATISTICS there is nothing to
+			maintain, and these functions do nothing.
+		 *************************************************************/
+#ifdef FT_RB_TREE_ORDER_STATISTICS
+		static std::size_t subtree_size(const rb_tree_node_base *x)
+		{ return x != 0 ? x->_size : 0; }
+
+		static void update_size(rb_tree_node_base *x)
+		{ x->_size = subtree_size(x->_left) + subtree_size(x->_right) + 1; }
+
+		// Adds n (modulo, so that it can be -1) to the size of x and of
+		// all its ancestors.
+		static void update_path(rb_tree_node_base *x,
+								const rb_tree_node_base *header,
+								std::size_t n)
+		{
+			for (; x != header; x = x->parent())
+				x->_size += n;
+		}
+
+		// y took the place of x, at the top of the same nodes
+		static void rotate_sizes(rb_tree_node_base *x, rb_tree_node_base *y)
+		{
+			y->_size = x->_size;
+			update_size(x);
+		}
+#else
+		static std::size_t subtree_size(const rb_tree_node_base *) { return 0; }
+
+		static void update_size(rb_tree_node_base *) {}
+
+		static void update_path(rb_tree_node_base *,
+								const rb_tree_node_base *, std::size_t) {}
+
+		static void rotate_sizes(rb_tree_node_base *, rb_tree_node_base *) {}
+#endif
+
 		/*************************************************************
 		 * Rotation functions
 		 *************************************************************/
@@ -840,17 +1444,18 @@ namespace ft
 
 			x->_right = y->_left;
 			if (y->_left != 0)
-				y->_left->_parent = x;
-			y->_parent = x->_parent;
+				y->_left->set_parent(x);
+			y->set_parent(x->parent());
 
 			if (x == root)
 				root = y;
-			else if (x == x->_parent->_left)
-				x->_parent->_left = y;
+			else if (x == x->parent()->_left)
+				x->parent()->_left = y;
 			else
-				x->_parent->_right = y;
+				x->parent()->_right = y;
 			y->_left = x;
-			x->_parent = y;
+			x->set_parent(y);
+			rotate_sizes(x, y);
 		}
 
 		static void rb_tree_rotate_right(rb_tree_node_base *const x,
@@ -860,20 +1465,88 @@ namespace ft
 
 			x->_left = y->_right;
 			if (y->_right != 0)
-				y->_right->_parent = x;
-			y->_parent = x->_parent;
+				y->_right->set_parent(x);
+			y->set_parent(x->parent());
 
 			if (x == root)
 				root = y;
-			else if (x == x->_parent->_right)
-				x->_parent->_right = y;
+			else if (x == x->parent()->_right)
+				x->parent()->_right = y;
 			else
-				x->_parent->_left = y;
+				x->parent()->_left = y;
 			y->_right = x;
-			x->_parent = y;
+			x->set_parent(y);
+			rotate_sizes(x, y);
 		}
 
 
+		/*************************************************************
+		 * Rebalance after insert
+
+		 * x is a red node, whose parent may be red too. Fixes the colors
+			up to root, which may be the root of a tree or of a detached
+			subtree. Returns true if root had to be turned black at the
+			end, which adds one to the black height of the tree.
+		 *************************************************************/
+		static bool rb_tree_rebalance_after_insert(rb_tree_node_base *x,
+												   rb_tree_node_base *&root)
+		{
+			while (x != root && x->parent()->color() == _red)
+			{
+				rb_tree_node_base *const xpp = x->parent()->parent();
+
+				if (x->parent() == xpp->_left)
+				{
+					rb_tree_node_base *const y = xpp->_right;
+					if (y && y->color() == _red)
+					{
+						x->parent()->set_color(_black);
+						y->set_color(_black);
+						xpp->set_color(_red);
+						x = xpp;
+					}
+					else
+					{
+						if (x == x->parent()->_right)
+						{
+							x = x->parent();
+							rb_tree_rotate_left(x, root);
+						}
+						x->parent()->set_color(_black);
+						xpp->set_color(_red);
+						rb_tree_rotate_right(xpp, root);
+					}
+				}
+				else
+				{
+					rb_tree_node_base *const y = xpp->_left;
+					if (y && y->color() == _red)
+					{
+						x->parent()->set_color(_black);
+						y->set_color(_black);
+						xpp->set_color(_red);
+						x = xpp;
+					}
+					else
+					{
+						if (x == x->parent()->_left)
+						{
+							x = x->parent();
+							rb_tree_rotate_right(x, root);
+						}
+						x->parent()->set_color(_black);
+						xpp->set_color(_red);
+						rb_tree_rotate_left(xpp, root);
+					}
+				}
+			}
+
+			const bool grew = root->color() == _red;
+
+			root->set_color(_black);
+			return grew;
+		}
+
 		/*************************************************************
 		 * Insert and rebalance
 		 *************************************************************/
@@ -885,10 +1558,12 @@ namespace ft
 			rb_tree_node_base *&_root = header._parent;
 
 			// Initialize fields in new node to insert.
-			x->_parent = p;
+			x->set_parent(p);
 			x->_left = 0;
 			x->_right = 0;
-			x->_color = _red;
+			x->set_color(_red);
+			update_size(x);
+			update_path(p, &header, 1);
 
 			// Insert.
 			// Make new node child of parent and maintain root, leftmost and
@@ -914,57 +1589,7 @@ namespace ft
 					header._right = x; // maintain rightmost pointing to max node
 			}
 
-			// Rebalance.
-			while (x != _root && x->_parent->_color == _red)
-			{
-				rb_tree_node_base *const xpp = x->_parent->_parent;
-
-				if (x->_parent == xpp->_left)
-				{
-					rb_tree_node_base *const y = xpp->_right;
-					if (y && y->_color == _red)
-					{
-						x->_parent->_color = _black;
-						y->_color = _black;
-						xpp->_color = _red;
-						x = xpp;
-					}
-					else
-					{
-						if (x == x->_parent->_right)
-						{
-							x = x->_parent;
-							rb_tree_rotate_left(x, _root);
-						}
-						x->_parent->_color = _black;
-						xpp->_color = _red;
-						rb_tree_rotate_right(xpp, _root);
-					}
-				}
-				else
-				{
-					rb_tree_node_base *const y = xpp->_left;
-					if (y && y->_color == _red)
-					{
-						x->_parent->_color = _black;
-						y->_color = _black;
-						xpp->_color = _red;
-						x = xpp;
-					}
-					else
-					{
-						if (x == x->_parent->_left)
-						{
-							x = x->_parent;
-							rb_tree_rotate_right(x, _root);
-						}
-						x->_parent->_color = _black;
-						xpp->_color = _red;
-						rb_tree_rotate_left(xpp, _root);
-					}
-				}
-			}
-			_root->_color = _black;
+			rb_tree_rebalance_after_insert(x, _root);
 
 		} // rb_tree_insert_and_rebalance
 
@@ -994,48 +1619,55 @@ namespace ft
 					y = y->_left;
 				x = y->_right;
 			}
+			// y is the node that leaves its place in the tree
+			update_path(y->parent(), &header, std::size_t(-1));
 			if (y != z)
 			{
 				// relink y in place of z.  y is z's successor
-				z->_left->_parent = y;
+				z->_left->set_parent(y);
 				y->_left = z->_left;
 				if (y != z->_right)
 				{
-					x_parent = y->_parent;
+					x_parent = y->parent();
 					if (x)
-						x->_parent = y->_parent;
-					y->_parent->_left = x; // y must be a child of _left
+						x->set_parent(y->parent());
+					y->parent()->_left = x; // y must be a child of _left
 					y->_right = z->_right;
-					z->_right->_parent = y;
+					z->_right->set_parent(y);
 				}
 				else
 					x_parent = y;
 				if (root == z)
 					root = y;
-				else if (z->_parent->_left == z)
-					z->_parent->_left = y;
+				else if (z->parent()->_left == z)
+					z->parent()->_left = y;
 				else
-					z->_parent->_right = y;
-				y->_parent = z->_parent;
-				ft::swap(y->_color, z->_color);
+					z->parent()->_right = y;
+				y->set_parent(z->parent());
+#ifdef FT_RB_TREE_ORDER_STATISTICS
+				y->_size = z->_size;
+#endif
+				rb_tree_color color = y->color();
+				y->set_color(z->color());
+				z->set_color(color);
 				y = z;
 				// y now points to node to be actually deleted
 			}
 			else
 			{ // y == z
-				x_parent = y->_parent;
+				x_parent = y->parent();
 				if (x)
-					x->_parent = y->_parent;
+					x->set_parent(y->parent());
 				if (root == z)
 					root = x;
-				else if (z->_parent->_left == z)
-					z->_parent->_left = x;
+				else if (z->parent()->_left == z)
+					z->parent()->_left = x;
 				else
-					z->_parent->_right = x;
+					z->parent()->_right = x;
 				if (leftmost == z)
 				{
 					if (z->_right == 0) // z->_left must be null also
-						leftmost = z->_parent;
+						leftmost = z->parent();
 					// makes leftmost == _header if z == root
 					else
 						leftmost = rb_tree_node_base::minimum(x);
@@ -1043,45 +1675,45 @@ namespace ft
 				if (rightmost == z)
 				{
 					if (z->_left == 0) // z->_right must be null also
-						rightmost = z->_parent;
+						rightmost = z->parent();
 					// makes rightmost == _header if z == root
 					else // x == z->_left
 						rightmost = rb_tree_node_base::maximum(x);
 				}
 			}
-			if (y->_color != _red)
+			if (y->color() != _red)
 			{
-				while (x != root && (x == 0 || x->_color == _black))
+				while (x != root && (x == 0 || x->color() == _black))
 					if (x == x_parent->_left)
 					{
 						rb_tree_node_base *w = x_parent->_right;
-						if (w->_color == _red)
+						if (w->color() == _red)
 						{
-							w->_color = _black;
-							x_parent->_color = _red;
+							w->set_color(_black);
+							x_parent->set_color(_red);
 							rb_tree_rotate_left(x_parent, root);
 							w = x_parent->_right;
 						}
-						if ((w->_left == 0 || w->_left->_color == _black) &&
-							(w->_right == 0 || w->_right->_color == _black))
+						if ((w->_left == 0 || w->_left->color() == _black) &&
+							(w->_right == 0 || w->_right->color() == _black))
 						{
-							w->_color = _red;
+							w->set_color(_red);
 							x = x_parent;
-							x_parent = x_parent->_parent;
+							x_parent = x_parent->parent();
 						}
 						else
 						{
-							if (w->_right == 0 || w->_right->_color == _black)
+							if (w->_right == 0 || w->_right->color() == _black)
 							{
-								w->_left->_color = _black;
-								w->_color = _red;
+								w->_left->set_color(_black);
+								w->set_color(_red);
 								rb_tree_rotate_right(w, root);
 								w = x_parent->_right;
 							}
-							w->_color = x_parent->_color;
-							x_parent->_color = _black;
+							w->set_color(x_parent->color());
+							x_parent->set_color(_black);
 							if (w->_right)
-								w->_right->_color = _black;
+								w->_right->set_color(_black);
 							rb_tree_rotate_left(x_parent, root);
 							break;
 						}
@@ -1090,43 +1722,240 @@ namespace ft
 					{
 						// same as above, with _right <-> _left.
 						rb_tree_node_base *w = x_parent->_left;
-						if (w->_color == _red)
+						if (w->color() == _red)
 						{
-							w->_color = _black;
-							x_parent->_color = _red;
+							w->set_color(_black);
+							x_parent->set_color(_red);
 							rb_tree_rotate_right(x_parent, root);
 							w = x_parent->_left;
 						}
-						if ((w->_right == 0 || w->_right->_color == _black) &&
-							(w->_left == 0 || w->_left->_color == _black))
+						if ((w->_right == 0 || w->_right->color() == _black) &&
+							(w->_left == 0 || w->_left->color() == _black))
 						{
-							w->_color = _red;
+							w->set_color(_red);
 							x = x_parent;
-							x_parent = x_parent->_parent;
+							x_parent = x_parent->parent();
 						}
 						else
 						{
-							if (w->_left == 0 || w->_left->_color == _black)
+							if (w->_left == 0 || w->_left->color() == _black)
 							{
-								w->_right->_color = _black;
-								w->_color = _red;
+								w->_right->set_color(_black);
+								w->set_color(_red);
 								rb_tree_rotate_left(w, root);
 								w = x_parent->_left;
 							}
-							w->_color = x_parent->_color;
-							x_parent->_color = _black;
+							w->set_color(x_parent->color());
+							x_parent->set_color(_black);
 							if (w->_left)
-								w->_left->_color = _black;
+								w->_left->set_color(_black);
 							rb_tree_rotate_right(x_parent, root);
 							break;
 						}
 					}
 				if (x)
-					x->_color = _black;
+					x->set_color(_black);
 			}
 			return y;
 		} // rb_tree_rebalance_for_erase
 
+		/*************************************************************
+		 * Join and split
+
+		 * They work on detached subtrees: a black root whose parent is 0,
+			or no node at all, with its black height (the number of black
+			nodes on any path from the root down to a leaf).
+		 * join() links two subtrees and a node that falls between them in
+			O(1 + difference of their black heights), by walking down the
+			inner spine of the taller one, like an insertion.
+		 * split() cuts a subtree around a pivot in O(log n): the costs of
+			the joins along the way add up to the height of the subtree.
+		 *************************************************************/
+		static rb_subtree make_subtree(rb_tree_node_base *x, int height)
+		{
+			rb_subtree t;
+
+			t.root = x;
+			t.height = height;
+			return t;
+		}
+
+		static int black_height(const rb_tree_node_base *x)
+		{
+			int h = 0;
+
+			for (; x != 0; x = x->_left)
+				if (x->color() == _black)
+					++h;
+			return h;
+		}
+
+		// Cuts x from its parent. A red root is turned black, which adds
+		// one to its black height.
+		static rb_subtree detach(rb_tree_node_base *x, int height)
+		{
+			if (x != 0)
+			{
+				x->set_parent(0);
+				if (x->color() == _red)
+				{
+					x->set_color(_black);
+					++height;
+				}
+			}
+			return make_subtree(x, height);
+		}
+
+		static void link_children(rb_tree_node_base *x, rb_tree_node_base *l,
+								  rb_tree_node_base *r)
+		{
+			x->_left = l;
+			x->_right = r;
+			if (l != 0)
+				l->set_parent(x);
+			if (r != 0)
+				r->set_parent(x);
+			update_size(x);
+		}
+
+		// Every node of l comes before k, and every node of r after it
+		static rb_subtree join(rb_subtree l, rb_tree_node_base *k, rb_subtree r)
+		{
+			if (l.height == r.height)
+			{
+				link_children(k, l.root, r.root);
+				k->set_parent(0);
+				k->set_color(_black);
+				return make_subtree(k, l.height + 1);
+			}
+
+			const bool left_taller = l.height > r.height;
+			rb_subtree t = left_taller ? l : r;
+			const int target = left_taller ? r.height : l.height;
+			rb_tree_node_base *p = 0;
+			rb_tree_node_base *c = t.root;
+
+			// Down to the first black node with the black height of the
+			// shorter tree, which k replaces
+			for (int h = t.height; c != 0 && (c->color() == _red || h > target);)
+			{
+				if (c->color() == _black)
+					--h;
+				p = c;
+				c = left_taller ? c->_right : c->_left;
+			}
+			if (left_taller)
+			{
+				link_children(k, c, r.root);
+				p->_right = k;
+				update_path(p, 0, subtree_size(r.root) + 1);
+			}
+			else
+			{
+				link_children(k, l.root, c);
+				p->_left = k;
+				update_path(p, 0, subtree_size(l.root) + 1);
+			}
+			k->set_parent(p);
+			k->set_color(_red);
+			if (rb_tree_rebalance_after_insert(k, t.root))
+				++t.height;
+			return t;
+		}
+
+		// join() without a middle node: the first node of r takes its place
+		static rb_subtree join(rb_subtree l, rb_subtree r)
+		{
+			if (l.root == 0)
+				return r;
+			if (r.root == 0)
+				return l;
+
+			node_pivot first(minimum(r.root));
+			rb_subtree empty;
+			rb_tree_node_base *m;
+
+			split(r, first, empty, m, r);
+			return join(l, m, r);
+		}
+
+		// Splits t into the nodes before the pivot, in l, the pivot itself
+		// if it is in t, in m, and the nodes after it, in r. On the way
+		// down, where(x) tells if the pivot is on the left of x (< 0), on
+		// its right (> 0), or is x (0).
+		template <typename _Where>
+		static void split(rb_subtree t, _Where &where, rb_subtree &l,
+						  rb_tree_node_base *&m, rb_subtree &r)
+		{
+			rb_tree_node_base *const x = t.root;
+
+			if (x == 0)
+			{
+				l = r = make_subtree(0, 0);
+				m = 0;
+				return;
+			}
+
+			const int dir = where(x);
+			const rb_subtree xl = detach(x->_left, t.height - 1);
+			const rb_subtree xr = detach(x->_right, t.height - 1);
+
+			if (dir < 0)
+			{
+				split(xl, where, l, m, r);
+				r = join(r, x, xr);
+			}
+			else if (dir > 0)
+			{
+				split(xr, where, l, m, r);
+				l = join(xl, x, l);
+			}
+			else
+			{
+				l = xl;
+				m = x;
+				r = xr;
+			}
+		}
+
+		// The pivot is the node with key k, or where it would be
+		struct key_pivot
+		{
+			key_pivot(const Key &k, const Compare &comp) : _k(k), _comp(comp) {}
+
+			int operator()(const rb_tree_node_base *x) const
+			{
+				if (_comp(_k, key(x)))
+					return -1;
+				return _comp(key(x), _k) ? 1 : 0;
+			}
+
+			const Key		&_k;
+			const Compare	&_comp;
+		};
+
+		// The pivot is the node n, found through its ancestors
+		struct node_pivot
+		{
+			explicit node_pivot(rb_tree_node_base *n) : _depth(0)
+			{
+				for (; n != 0; n = n->parent())
+					_path[_depth++] = n;
+			}
+
+			int operator()(const rb_tree_node_base *x)
+			{
+				--_depth; // x is _path[_depth]
+				if (_depth == 0)
+					return 0;
+				return _path[_depth - 1] == x->_left ? -1 : 1;
+			}
+
+			// The height of a red-black tree is at most 2 log2(n + 1)
+			rb_tree_node_base	*_path[sizeof(std::size_t) * 16];
+			int					_depth;
+		};
+
 	}; // rb_tree class
 
 	template <typename _Key, typename _Val, typename _KeyOfValue,
@@ -1170,6 +1999,257 @@ namespace ft
 		return iterator(__z);
 	}
 
+	template <typename _Key, typename _Val, typename _KeyOfValue,
+			  typename _Compare, typename _Alloc>
+	template <typename _Fork>
+	void rb_tree<_Key, _Val, _KeyOfValue, _Compare, _Alloc>::
+		union_unique(rb_tree &other, _Fork &fork)
+	{
+		if (&other == this)
+			return;
+		// Nodes cannot move from a pool to another
+		if (!(get_node_allocator() == other.get_node_allocator()))
+		{
+			merge_unique(other);
+			other.clear();
+			return;
+		}
+
+		const size_type n = size() + other.size();
+		size_type dropped = 0;
+		rb_subtree t = take_tree();
+
+		t = union_of(t, other.take_tree(), other, dropped, fork);
+		give_tree(t, n - dropped);
+	}
+
+	template <typename _Key, typename _Val, typename _KeyOfValue,
+			  typename _Compare, typename _Alloc>
+	template <typename _Fork>
+	void rb_tree<_Key, _Val, _KeyOfValue, _Compare, _Alloc>::
+		intersect_unique(rb_tree &other, _Fork &fork)
+	{
+		if (&other == this)
+			return;
+
+		size_type kept = 0;
+		rb_subtree t = take_tree();
+
+		t = intersection_of(t, other.take_tree(), other, kept, fork);
+		give_tree(t, kept);
+	}
+
+	template <typename _Key, typename _Val, typename _KeyOfValue,
+			  typename _Compare, typename _Alloc>
+	template <typename _Fork>
+	void rb_tree<_Key, _Val, _KeyOfValue, _Compare, _Alloc>::
+		difference_unique(rb_tree &other, _Fork &fork)
+	{
+		if (&other == this)
+		{
+			clear();
+			return;
+		}
+
+		const size_type n = size();
+		size_type removed = 0;
+		rb_subtree t = take_tree();
+
+		t = difference_of(t, other.take_tree(), other, removed, fork);
+		give_tree(t, n - removed);
+	}
+
+	// The root of t1 splits t2; both halves are merged recursively, and
+	// joined back with the root in the middle.
+	template <typename _Key, typename _Val, typename _KeyOfValue,
+			  typename _Compare, typename _Alloc>
+	template <typename _Fork>
+	typename rb_tree<_Key, _Val, _KeyOfValue, _Compare, _Alloc>::rb_subtree
+	rb_tree<_Key, _Val, _KeyOfValue, _Compare, _Alloc>::
+		union_of(rb_subtree t1, rb_subtree t2, rb_tree &other, size_type &dropped,
+				 _Fork &fork)
+	{
+		if (t1.root == 0)
+			return t2;
+		if (t2.root == 0)
+			return t1;
+
+		base_ptr x = t1.root;
+		key_pivot at(key(x), _impl._key_compare);
+		rb_subtree l2, r2;
+		base_ptr m;
+
+		split(t2, at, l2, m, r2);
+		if (m != 0)
+		{
+			other.drop_node(static_cast<link_type>(m));
+			++dropped;
+		}
+
+		const rb_subtree l1 = detach(x->_left, t1.height - 1);
+		const rb_subtree r1 = detach(x->_right, t1.height - 1);
+		rb_subtree l, r;
+
+		fork_halves(&rb_tree::union_of<_Fork>, l1, l2, r1, r2, other, dropped,
+					fork, l, r);
+		return join(l, x, r);
+	}
+
+	template <typename _Key, typename _Val, typename _KeyOfValue,
+			  typename _Compare, typename _Alloc>
+	template <typename _Fork>
+	typename rb_tree<_Key, _Val, _KeyOfValue, _Compare, _Alloc>::rb_subtree
+	rb_tree<_Key, _Val, _KeyOfValue, _Compare, _Alloc>::
+		intersection_of(rb_subtree t1, rb_subtree t2, rb_tree &other,
+						size_type &kept, _Fork &fork)
+	{
+		if (t1.root == 0 || t2.root == 0)
+		{
+			drop_subtree(t1.root);
+			other.drop_subtree(t2.root);
+			return make_subtree(0, 0);
+		}
+
+		base_ptr x = t1.root;
+		key_pivot at(key(x), _impl._key_compare);
+		rb_subtree l2, r2;
+		base_ptr m;
+
+		split(t2, at, l2, m, r2);
+
+		const rb_subtree l1 = detach(x->_left, t1.height - 1);
+		const rb_subtree r1 = detach(x->_right, t1.height - 1);
+		rb_subtree l, r;
+
+		fork_halves(&rb_tree::intersection_of<_Fork>, l1, l2, r1, r2, other, kept,
+					fork, l, r);
+
+		if (m == 0)
+		{
+			drop_node(static_cast<link_type>(x));
+			return join(l, r);
+		}
+		other.drop_node(static_cast<link_type>(m));
+		++kept;
+		return join(l, x, r);
+	}
+
+	// Here the root of t2 splits t1, as it is dropped in any case
+	template <typename _Key, typename _Val, typename _KeyOfValue,
+			  typename _Compare, typename _Alloc>
+	template <typename _Fork>
+	typename rb_tree<_Key, _Val, _KeyOfValue, _Compare, _Alloc>::rb_subtree
+	rb_tree<_Key, _Val, _KeyOfValue, _Compare, _Alloc>::
+		difference_of(rb_subtree t1, rb_subtree t2, rb_tree &other,
+					  size_type &removed, _Fork &fork)
+	{
+		if (t1.root == 0)
+		{
+			other.drop_subtree(t2.root);
+			return t1;
+		}
+		if (t2.root == 0)
+			return t1;
+
+		base_ptr y = t2.root;
+		key_pivot at(key(y), _impl._key_compare);
+		rb_subtree l1, r1;
+		base_ptr m;
+
+		split(t1, at, l1, m, r1);
+		if (m != 0)
+		{
+			drop_node(static_cast<link_type>(m));
+			++removed;
+		}
+
+		const rb_subtree l2 = detach(y->_left, t2.height - 1);
+		const rb_subtree r2 = detach(y->_right, t2.height - 1);
+
+		other.drop_node(static_cast<link_type>(y));
+
+		rb_subtree l, r;
+
+		fork_halves(&rb_tree::difference_of<_Fork>, l1, l2, r1, r2, other, removed,
+					fork, l, r);
+		return join(l, r);
+	}
+
+	template <typename _Key, typename _Val, typename _KeyOfValue,
+			  typename _Compare, typename _Alloc>
+	typename rb_tree<_Key, _Val, _KeyOfValue, _Compare, _Alloc>::iterator
+	rb_tree<_Key, _Val, _KeyOfValue, _Compare, _Alloc>::
+		insert_node(base_ptr x, base_ptr p, link_type z)
+	{
+		bool __insert_left = (x != 0 || p == _end()
+			|| _impl._key_compare(key(z), key(p)));
+
+		rb_tree_insert_and_rebalance(__insert_left, z, p, _impl._header);
+		++_impl._node_count;
+		return iterator(z);
+	}
+
+	// Nodes are relinked when both trees share their allocator. Otherwise
+	// (two pools) the value is copied and erased from src.
+	template <typename _Key, typename _Val, typename _KeyOfValue,
+			  typename _Compare, typename _Alloc>
+	void rb_tree<_Key, _Val, _KeyOfValue, _Compare, _Alloc>::
+		merge_unique(rb_tree &src)
+	{
+		if (&src == this)
+			return;
+
+		const bool relink = get_node_allocator() == src.get_node_allocator();
+		alloc_node an(*this);
+
+		for (iterator it = src.begin(); it != src.end();)
+		{
+			iterator next = it;
+			pair<base_ptr, base_ptr> res = get_insert_unique_pos(_KeyOfValue()(*it));
+
+			++next;
+			if (res.second)
+			{
+				if (relink)
+					insert_node(res.first, res.second, src.unlink_node(it));
+				else
+				{
+					insert_(res.first, res.second, *it, an);
+					src.erase_aux(it);
+				}
+			}
+			it = next;
+		}
+	}
+
+	template <typename _Key, typename _Val, typename _KeyOfValue,
+			  typename _Compare, typename _Alloc>
+	void rb_tree<_Key, _Val, _KeyOfValue, _Compare, _Alloc>::
+		merge_equal(rb_tree &src)
+	{
+		if (&src == this)
+			return;
+
+		const bool relink = get_node_allocator() == src.get_node_allocator();
+		alloc_node an(*this);
+
+		for (iterator it = src.begin(); it != src.end();)
+		{
+			iterator next = it;
+			pair<base_ptr, base_ptr> res = get_insert_equal_pos(_KeyOfValue()(*it));
+
+			++next;
+			if (relink)
+				insert_node(res.first, res.second, src.unlink_node(it));
+			else
+			{
+				insert_(res.first, res.second, *it, an);
+				src.erase_aux(it);
+			}
+			it = next;
+		}
+	}
+
 	template <typename _Key, typename _Val, typename _KeyOfValue,
 			  typename _Compare, typename _Alloc>
 	typename rb_tree<_Key, _Val, _KeyOfValue, _Compare, _Alloc>::iterator
@@ -1179,7 +2259,7 @@ namespace ft
 		bool __insert_left = (p == _end()
 			|| !_impl._key_compare(key(p), _KeyOfValue()(v)));
 
-		link_type __z = _create_node(v);
+		link_type __z = create_node(v);
 
 		rb_tree_insert_and_rebalance(__insert_left, __z, p,
 									 this->_impl._header);
@@ -1199,9 +2279,9 @@ namespace ft
 		while (x != 0)
 		{
 			y = x;
-			x = !_impl._key_compare(key(x), _KeyOfValue()(v)) ? _(x) : right(x);
+			x = !_impl._key_compare(key(x), _KeyOfValue()(v)) ? left(x) : right(x);
 		}
-		return _insert_lower(y, v);
+		return insert_lower(y, v);
 	}
 
 	template <typename _Key, typename _Val, typename _KoV,
@@ -1213,7 +2293,7 @@ namespace ft
 	{
 		// Structural copy. x and p must be non-null.
 		link_type __top = clone_node<_MoveValues>(x, node_gen);
-		__top->_parent = p;
+		__top->set_parent(p);
 
 		try
 		{
@@ -1227,7 +2307,7 @@ namespace ft
 			{
 				link_type y = clone_node<_MoveValues>(x, node_gen);
 				p->_left = y;
-				y->_parent = p;
+				y->set_parent(p);
 				if (x->_right)
 					y->_right = copy<_MoveValues>(right(x),
 												  y, node_gen);
@@ -1258,10 +2338,11 @@ namespace ft
 
 	template <typename _Key, typename _Val, typename _KeyOfValue,
 			  typename _Compare, typename _Alloc>
+	template <typename _Kt>
 	typename rb_tree<_Key, _Val, _KeyOfValue, _Compare, _Alloc>::iterator
 	rb_tree<_Key, _Val, _KeyOfValue, _Compare, _Alloc>::
 		lower_bound(link_type x, base_ptr y,
-					const _Key &k)
+					const _Kt &k)
 	{
 		while (x != 0)
 			if (!_impl._key_compare(key(x), k))
@@ -1273,10 +2354,11 @@ namespace ft
 
 	template <typename _Key, typename _Val, typename _KeyOfValue,
 			  typename _Compare, typename _Alloc>
+	template <typename _Kt>
 	typename rb_tree<_Key, _Val, _KeyOfValue, _Compare, _Alloc>::const_iterator
 	rb_tree<_Key, _Val, _KeyOfValue, _Compare, _Alloc>::
 		lower_bound(const_link_type x, const_base_ptr y,
-					const _Key &k) const
+					const _Kt &k) const
 	{
 		while (x != 0)
 			if (!_impl._key_compare(key(x), k))
@@ -1288,9 +2370,10 @@ namespace ft
 
 	template <typename _Key, typename _Val, typename _KeyOfValue,
 			  typename _Compare, typename _Alloc>
+	template <typename _Kt>
 	typename rb_tree<_Key, _Val, _KeyOfValue, _Compare, _Alloc>::iterator
 	rb_tree<_Key, _Val, _KeyOfValue, _Compare, _Alloc>::
-		upper_bound(link_type x, base_ptr y, const _Key &k)
+		upper_bound(link_type x, base_ptr y, const _Kt &k)
 	{
 		while (x != 0)
 			if (_impl._key_compare(k, key(x)))
@@ -1302,10 +2385,11 @@ namespace ft
 
 	template <typename _Key, typename _Val, typename _KeyOfValue,
 			  typename _Compare, typename _Alloc>
+	template <typename _Kt>
 	typename rb_tree<_Key, _Val, _KeyOfValue, _Compare, _Alloc>::const_iterator
 	rb_tree<_Key, _Val, _KeyOfValue, _Compare, _Alloc>::
 		upper_bound(const_link_type x, const_base_ptr y,
-					const _Key &k) const
+					const _Kt &k) const
 	{
 		while (x != 0)
 			if (_impl._key_compare(k, key(x)))
@@ -1317,11 +2401,12 @@ namespace ft
 
 	template <typename _Key, typename _Val, typename _KeyOfValue,
 			  typename _Compare, typename _Alloc>
+	template <typename _Kt>
 	pair<typename rb_tree<_Key, _Val, _KeyOfValue,
 						  _Compare, _Alloc>::iterator,
 		 typename rb_tree<_Key, _Val, _KeyOfValue, _Compare, _Alloc>::iterator>
 	rb_tree<_Key, _Val, _KeyOfValue, _Compare, _Alloc>::
-		equal_range(const _Key &k)
+		equal_range_(const _Kt &k)
 	{
 		link_type x = _begin();
 		base_ptr y = _end();
@@ -1347,12 +2432,13 @@ namespace ft
 
 	template <typename _Key, typename _Val, typename _KeyOfValue,
 			  typename _Compare, typename _Alloc>
+	template <typename _Kt>
 	pair<typename rb_tree<_Key, _Val, _KeyOfValue,
 						  _Compare, _Alloc>::const_iterator,
 		 typename rb_tree<_Key, _Val, _KeyOfValue,
 						  _Compare, _Alloc>::const_iterator>
 	rb_tree<_Key, _Val, _KeyOfValue, _Compare, _Alloc>::
-		equal_range(const _Key &k) const
+		equal_range_(const _Kt &k) const
 	{
 		const_link_type x = _begin();
 		const_base_ptr y = _end();
@@ -1395,12 +2481,14 @@ namespace ft
 			ft::swap(leftmost(), __t.leftmost());
 			ft::swap(rightmost(), __t.rightmost());
 
-			root()->_parent = _end();
-			__t.root()->_parent = __t._end();
+			root()->set_parent(_end());
+			__t.root()->set_parent(__t._end());
 			ft::swap(this->_impl._node_count, __t._impl._node_count);
 		}
 		// No need to swap header's color as it does not change.
 		ft::swap(this->_impl._key_compare, __t._impl._key_compare);
+		// The nodes now belong to the other tree, and so must their memory.
+		ft::swap(get_node_allocator(), __t.get_node_allocator());
 	}
 
 	template <typename _Key, typename _Val, typename _KeyOfValue,
@@ -1480,7 +2568,7 @@ namespace ft
 	{
 		pair<base_ptr, base_ptr> res = get_insert_equal_pos(_KeyOfValue()(v));
 		alloc_node an(*this);
-		return _insert_(res.first, res.second, v, an);
+		return insert_(res.first, res.second, v, an);
 	}
 
 	template <typename _Key, typename _Val, typename _KeyOfValue,
@@ -1713,6 +2801,267 @@ namespace ft
 		return insert_equal_lower(v);
 	}
 
+	/*************************************************************
+	 * Bulk construction
+
+	 * The tree is built from the part of the range that is sorted,
+		which ends at the first element out of order. This element is
+		returned, for the caller to insert it along with the rest of
+		the range.
+
+	 * A forward range is checked first and its nodes are linked as they
+		are created. The elements of an input range are only read once:
+		they are chained, skipping the duplicate keys, and linked into
+		a tree afterwards.
+	*************************************************************/
+	template <typename _Key, typename _Val, typename _KeyOfValue,
+			  typename _Compare, typename _Alloc>
+	template <typename _InputIterator>
+	_InputIterator rb_tree<_Key, _Val, _KeyOfValue, _Compare, _Alloc>::
+		build_range_unique(_InputIterator first, _InputIterator last,
+						   std::input_iterator_tag)
+	{
+		link_type head = 0;
+		link_type tail = 0;
+		size_type n = 0;
+
+		try
+		{
+			for (; first != last; ++first)
+			{
+				const value_type &v = *first;
+
+				if (tail != 0
+					&& !_impl._key_compare(key(tail), _KeyOfValue()(v)))
+				{
+					if (_impl._key_compare(_KeyOfValue()(v), key(tail)))
+						break;
+					continue;
+				}
+				append_node(create_node(v), head, tail);
+				++n;
+			}
+		}
+		catch (...)
+		{ drop_chain(head); throw; }
+
+		chained_nodes nodes(head);
+
+		link_tree(nodes, n);
+		return first;
+	}
+
+	template <typename _Key, typename _Val, typename _KeyOfValue,
+			  typename _Compare, typename _Alloc>
+	template <typename _ForwardIterator>
+	_ForwardIterator rb_tree<_Key, _Val, _KeyOfValue, _Compare, _Alloc>::
+		build_range_unique(_ForwardIterator first, _ForwardIterator last,
+						   std::forward_iterator_tag)
+	{
+		_ForwardIterator sorted_end = first;
+		size_type n = 0;
+
+		if (sorted_end != last)
+		{
+			_ForwardIterator prev = sorted_end;
+
+			for (++sorted_end, ++n; sorted_end != last; ++sorted_end, ++n)
+			{
+				if (!_impl._key_compare(_KeyOfValue()(*prev),
+										_KeyOfValue()(*sorted_end)))
+					break;
+				prev = sorted_end;
+			}
+		}
+
+		range_nodes<_ForwardIterator> nodes(*this, first);
+
+		link_tree(nodes, n);
+		return sorted_end;
+	}
+
+	// The sorted part of the range ends at the first element less than
+	// the one before: equivalent elements are all kept, in order.
+	template <typename _Key, typename _Val, typename _KeyOfValue,
+			  typename _Compare, typename _Alloc>
+	template <typename _InputIterator>
+	_InputIterator rb_tree<_Key, _Val, _KeyOfValue, _Compare, _Alloc>::
+		build_range_equal(_InputIterator first, _InputIterator last,
+						  std::input_iterator_tag)
+	{
+		link_type head = 0;
+		link_type tail = 0;
+		size_type n = 0;
+
+		try
+		{
+			for (; first != last; ++first, ++n)
+			{
+				const value_type &v = *first;
+
+				if (tail != 0
+					&& _impl._key_compare(_KeyOfValue()(v), key(tail)))
+					break;
+				append_node(create_node(v), head, tail);
+			}
+		}
+		catch (...)
+		{ drop_chain(head); throw; }
+
+		chained_nodes nodes(head);
+
+		link_tree(nodes, n);
+		return first;
+	}
+
+	template <typename _Key, typename _Val, typename _KeyOfValue,
+			  typename _Compare, typename _Alloc>
+	template <typename _ForwardIterator>
+	_ForwardIterator rb_tree<_Key, _Val, _KeyOfValue, _Compare, _Alloc>::
+		build_range_equal(_ForwardIterator first, _ForwardIterator last,
+						  std::forward_iterator_tag)
+	{
+		_ForwardIterator sorted_end = first;
+		size_type n = 0;
+
+		if (sorted_end != last)
+		{
+			_ForwardIterator prev = sorted_end;
+
+			for (++sorted_end, ++n; sorted_end != last; ++sorted_end, ++n)
+			{
+				if (_impl._key_compare(_KeyOfValue()(*sorted_end),
+									   _KeyOfValue()(*prev)))
+					break;
+				prev = sorted_end;
+			}
+		}
+
+		range_nodes<_ForwardIterator> nodes(*this, first);
+
+		link_tree(nodes, n);
+		return sorted_end;
+	}
+
+	template <typename _Key, typename _Val, typename _KeyOfValue,
+			  typename _Compare, typename _Alloc>
+	template <typename _InputIterator>
+	void rb_tree<_Key, _Val, _KeyOfValue, _Compare, _Alloc>::
+		build_sorted(_InputIterator first, _InputIterator last,
+					 std::input_iterator_tag)
+	{
+		link_type head = 0;
+		link_type tail = 0;
+		size_type n = 0;
+
+		try
+		{
+			for (; first != last; ++first, ++n)
+				append_node(create_node(*first), head, tail);
+		}
+		catch (...)
+		{ drop_chain(head); throw; }
+
+		chained_nodes nodes(head);
+
+		link_tree(nodes, n);
+	}
+
+	// With subtrees split evenly, every level of the tree is full but the
+	// last one, which starts at depth log2(n + 1) when it is incomplete.
+	// Coloring this last level red and all the others black gives every
+	// path the same number of black nodes.
+	template <typename _Key, typename _Val, typename _KeyOfValue,
+			  typename _Compare, typename _Alloc>
+	template <typename _NodeSource>
+	void rb_tree<_Key, _Val, _KeyOfValue, _Compare, _Alloc>::
+		link_tree(_NodeSource &nodes, size_type n)
+	{
+		if (n == 0)
+			return;
+
+		size_type red_depth = 0;
+
+		for (size_type m = n + 1; m > 1; m >>= 1)
+			++red_depth;
+
+		link_type top = build_balanced(nodes, n, 0, red_depth);
+
+		top->set_parent(_end());
+		root() = top;
+		leftmost() = minimum(top);
+		rightmost() = maximum(top);
+		_impl._node_count = n;
+	}
+
+	// Builds a subtree out of the next n nodes, in order.
+	// If a node cannot be created, the nodes already linked are erased.
+	template <typename _Key, typename _Val, typename _KeyOfValue,
+			  typename _Compare, typename _Alloc>
+	template <typename _NodeSource>
+	typename rb_tree<_Key, _Val, _KeyOfValue, _Compare, _Alloc>::link_type
+	rb_tree<_Key, _Val, _KeyOfValue, _Compare, _Alloc>::
+		build_balanced(_NodeSource &nodes, size_type n,
+					   size_type depth, size_type red_depth)
+	{
+		if (n == 0)
+			return 0;
+
+		link_type l = build_balanced(nodes, (n - 1) / 2, depth + 1, red_depth);
+		link_type x;
+
+		try
+		{ x = nodes(); }
+		catch (...)
+		{ erase(l); throw; }
+
+		x->set_color(depth == red_depth ? _red : _black);
+		x->_left = l;
+		x->_right = 0;
+		if (l != 0)
+			l->set_parent(x);
+
+		link_type r;
+
+		try
+		{ r = build_balanced(nodes, n / 2, depth + 1, red_depth); }
+		catch (...)
+		{ erase(x); throw; }
+
+		x->_right = r;
+		if (r != 0)
+			r->set_parent(x);
+		update_size(x);
+		return x;
+	}
+
+	template <typename _Key, typename _Val, typename _KeyOfValue,
+			  typename _Compare, typename _Alloc>
+	void rb_tree<_Key, _Val, _KeyOfValue, _Compare, _Alloc>::
+		append_node(link_type x, link_type &head, link_type &tail)
+	{
+		x->_right = 0;
+		if (tail != 0)
+			tail->_right = x;
+		else
+			head = x;
+		tail = x;
+	}
+
+	template <typename _Key, typename _Val, typename _KeyOfValue,
+			  typename _Compare, typename _Alloc>
+	void rb_tree<_Key, _Val, _KeyOfValue, _Compare, _Alloc>::
+		drop_chain(link_type chain)
+	{
+		while (chain != 0)
+		{
+			link_type next = right(chain);
+
+			drop_node(chain);
+			chain = next;
+		}
+	}
+
 	template <typename _Key, typename _Val, typename _KeyOfValue,
 			  typename _Compare, typename _Alloc>
 	void rb_tree<_Key, _Val, _KeyOfValue, _Compare, _Alloc>::
@@ -1745,10 +3094,23 @@ namespace ft
 		erase_aux(iterator first, iterator last)
 	{
 		if (first == begin() && last == end())
+		{
 			clear();
-		else
-			while (first != last)
-				erase_aux(first++);
+			return;
+		}
+
+		// A few nodes are erased one by one, more are cut out at once
+		iterator it = first;
+
+		for (int n = 0; it != last; ++it, ++n)
+			if (n == 16)
+			{
+				erase_range(const_cast<base_ptr>(first._node),
+							const_cast<base_ptr>(last._node));
+				return;
+			}
+		while (first != last)
+			erase_aux(first++);
 	}
 
 	template <typename _Key, typename _Val, typename _KeyOfValue,
@@ -1757,10 +3119,55 @@ namespace ft
 		erase_aux(const_iterator first, const_iterator last)
 	{
 		if (first == begin() && last == end())
+		{
 			clear();
+			return;
+		}
+
+		// A few nodes are erased one by one, more are cut out at once
+		const_iterator it = first;
+
+		for (int n = 0; it != last; ++it, ++n)
+			if (n == 16)
+			{
+				erase_range(const_cast<base_ptr>(first._node),
+							const_cast<base_ptr>(last._node));
+				return;
+			}
+		while (first != last)
+			erase_aux(first++);
+	}
+
+	// Two splits cut [first, last) out, in O(log n), and a join puts the
+	// other nodes back together.
+	template <typename _Key, typename _Val, typename _KeyOfValue,
+			  typename _Compare, typename _Alloc>
+	void rb_tree<_Key, _Val, _KeyOfValue, _Compare, _Alloc>::
+		erase_range(base_ptr first, base_ptr last)
+	{
+		const size_type n = size();
+		const bool to_end = last == _end();
+		rb_subtree t = take_tree();
+		rb_subtree before, range, after;
+		base_ptr f, l = 0;
+
+		if (to_end)
+			after = make_subtree(0, 0);
 		else
-			while (first != last)
-				erase_aux(first++);
+		{
+			node_pivot at_last(last);
+
+			split(t, at_last, t, l, after);
+		}
+
+		node_pivot at_first(first);
+
+		split(t, at_first, before, f, range);
+
+		const size_type erased = drop_subtree(range.root) + 1;
+
+		drop_node(static_cast<link_type>(f));
+		give_tree(to_end ? before : join(before, l, after), n - erased);
 	}
 
 	template <typename _Key, typename _Val, typename _KeyOfValue,
@@ -1803,10 +3210,86 @@ namespace ft
 		count(const _Key &k) const
 	{
 		pair<const_iterator, const_iterator> p = equal_range(k);
+#ifdef FT_RB_TREE_ORDER_STATISTICS
+		const size_type __n = distance(p.first, p.second);
+#else
 		const size_type __n = std::distance(p.first, p.second);
+#endif
 		return __n;
 	}
 
+#ifdef FT_RB_TREE_ORDER_STATISTICS
+	template <typename _Key, typename _Val, typename _KeyOfValue,
+			  typename _Compare, typename _Alloc>
+	typename rb_tree<_Key, _Val, _KeyOfValue, _Compare, _Alloc>::const_base_ptr
+	rb_tree<_Key, _Val, _KeyOfValue, _Compare, _Alloc>::
+		select_node(size_type k) const
+	{
+		if (k >= size())
+			return _end();
+
+		const_base_ptr x = root();
+
+		for (;;)
+		{
+			const size_type left_size = subtree_size(x->_left);
+
+			if (k < left_size)
+				x = x->_left;
+			else if (k == left_size)
+				return x;
+			else
+			{
+				k -= left_size + 1;
+				x = x->_right;
+			}
+		}
+	}
+
+	template <typename _Key, typename _Val, typename _KeyOfValue,
+			  typename _Compare, typename _Alloc>
+	typename rb_tree<_Key, _Val, _KeyOfValue, _Compare, _Alloc>::size_type
+	rb_tree<_Key, _Val, _KeyOfValue, _Compare, _Alloc>::
+		rank(const _Key &k) const
+	{
+		const_base_ptr x = root();
+		size_type r = 0;
+
+		while (x != 0)
+		{
+			if (!_impl._key_compare(key(x), k))
+				x = x->_left;
+			else
+			{
+				r += subtree_size(x->_left) + 1;
+				x = x->_right;
+			}
+		}
+		return r;
+	}
+
+	// Every node on the way up that pos is on the right of comes before
+	// it, along with its left subtree.
+	template <typename _Key, typename _Val, typename _KeyOfValue,
+			  typename _Compare, typename _Alloc>
+	typename rb_tree<_Key, _Val, _KeyOfValue, _Compare, _Alloc>::size_type
+	rb_tree<_Key, _Val, _KeyOfValue, _Compare, _Alloc>::
+		rank(const_iterator pos) const
+	{
+		const_base_ptr x = pos._node;
+
+		if (x == _end())
+			return size();
+
+		size_type r = subtree_size(x->_left);
+
+		for (; x != root(); x = x->parent())
+			if (x == x->parent()->_right)
+				r += subtree_size(x->parent()->_left) + 1;
+		return r;
+	}
+#endif
+
 }; // namespace ft
 
 #endif /* _FT_TREE_HPP */
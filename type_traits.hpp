@@ -7,6 +7,10 @@
 	2. integral_constant
 	3. is_integral
 	4. conditional
+	5. is_same
+	6. is_trivially_copyable
+	7. is_trivially_relocatable
+	8. has_is_transparent
 *************************************************************/
 
 namespace ft {
@@ -89,6 +93,93 @@ namespace ft {
 	struct conditional<false, _Iftrue, _Iffalse>
 	{ typedef _Iffalse type; };
 
+
+	/*************************************************************
+	 * is_same
+
+	 * Provides the member constant value which is equal to true
+		if T and U name the same type. Otherwise value is false.
+	*************************************************************/
+	template <class T, class U>
+	struct is_same : public ft::false_type {};
+
+	template <class T>
+	struct is_same<T, T> : public ft::true_type {};
+
+
+	/*************************************************************
+	 * is_trivially_copyable
+
+	 * Checks whether T can be copied with a plain memory copy
+		(std::memcpy/std::memmove) instead of its copy constructor,
+		and destroyed without calling its destructor.
+	 * C++98 has no way of telling it for class types, so we rely on
+		the compiler builtin shared by gcc and clang. Otherwise only
+		integral, floating point and pointer types are reported.
+	*************************************************************/
+# if defined(__GNUC__) || defined(__clang__)
+	template <class T>
+	struct is_trivially_copyable
+		: public ft::integral_constant<bool, __is_trivially_copyable(T)> {};
+# else
+	template <class T>
+	struct is_trivially_copyable : public ft::is_integral<T> {};
+
+	template <> struct is_trivially_copyable<float>			: public ft::true_type {};
+	template <> struct is_trivially_copyable<double>		: public ft::true_type {};
+	template <> struct is_trivially_copyable<long double>	: public ft::true_type {};
+	template <class T> struct is_trivially_copyable<T*>		: public ft::true_type {};
+# endif
+
+
+	/*************************************************************
+	 * is_trivially_relocatable
+
+	 * Checks whether an object of type T can be moved to another
+		address with a plain memory copy, the old one being dropped
+		without calling its destructor.
+	 * This only needs a trivial copy constructor and destructor, so it
+		holds for ft::pair<const Key, T> of trivial types, which cannot
+		be assigned and thus is not trivially copyable.
+	*************************************************************/
+# if defined(__clang__)
+	template <class T>
+	struct is_trivially_relocatable
+		: public ft::integral_constant<bool,
+			__is_trivially_constructible(T, const T &)
+			&& __is_trivially_destructible(T)> {};
+# elif defined(__GNUC__)
+	template <class T>
+	struct is_trivially_relocatable
+		: public ft::integral_constant<bool,
+			__has_trivial_copy(T) && __has_trivial_destructor(T)> {};
+# else
+	template <class T>
+	struct is_trivially_relocatable : public ft::is_trivially_copyable<T> {};
+# endif
+
+
+	/*************************************************************
+	 * has_is_transparent
+
+	 * Checks whether the comparison object Compare declares the member
+		type is_transparent, which lets the associative containers look
+		up keys with any type it can compare to them.
+	 * K is the type of the argument of the lookup, only there to make
+		the condition depend on it, so that the lookup templates are
+		discarded when Compare is not transparent.
+	*************************************************************/
+	template <class T>
+	struct void_type { typedef void type; };
+
+	template <class Compare, class K, class = void>
+	struct has_is_transparent : public ft::false_type {};
+
+	template <class Compare, class K>
+	struct has_is_transparent<Compare, K,
+		typename ft::void_type<typename Compare::is_transparent>::type>
+		: public ft::true_type {};
+
 } // namespace ft
 
 #endif /* _FT_TYPE_TRAITS_HPP */
@@ -0,0 +1,277 @@
+#ifndef _FT_UNORDERED_MAP_HPP
+#define _FT_UNORDERED_MAP_HPP
+
+#include <functional>
+#include <memory>
+#include <stdexcept>
+
+#include "algorithm.hpp"
+#include "functional.hpp"
+#include "type_traits.hpp"
+#include "utility.hpp"
+#include "hashtable.hpp"
+
+namespace ft
+{
+
+	/*************************************************************
+	 * unordered_map
+
+	 * A map stored in an open addressing hash table (see hashtable.hpp),
+		with the interface of ft::map minus the ordered operations.
+	 * Lookups take constant time on average, but the pairs are visited
+		in no particular order, and an insertion that grows the table
+		invalidates all the iterators into the map.
+	*************************************************************/
+	template <typename Key, typename T, typename Hash = ft::hash<Key>,
+			  typename Pred = std::equal_to<Key>,
+			  typename Alloc = std::allocator<ft::pair<const Key, T> > >
+	class unordered_map
+	{
+
+	public:
+		/*************************************************************
+		 * Types
+		 *************************************************************/
+		typedef Key										key_type;
+		typedef T										mapped_type;
+		typedef ft::pair<const key_type, mapped_type>	value_type;
+		typedef Hash									hasher;
+		typedef Pred									key_equal;
+		typedef Alloc 									allocator_type;
+
+		typedef typename __gnu_cxx::__alloc_traits<Alloc>::template rebind<value_type>
+			::other							pair_alloc_type;
+
+		typedef hashtable<key_type, value_type, std::_Select1st<value_type>,
+			hasher, key_equal, pair_alloc_type>	rep_type;
+
+		/// The actual hash table.
+		rep_type _h;
+
+		typedef __gnu_cxx::__alloc_traits<pair_alloc_type>	alloc_traits;
+
+	public:
+		typedef typename alloc_traits::pointer pointer;
+		typedef typename alloc_traits::const_pointer const_pointer;
+		typedef typename alloc_traits::reference reference;
+		typedef typename alloc_traits::const_reference const_reference;
+		typedef typename rep_type::iterator iterator;
+		typedef typename rep_type::const_iterator const_iterator;
+		typedef typename rep_type::size_type size_type;
+		typedef typename rep_type::difference_type difference_type;
+
+		/*************************************************************
+		 * Construct/Copy/Destroy
+		 *************************************************************/
+		// Default constructor creates no elements, and allocates nothing
+		unordered_map() : _h() {}
+
+		// n: minimal number of elements the map can hold before it grows
+		explicit unordered_map(size_type n, const hasher &hf = hasher(),
+							   const key_equal &eq = key_equal(),
+							   const allocator_type &alloc = allocator_type())
+			: _h(n, hf, eq, pair_alloc_type(alloc)) {}
+
+		unordered_map(const unordered_map &x) : _h(x._h) {}
+
+		// Builds a map from a range
+		// Create a map consisting of copies of the elements from
+		// [first,last). Only the first pair with a given key is inserted.
+		template <typename InputIterator>
+		unordered_map(InputIterator first, InputIterator last) : _h()
+		{ _h.insert_range_unique(first, last); }
+
+		template <typename InputIterator>
+		unordered_map(InputIterator first, InputIterator last, size_type n,
+					  const hasher &hf = hasher(), const key_equal &eq = key_equal(),
+					  const allocator_type &alloc = allocator_type())
+			: _h(n, hf, eq, pair_alloc_type(alloc))
+		{ _h.insert_range_unique(first, last); }
+
+		/*************************************************************
+		 *  Assignment operator
+		 *************************************************************/
+		unordered_map &operator=(const unordered_map &x)
+		{ _h = x._h; return *this; }
+
+		/*************************************************************
+		 *  Get a copy of the memory allocation object
+		 *************************************************************/
+		allocator_type get_allocator() const
+		{ return allocator_type(_h.get_allocator()); }
+
+		/*************************************************************
+		 * Iterators
+		 *************************************************************/
+		// Return a iterator that points to the first pair in the map.
+		// Iteration is done in no particular order.
+		iterator begin(void) { return _h.begin(); }
+		const_iterator begin(void) const { return _h.begin(); }
+
+		// Return a iterator that points to the one past the last pair in the map.
+		iterator end(void) { return _h.end(); }
+		const_iterator end(void) const { return _h.end(); }
+
+		/*************************************************************
+		 * Capacity
+		 *************************************************************/
+		// Returns true if the map is empty. (Thus begin() would equal end().)
+		bool empty() const { return _h.empty(); }
+		// Returns the size of the map
+		size_type size() const { return _h.size(); }
+		// Returns the maximum size of the map
+		size_type max_size() const { return _h.max_size(); }
+
+		/*************************************************************
+		 * Element access
+		 *************************************************************/
+		// Allows for easy lookup with the subscript ( [] )
+		// operator.  Returns data associated with the key specified in
+		// subscript.  If the key does not exist, a pair with that key
+		// is created using default values, which is then returned.
+		mapped_type &operator[](const key_type &k)
+		{
+			iterator i = find(k);
+
+			if (i == end())
+				i = insert(value_type(k, mapped_type())).first;
+			return (*i).second;
+		}
+
+		// Access to %map data.
+		// k  The key for which data should be retrieved.
+		//  A reference to the data whose key is equivalent to k, if
+		//  such a data is present in the map.
+		// Throws std::out_of_range if no such data is present.
+		mapped_type &at(const key_type &k)
+		{
+			iterator i = find(k);
+			if (i == end())
+				std::__throw_out_of_range(__N("unordered_map::at"));
+			return (*i).second;
+		}
+
+		const mapped_type &at(const key_type &k) const
+		{
+			const_iterator i = find(k);
+			if (i == end())
+				std::__throw_out_of_range(__N("unordered_map::at"));
+			return (*i).second;
+		}
+
+		/*************************************************************
+		 * Modifiers
+		 *************************************************************/
+		// Attempts to insert a ft::pair into the map.
+		// returns a pair, of which the first element is an iterator that
+		//  points to the possibly inserted pair, and the second is
+		//  a bool that is true if the pair was actually inserted.
+		ft::pair<iterator, bool> insert(const value_type &x)
+		{ return _h.insert_unique(x); }
+
+		// The hint is ignored: it is only there for the interface of map.
+		iterator insert(const_iterator position, const value_type &x)
+		{ (void)position; return _h.insert_unique(x).first; }
+
+		// Template function that attempts to insert a range of elements
+		template <typename InputIterator>
+		void insert(InputIterator first, InputIterator last)
+		{ _h.insert_range_unique(first, last); }
+
+		// Erases the pair pointed to by the given iterator. The other
+		// iterators stay valid.
+		void erase(const_iterator position) { _h.erase(position); }
+
+		// Erases elements according to the provided key
+		size_type erase(const key_type &x) { return _h.erase(x); }
+
+		// Erases a [first,last) range of elements from a map
+		void erase(const_iterator first, const_iterator last) { _h.erase(first, last); }
+
+		// Swaps data with another map
+		void swap(unordered_map &x) { _h.swap(x._h); }
+
+		// Erases all elements in a map, and keeps the memory
+		void clear() { _h.clear(); }
+
+		/*************************************************************
+		 * Observers
+		 *************************************************************/
+		hasher hash_function() const { return _h.hash_function(); }
+		key_equal key_eq() const { return _h.key_eq(); }
+
+		/*************************************************************
+		 * Map operations
+		 *************************************************************/
+		// These functions take a key and tries to locate the element with which
+		// the key matches.  If successful the functions return an
+		// iterator pointing to the sought after pair. If unsuccessful they
+		// return the past-the-end
+		iterator find(const key_type &x) { return _h.find(x); }
+		const_iterator find(const key_type &x) const { return _h.find(x); }
+
+		// The result will either be 0 (not present) or 1 (present).
+		size_type count(const key_type &x) const { return _h.count(x); }
+
+		// Return a pair of iterators around the pair with the given key,
+		// if any.
+		pair<iterator, iterator> equal_range(const key_type &x)
+		{ return _h.equal_range(x); }
+		pair<const_iterator, const_iterator> equal_range(const key_type &x) const
+		{ return _h.equal_range(x); }
+
+		/*************************************************************
+		 * Hash policy
+		 *************************************************************/
+		// Number of slots, full or not
+		size_type bucket_count() const { return _h.bucket_count(); }
+
+		float load_factor() const { return _h.load_factor(); }
+
+		// The map grows when the load factor would go above this one,
+		// 0.875 by default.
+		float max_load_factor() const { return _h.max_load_factor(); }
+		void max_load_factor(float z) { _h.max_load_factor(z); }
+
+		// Gives the map at least n slots.
+		void rehash(size_type n) { _h.rehash(n); }
+
+		// Makes room for n pairs, so that inserting them does not grow
+		// the map again.
+		void reserve(size_type n) { _h.reserve(n); }
+
+		/*************************************************************
+		 *  Relational operators
+		 *************************************************************/
+
+		template <typename _K1, typename _T1, typename _H1, typename _P1, typename _A1>
+		friend bool operator==(const unordered_map<_K1, _T1, _H1, _P1, _A1> &,
+							   const unordered_map<_K1, _T1, _H1, _P1, _A1> &);
+
+	}; // unordered_map
+
+	/*************************************************************
+	 *  Relational operators
+	 *************************************************************/
+	// Maps are considered equivalent if they hold the same pairs, in
+	// any order. Linear in the size of the maps on average.
+	template <typename Key, typename T, typename Hash, typename Pred, typename Alloc>
+	bool operator==(const unordered_map<Key, T, Hash, Pred, Alloc> &x,
+					const unordered_map<Key, T, Hash, Pred, Alloc> &y)
+	{ return x._h == y._h; }
+
+	template <typename Key, typename T, typename Hash, typename Pred, typename Alloc>
+	bool operator!=(const unordered_map<Key, T, Hash, Pred, Alloc> &x,
+					const unordered_map<Key, T, Hash, Pred, Alloc> &y)
+	{ return !(x == y); }
+
+	// specialized algorithms:
+	template <typename Key, typename T, typename Hash, typename Pred, typename Alloc>
+	void swap(unordered_map<Key, T, Hash, Pred, Alloc> &x,
+			  unordered_map<Key, T, Hash, Pred, Alloc> &y)
+	{ x.swap(y); }
+
+} // namespace ft
+
+#endif /* _FT_UNORDERED_MAP_HPP */
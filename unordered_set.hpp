@@ -0,0 +1,244 @@
+#ifndef _FT_UNORDERED_SET_HPP
+#define _FT_UNORDERED_SET_HPP
+
+#include <functional>
+#include <memory>
+
+#include "algorithm.hpp"
+#include "functional.hpp"
+#include "type_traits.hpp"
+#include "utility.hpp"
+#include "hashtable.hpp"
+
+namespace ft
+{
+
+	/*************************************************************
+	 * unordered_set
+
+	 * A set stored in an open addressing hash table (see hashtable.hpp),
+		with the interface of ft::set minus the ordered operations.
+	 * Lookups take constant time on average, but the keys are visited
+		in no particular order, and an insertion that grows the table
+		invalidates all the iterators into the set.
+	*************************************************************/
+	template <typename Key, typename Hash = ft::hash<Key>,
+			  typename Pred = std::equal_to<Key>,
+			  typename Alloc = std::allocator<Key> >
+	class unordered_set
+	{
+
+	public:
+		/*************************************************************
+		 * Types
+		 *************************************************************/
+		typedef Key		key_type;
+		typedef Key		value_type;
+		typedef Hash	hasher;
+		typedef Pred	key_equal;
+		typedef Alloc	allocator_type;
+
+		typedef typename __gnu_cxx::__alloc_traits<Alloc>::template
+		rebind<Key>::other _Key_alloc_type;
+
+		typedef hashtable<key_type, value_type, std::_Identity<value_type>,
+				hasher, key_equal, _Key_alloc_type> rep_type;
+
+		rep_type _h;  // Hash table representing set.
+
+		typedef __gnu_cxx::__alloc_traits<_Key_alloc_type> alloc_traits;
+
+		typedef typename alloc_traits::pointer				pointer;
+		typedef typename alloc_traits::const_pointer		const_pointer;
+		typedef typename alloc_traits::reference			reference;
+		typedef typename alloc_traits::const_reference		const_reference;
+		typedef typename rep_type::const_iterator			iterator;
+		typedef typename rep_type::const_iterator			const_iterator;
+		typedef typename rep_type::size_type				size_type;
+		typedef typename rep_type::difference_type			difference_type;
+
+		/*************************************************************
+		 * Construct/Copy/Destroy
+		 *************************************************************/
+		// Default constructor creates no elements, and allocates nothing
+		unordered_set() : _h() {}
+
+		// n: minimal number of elements the set can hold before it grows
+		explicit unordered_set(size_type n, const hasher &hf = hasher(),
+							   const key_equal &eq = key_equal(),
+							   const allocator_type &alloc = allocator_type())
+			: _h(n, hf, eq, _Key_alloc_type(alloc)) {}
+
+		unordered_set(const unordered_set &x) : _h(x._h) {}
+
+		// Builds a set from a range
+		// Create a set consisting of copies of the elements from
+		// [first,last), without the duplicates.
+		template <typename InputIterator>
+		unordered_set(InputIterator first, InputIterator last) : _h()
+		{ _h.insert_range_unique(first, last); }
+
+		template <typename InputIterator>
+		unordered_set(InputIterator first, InputIterator last, size_type n,
+					  const hasher &hf = hasher(), const key_equal &eq = key_equal(),
+					  const allocator_type &alloc = allocator_type())
+			: _h(n, hf, eq, _Key_alloc_type(alloc))
+		{ _h.insert_range_unique(first, last); }
+
+		/*************************************************************
+		 *  Assignment operator
+		 *************************************************************/
+		unordered_set &operator=(const unordered_set &x)
+		{ _h = x._h; return *this; }
+
+		/*************************************************************
+		 *  Accessors
+		 *************************************************************/
+		///  Returns the hash function with which the set was constructed.
+		hasher			hash_function() const { return _h.hash_function(); }
+		///  Returns the key equality with which the set was constructed.
+		key_equal		key_eq() const { return _h.key_eq(); }
+		///  Returns the allocator object with which the set was constructed.
+		allocator_type	get_allocator() const
+		{ return allocator_type(_h.get_allocator()); }
+
+		/*************************************************************
+		 * Iterators
+		 *************************************************************/
+		// Return a iterator that points to the first element in the set.
+		// Iteration is done in no particular order.
+		iterator	begin(void) const { return _h.begin(); }
+
+		// Return a iterator that points to the one past the last element in the set.
+		iterator	end(void) const { return _h.end(); }
+
+		/*************************************************************
+		 * Capacity
+		 *************************************************************/
+		// Returns true if the set is empty
+		bool 		empty() const { return _h.empty(); }
+		// Returns the size of the set
+		size_type 	size() const { return _h.size(); }
+		// Returns the maximum size of the set
+		size_type	max_size() const { return _h.max_size(); }
+
+		/*************************************************************
+		 * Modifiers
+		 *************************************************************/
+
+		// Swaps data with another set
+		void		swap(unordered_set &x) { _h.swap(x._h); }
+
+		// This function attempts to insert an element into the set. A set
+		// relies on unique keys and thus an element is only inserted if it is
+		// not already present in the set.
+		ft::pair<iterator, bool>	insert(const value_type &x)
+		{
+			ft::pair<typename rep_type::iterator, bool> p =
+			_h.insert_unique(x);
+			return ft::pair<iterator, bool>(p.first, p.second);
+		}
+
+		// The hint is ignored: it is only there for the interface of set.
+		iterator	insert(const_iterator position, const value_type &x)
+		{ (void)position; return _h.insert_unique(x).first; }
+
+		// A template function that attempts to insert a range of elements.
+		template<typename _InputIterator>
+		void	insert(_InputIterator first, _InputIterator last)
+		{ _h.insert_range_unique(first, last); }
+
+		// Erases an element from a set. The other iterators stay valid.
+		void	erase(iterator position)
+		{ _h.erase(position); }
+
+		// Erases elements according to the provided key
+		size_type	erase(const key_type &x)
+		{ return _h.erase(x); }
+
+		// Erases a [first,last) range of elements from a set
+		void	erase(iterator first, iterator last)
+		{ _h.erase(first, last); }
+
+		// Erases all elements in a set, and keeps the memory
+		void		clear() { _h.clear(); }
+
+		/*************************************************************
+		 * Set operations
+		 *************************************************************/
+		// These functions take a key and tries to locate the element with which
+		// the key matches.  If successful the functions return a constant
+		// iterator pointing to the sought after element. If unsuccessful they
+		// return the past-the-end
+		iterator		find(const key_type &x) { return _h.find(x); }
+		const_iterator	find(const key_type &x) const { return _h.find(x); }
+
+		// The result will either be 0 (not present) or 1 (present).
+		size_type		count(const key_type &x) const { return _h.count(x); }
+
+		// Return a pair of iterators around the element equal to the
+		// given key, if any.
+		pair<iterator,iterator>				equal_range(const key_type &x)
+		{
+			pair<typename rep_type::iterator, typename rep_type::iterator> p
+				= _h.equal_range(x);
+			return pair<iterator, iterator>(p.first, p.second);
+		}
+		pair<const_iterator,const_iterator>	equal_range(const key_type &x) const
+		{ return _h.equal_range(x); }
+
+		/*************************************************************
+		 * Hash policy
+		 *************************************************************/
+		// Number of slots, full or not
+		size_type	bucket_count() const { return _h.bucket_count(); }
+
+		float		load_factor() const { return _h.load_factor(); }
+
+		// The set grows when the load factor would go above this one,
+		// 0.875 by default.
+		float		max_load_factor() const { return _h.max_load_factor(); }
+		void		max_load_factor(float z) { _h.max_load_factor(z); }
+
+		// Gives the set at least n slots.
+		void		rehash(size_type n) { _h.rehash(n); }
+
+		// Makes room for n elements, so that inserting them does not grow
+		// the set again.
+		void		reserve(size_type n) { _h.reserve(n); }
+
+		/*************************************************************
+		 *  Relational operators
+		 *************************************************************/
+
+		template<typename _K1, typename _H1, typename _P1, typename _A1>
+		friend bool	operator==(const unordered_set<_K1, _H1, _P1, _A1>&,
+			const unordered_set<_K1, _H1, _P1, _A1>&);
+
+	}; // unordered_set
+
+
+	/*************************************************************
+	 *  Relational operators
+	 *************************************************************/
+	// Sets are considered equivalent if they hold the same elements, in
+	// any order. Linear in the size of the sets on average.
+	template <typename Key, typename Hash, typename Pred, typename Alloc>
+	bool operator==(const unordered_set<Key, Hash, Pred, Alloc> &x,
+		const unordered_set<Key, Hash, Pred, Alloc> &y)
+	{ return x._h == y._h; }
+
+	template <typename Key, typename Hash, typename Pred, typename Alloc>
+	bool operator!=(const unordered_set<Key, Hash, Pred, Alloc> &x,
+		const unordered_set<Key, Hash, Pred, Alloc> &y)
+	{ return !(x == y); }
+
+	// specialized algorithms:
+	template <typename Key, typename Hash, typename Pred, typename Alloc>
+	void swap(unordered_set<Key, Hash, Pred, Alloc> &x,
+		unordered_set<Key, Hash, Pred, Alloc> &y)
+	{ x.swap(y); }
+
+} // namespace ft
+
+#endif /* _FT_UNORDERED_SET_HPP */
@@ -71,6 +71,17 @@ namespace ft
 	template <class T1, class T2>
 	pair<T1, T2> make_pair(const T1 t, const T2 u) { return pair<T1, T2>(t, u); }
 
+	/*************************************************************
+	 * SORTED_UNIQUE
+
+	 * Tag telling a map or set constructor that the range it is given
+		is already sorted by its comparison object, without duplicates,
+		so that the tree can be built without comparing any key.
+	*************************************************************/
+	struct sorted_unique_t {};
+
+	static const sorted_unique_t sorted_unique = sorted_unique_t();
+
 } // namespace
 
 #endif /* _FT_UTILITY_HPP */
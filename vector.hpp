@@ -3,6 +3,7 @@
 
 #include <memory>
 #include <iterator>
+#include <cstring>
 
 #include "algorithm.hpp"
 #include "type_traits.hpp"
@@ -72,23 +73,16 @@ namespace ft
 
 		// Range constructor
 		// Create a vector consisting of copies of the elements from [first,last)
-		//	with logN memory reallocations.
+		//	with a single allocation when the range can be measured beforehand
+		//	(forward iterators), and logN memory reallocations otherwise.
 		template <class InputIterator>
 		vector(InputIterator first, InputIterator last,
 			   const allocator_type &alloc = allocator_type(),
 			   typename ft::enable_if<!ft::is_integral<InputIterator>::value>::type * = 0)
-			: _alloc(alloc)
+			: _alloc(alloc), _capacity(0), _array(0), _size(0)
 		{
-			size_type n = 0;
-
-			for (InputIterator it(first); it != last; ++it)
-				++n;
-			_size = n;
-			_capacity = n;
-			_array = _alloc.allocate(n);
-
-			for (size_type i(0); i < n; ++i)
-				_alloc.construct(_array + i, *first++);
+			range_init(first, last,
+				typename ft::iterator_traits<InputIterator>::iterator_category());
 		}
 
 		// Copy constructor
@@ -96,10 +90,7 @@ namespace ft
 		// will not be copied (i.e. capacity() == size() in the new %vector)
 		vector(const vector &x) : _alloc(x._alloc), _capacity(x._size),
 								  _array(_alloc.allocate(_capacity)), _size(x._size)
-		{
-			for (size_type i(0); i < _size; ++i)
-				_alloc.construct(_array + i, x[i]);
-		}
+		{ construct_range(_array, x._array, x._array + _size); }
 
 		// Destructor
 		// This only erases the elements. If the elements themselves are
@@ -131,21 +122,8 @@ namespace ft
 		void assign(InputIterator first, InputIterator last,
 					typename ft::enable_if<!ft::is_integral<InputIterator>::value>::type * = 0)
 		{
-			// Get size needed by the range
-			size_type n = 0;
-			for (InputIterator it(first); it != last; ++it)
-				++n;
-			// Increase capacity if not enough
-			if (n > _capacity)
-				reserve(n);
-			// Fill the vector with the range
-			for (size_type i(0); i < n; ++i)
-				_alloc.construct(_array + i, *first++);
-			// Erase at end if n is smaller than the vector size
-			if (n < _size)
-				for (size_type i(n); i < _size; ++i)
-					_alloc.destroy(_array + i);
-			_size = n;
+			range_assign(first, last,
+				typename ft::iterator_traits<InputIterator>::iterator_category());
 		}
 
 		// This function fills a vector with n copies of the given
@@ -238,11 +216,7 @@ namespace ft
 			{
 				pointer new_array = _alloc.allocate(n);
 
-				for (size_type i(0); i < _size; ++i)
-				{
-					_alloc.construct(new_array + i, _array[i]);
-					_alloc.destroy(_array + i);
-				}
+				relocate(new_array, _array, _size, trivial_copy());
 				_alloc.deallocate(_array, _capacity);
 				_array = new_array;
 				_capacity = n;
@@ -311,20 +285,27 @@ namespace ft
 		// used the user should consider using std::list.
 		void insert(iterator position, size_type n, const value_type &x)
 		{
-			difference_type pos = position - begin();
+			size_type pos = position - begin();
 
 			if (n == 0)
 				return;
-			if (_size + n > _capacity)
-				reserve(new_cap(n, _INSERT));
+			// x may live inside the vector, so copy it before moving memory
+			const value_type copy(x);
 
-			for (size_type i(0); i < n; ++i)
-				_alloc.construct(_array + _size + i, x);
-			for (int i(_size - 1); i >= 0 && i >= pos; --i)
-				_array[i + n] = _array[i];
-			for (size_type i(pos); i < pos + n; ++i)
-				_array[i] = x;
-			_size = _size + n;
+			if (_size + n > _capacity)
+			{
+				// Builds the new buffer as prefix + inserted elements + suffix
+				size_type cap = new_cap(n, _INSERT);
+				pointer new_array = _alloc.allocate(cap);
+
+				try
+				{ construct_fill(new_array + pos, n, copy); }
+				catch (...)
+				{ _alloc.deallocate(new_array, cap); throw; }
+				adopt_buffer(new_array, cap, pos, n);
+			}
+			else
+				fill_insert(pos, n, copy, trivial_copy());
 		}
 
 		// This function will insert copies of the data in the range
@@ -333,22 +314,8 @@ namespace ft
 		void insert(iterator position, InputIterator first, InputIterator last,
 					typename ft::enable_if<!ft::is_integral<InputIterator>::value>::type * = 0)
 		{
-			difference_type pos = position - begin();
-			size_type n = 0;
-
-			for (InputIterator it(first); it != last; ++it)
-				++n;
-
-			if (_size + n > _capacity)
-				reserve(new_cap(n, _INSERT));
-
-			for (size_type i(0); i < n; ++i)
-				_alloc.construct(_array + _size + i, *first);
-			for (int i(_size - 1); i >= 0 && i >= pos; --i)
-				_array[i + n] = _array[i];
-			for (size_type i(pos); i < pos + n; ++i)
-				_array[i] = *first++;
-			_size += n;
+			range_insert(position, first, last,
+				typename ft::iterator_traits<InputIterator>::iterator_category());
 		}
 
 		// This function will erase the element at the given position and thus
@@ -360,35 +327,14 @@ namespace ft
 		// the pointed-to memory is not touched in any way.  Managing
 		// the pointer is the user's responsibility.
 		iterator erase(iterator position)
-		{
-			difference_type pos = position - begin();
-
-			_alloc.destroy(_array + pos);
-			--_size;
-			for (size_type i(pos); i < _size; ++i)
-			{
-				_alloc.construct(_array + i, _array[i + 1]);
-				_alloc.destroy(&_array[i + 1]);
-			}
-			return begin() + pos;
-		}
+		{ return erase(position, position + 1); }
 
 		iterator erase(iterator first, iterator last)
 		{
-			difference_type n = last - first;
+			difference_type pos = first - begin();
 
-			while (first != end() - n)
-			{
-				*first = first[n];
-				++first;
-			}
-			while (first != end())
-			{
-				_alloc.destroy(first.base());
-				++first;
-			}
-			_size -= n;
-			return last - n;
+			erase_at(pos, last - first, trivial_copy());
+			return begin() + pos;
 		}
 
 		// Swaps data with another vector
@@ -418,6 +364,306 @@ namespace ft
 		value_type *_array;
 		size_type _size;
 
+		// Elements that are trivially copyable and built by the default
+		// allocator can be moved around with a plain memory copy instead
+		// of being constructed and destroyed one by one.
+		typedef ft::integral_constant<bool,
+			ft::is_trivially_copyable<value_type>::value
+			&& ft::is_same<allocator_type, std::allocator<value_type> >::value>
+														trivial_copy;
+
+		// Moves n elements from src to the uninitialized storage at dst,
+		// leaving src uninitialized.
+		void relocate(pointer dst, pointer src, size_type n, ft::true_type)
+		{
+			if (n)
+				std::memmove(dst, src, n * sizeof(value_type));
+		}
+
+		void relocate(pointer dst, pointer src, size_type n, ft::false_type)
+		{
+			for (size_type i(0); i < n; ++i)
+			{
+				_alloc.construct(dst + i, src[i]);
+				_alloc.destroy(src + i);
+			}
+		}
+
+		// Input iterators can only be walked once: they are copied aside
+		// and then inserted as a random access range.
+		template <class InputIterator>
+		void range_insert(iterator position, InputIterator first,
+						  InputIterator last, std::input_iterator_tag)
+		{
+			if (position == end())
+			{
+				for (; first != last; ++first)
+					push_back(*first);
+			}
+			else if (first != last)
+			{
+				vector tmp(first, last, _alloc);
+				insert(position, tmp.begin(), tmp.end());
+			}
+		}
+
+		template <class ForwardIterator>
+		void range_insert(iterator position, ForwardIterator first,
+						  ForwardIterator last, std::forward_iterator_tag)
+		{
+			size_type pos = position - begin();
+			size_type n = ft::distance(first, last);
+
+			if (n == 0)
+				return;
+			if (_size + n > _capacity)
+			{
+				// Builds the new buffer as prefix + inserted range + suffix
+				size_type cap = new_cap(n, _INSERT);
+				pointer new_array = _alloc.allocate(cap);
+
+				try
+				{ construct_range(new_array + pos, first, last); }
+				catch (...)
+				{ _alloc.deallocate(new_array, cap); throw; }
+				adopt_buffer(new_array, cap, pos, n);
+			}
+			else
+				copy_insert(pos, n, first, last, trivial_copy());
+		}
+
+		// The range of an input iterator cannot be measured without
+		// consuming it, so the vector grows as elements come.
+		template <class InputIterator>
+		void range_init(InputIterator first, InputIterator last,
+						std::input_iterator_tag)
+		{
+			for (; first != last; ++first)
+				push_back(*first);
+		}
+
+		// Forward ranges are measured once (in constant time for random
+		// access iterators) and copied into a single allocation.
+		template <class ForwardIterator>
+		void range_init(ForwardIterator first, ForwardIterator last,
+						std::forward_iterator_tag)
+		{
+			size_type n = ft::distance(first, last);
+
+			_array = _alloc.allocate(n);
+			_capacity = n;
+			construct_range(_array, first, last);
+			_size = n;
+		}
+
+		// Existing elements are assigned in place, the remainder is either
+		// appended or erased.
+		template <class InputIterator>
+		void range_assign(InputIterator first, InputIterator last,
+						  std::input_iterator_tag)
+		{
+			iterator cur(begin());
+
+			for (; first != last && cur != end(); ++cur, ++first)
+				*cur = *first;
+			if (first == last)
+				erase(cur, end());
+			else
+				for (; first != last; ++first)
+					push_back(*first);
+		}
+
+		template <class ForwardIterator>
+		void range_assign(ForwardIterator first, ForwardIterator last,
+						  std::forward_iterator_tag)
+		{
+			size_type n = ft::distance(first, last);
+
+			if (n > _capacity)
+			{
+				// Built in a new buffer, which replaces the old one once
+				// complete: if a copy throws, the vector is left as it was
+				pointer new_array = _alloc.allocate(n);
+
+				try
+				{ construct_range(new_array, first, last); }
+				catch (...)
+				{ _alloc.deallocate(new_array, n); throw; }
+				clear();
+				_alloc.deallocate(_array, _capacity);
+				_array = new_array;
+				_capacity = n;
+			}
+			else if (trivial_copy::value)
+			{
+				clear();
+				construct_range(_array, first, last);
+			}
+			else
+			{
+				// The live elements are assigned over, the tail is
+				// constructed, and the excess destroyed
+				pointer cur = _array;
+
+				for (; first != last && cur != _array + _size; ++first, ++cur)
+					*cur = *first;
+				if (first != last)
+					construct_range(cur, first, last);
+				for (; cur < _array + _size; ++cur)
+					_alloc.destroy(cur);
+			}
+			_size = n;
+		}
+
+		// Copy-constructs the elements of [first,last) into the uninitialized
+		// storage at dst. Contiguous ranges of our own value type are handed
+		// to the pointer overloads, which copy them in bulk when possible.
+		template <class InputIterator>
+		void construct_range(pointer dst, InputIterator first, InputIterator last)
+		{
+			for (; first != last; ++first, ++dst)
+				_alloc.construct(dst, *first);
+		}
+
+		template <bool B>
+		void construct_range(pointer dst, ft::random_access_iterator<B, value_type> first,
+							 ft::random_access_iterator<B, value_type> last)
+		{ construct_range(dst, first.base(), last.base(), trivial_copy()); }
+
+		void construct_range(pointer dst, value_type *first, value_type *last)
+		{ construct_range(dst, first, last, trivial_copy()); }
+
+		void construct_range(pointer dst, const value_type *first,
+							 const value_type *last)
+		{ construct_range(dst, first, last, trivial_copy()); }
+
+		void construct_range(pointer dst, const value_type *first,
+							 const value_type *last, ft::true_type)
+		{
+			if (first != last)
+				std::memcpy(dst, first, (last - first) * sizeof(value_type));
+		}
+
+		void construct_range(pointer dst, const value_type *first,
+							 const value_type *last, ft::false_type)
+		{
+			for (; first != last; ++first, ++dst)
+				_alloc.construct(dst, *first);
+		}
+
+		// Copy-constructs n copies of x into the uninitialized storage at dst
+		void construct_fill(pointer dst, size_type n, const value_type &x)
+		{
+			for (size_type i(0); i < n; ++i)
+				_alloc.construct(dst + i, x);
+		}
+
+		// Takes over new_array, whose n slots at pos have already been
+		// constructed: the current elements are relocated around them.
+		void adopt_buffer(pointer new_array, size_type cap, size_type pos,
+						  size_type n)
+		{
+			relocate(new_array, _array, pos, trivial_copy());
+			relocate(new_array + pos + n, _array + pos, _size - pos, trivial_copy());
+			_alloc.deallocate(_array, _capacity);
+			_array = new_array;
+			_capacity = cap;
+			_size += n;
+		}
+
+		// Moves the elements from pos to the end n slots toward the back,
+		// in a single pass starting from the end, then fills the gap left
+		// at pos. Capacity must already be sufficient.
+		// Trivially copyable elements are moved with one memmove, leaving an
+		// uninitialized gap. Other elements are copy-constructed into the
+		// uninitialized tail and assigned everywhere else.
+		void fill_insert(size_type pos, size_type n, const value_type &x,
+						 ft::true_type)
+		{
+			relocate(_array + pos + n, _array + pos, _size - pos, ft::true_type());
+			construct_fill(_array + pos, n, x);
+			_size += n;
+		}
+
+		void fill_insert(size_type pos, size_type n, const value_type &x,
+						 ft::false_type)
+		{
+			const size_type after = _size - pos;
+			pointer old_end = _array + _size;
+
+			if (after > n)
+			{
+				construct_range(old_end, old_end - n, old_end);
+				for (size_type i(after - n); i > 0; --i)
+					_array[pos + n + i - 1] = _array[pos + i - 1];
+				for (size_type i(pos); i < pos + n; ++i)
+					_array[i] = x;
+			}
+			else
+			{
+				construct_fill(old_end, n - after, x);
+				construct_range(old_end + n - after, _array + pos, old_end);
+				for (size_type i(pos); i < _size; ++i)
+					_array[i] = x;
+			}
+			_size += n;
+		}
+
+		template <class ForwardIterator>
+		void copy_insert(size_type pos, size_type n, ForwardIterator first,
+						 ForwardIterator last, ft::true_type)
+		{
+			relocate(_array + pos + n, _array + pos, _size - pos, ft::true_type());
+			construct_range(_array + pos, first, last);
+			_size += n;
+		}
+
+		template <class ForwardIterator>
+		void copy_insert(size_type pos, size_type n, ForwardIterator first,
+						 ForwardIterator last, ft::false_type)
+		{
+			const size_type after = _size - pos;
+			pointer old_end = _array + _size;
+
+			if (after > n)
+			{
+				construct_range(old_end, old_end - n, old_end);
+				for (size_type i(after - n); i > 0; --i)
+					_array[pos + n + i - 1] = _array[pos + i - 1];
+				for (pointer p(_array + pos); first != last; ++first, ++p)
+					*p = *first;
+			}
+			else
+			{
+				ForwardIterator mid(first);
+
+				for (size_type i(0); i < after; ++i)
+					++mid;
+				construct_range(old_end, mid, last);
+				construct_range(old_end + n - after, _array + pos, old_end);
+				for (pointer p(_array + pos); first != mid; ++first, ++p)
+					*p = *first;
+			}
+			_size += n;
+		}
+
+		// Erases the n elements starting at pos, shifting the elements
+		// after them toward the front.
+		void erase_at(size_type pos, size_type n, ft::true_type)
+		{
+			relocate(_array + pos, _array + pos + n, _size - pos - n, ft::true_type());
+			_size -= n;
+		}
+
+		void erase_at(size_type pos, size_type n, ft::false_type)
+		{
+			for (size_type i(pos); i + n < _size; ++i)
+				_array[i] = _array[i + n];
+			for (size_type i(_size - n); i < _size; ++i)
+				_alloc.destroy(_array + i);
+			_size -= n;
+		}
+
 		// When using member functions as push_back(), resize() or insert(),
 		// vectors from STL can allocate more than needed when the function
 		// is called. This is to optimize the performance of the container